@@ -0,0 +1,214 @@
+/**
+ * @file bench_blocking_stack.c
+ * @brief Benchmark: blocking stack vs polling a mutex-guarded Stack
+ * @author Jaden Mardini
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "blocking_stack.h"
+#include "dynamic_stack.h"
+
+#define CAPACITY 64
+#define STREAM_ITEMS 200000
+#define BATCH_SIZE 32
+#define SPARSE_ITEMS 2000
+#define SPARSE_GAP_NS 20000
+
+/* Producer/consumer pair state */
+typedef struct {
+    BlockingStack* blocking;
+    Stack* polled;
+    pthread_mutex_t lock;
+    double start;               /* Time base for latency stamps */
+    int items;
+    long gap_ns;                /* Producer pause between items, 0 for none */
+    int batch;                  /* Values per blocking push, 1 for single pushes */
+    double latency_total;       /* Consumer: summed push-to-pop latency in seconds */
+} Channel;
+
+/**
+ * @brief Reads the CPU time used by the whole process
+ */
+static double cpu_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Sleeps between sparse items
+ */
+static void pause_ns(long ns) {
+    struct timespec ts = { 0, ns };
+    nanosleep(&ts, NULL);
+}
+
+/**
+ * @brief Encodes the current time as microseconds since the channel start
+ */
+static int stamp(const Channel* channel) {
+    return (int)((bench_now() - channel->start) * 1e6);
+}
+
+/**
+ * @brief Adds the latency of a stamped item to the consumer's total
+ */
+static void record(Channel* channel, int value) {
+    if (channel->gap_ns > 0) {
+        channel->latency_total += (bench_now() - channel->start) - value / 1e6;
+    }
+    bench_sink += value;
+}
+
+/**
+ * @brief Pushes items, retrying with sched_yield while the Stack is full
+ */
+static void* polling_producer(void* argument) {
+    Channel* channel = argument;
+    for (int i = 0; i < channel->items; i++) {
+        if (channel->gap_ns > 0) {
+            pause_ns(channel->gap_ns);
+        }
+        int value = channel->gap_ns > 0 ? stamp(channel) : i;
+        for (;;) {
+            pthread_mutex_lock(&channel->lock);
+            StackResult result = stack_push(channel->polled, value);
+            pthread_mutex_unlock(&channel->lock);
+            if (result == STACK_SUCCESS) {
+                break;
+            }
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Pops items, retrying with sched_yield while the Stack is empty
+ */
+static void* polling_consumer(void* argument) {
+    Channel* channel = argument;
+    for (int i = 0; i < channel->items; i++) {
+        int value;
+        for (;;) {
+            pthread_mutex_lock(&channel->lock);
+            StackResult result = stack_pop(channel->polled, &value);
+            pthread_mutex_unlock(&channel->lock);
+            if (result == STACK_SUCCESS) {
+                break;
+            }
+            sched_yield();
+        }
+        record(channel, value);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Pushes items with push_wait, or push_many when batching
+ */
+static void* blocking_producer(void* argument) {
+    Channel* channel = argument;
+    int values[BATCH_SIZE];
+    for (int i = 0; i < channel->items; i += channel->batch) {
+        if (channel->gap_ns > 0) {
+            pause_ns(channel->gap_ns);
+        }
+        if (channel->batch == 1) {
+            blocking_stack_push_wait(channel->blocking, channel->gap_ns > 0 ? stamp(channel) : i);
+        } else {
+            int count = channel->items - i < channel->batch ? channel->items - i : channel->batch;
+            for (int j = 0; j < count; j++) {
+                values[j] = i + j;
+            }
+            blocking_stack_push_many(channel->blocking, values, (size_t)count);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Pops items with pop_wait, or pop_many when batching
+ */
+static void* blocking_consumer(void* argument) {
+    Channel* channel = argument;
+    int values[BATCH_SIZE];
+    int received = 0;
+    while (received < channel->items) {
+        size_t popped = 1;
+        if (channel->batch == 1) {
+            blocking_stack_pop_wait(channel->blocking, &values[0]);
+        } else {
+            blocking_stack_pop_many(channel->blocking, values, BATCH_SIZE, &popped);
+        }
+        for (size_t j = 0; j < popped; j++) {
+            record(channel, values[j]);
+        }
+        received += (int)popped;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Runs one producer and one consumer and reports wall time, CPU time and latency
+ */
+static void run_pair(const char* name, void* (*producer)(void*), void* (*consumer)(void*),
+                     int items, long gap_ns, int batch) {
+    Channel channel;
+    channel.blocking = blocking_stack_create(CAPACITY);
+    channel.polled = stack_create(CAPACITY);
+    pthread_mutex_init(&channel.lock, NULL);
+    channel.items = items;
+    channel.gap_ns = gap_ns;
+    channel.batch = batch;
+    channel.latency_total = 0.0;
+
+    pthread_t threads[2];
+    double cpu_start = cpu_now();
+    channel.start = bench_now();
+    pthread_create(&threads[0], NULL, consumer, &channel);
+    pthread_create(&threads[1], NULL, producer, &channel);
+    pthread_join(threads[1], NULL);
+    pthread_join(threads[0], NULL);
+    double wall = bench_now() - channel.start;
+    double cpu = cpu_now() - cpu_start;
+
+    bench_report(name, wall, items);
+    if (gap_ns > 0) {
+        printf("  %-40s %10.2f ms CPU  %9.1f us mean latency\n", "", cpu * 1e3,
+               channel.latency_total / items * 1e6);
+    } else {
+        printf("  %-40s %10.2f ms CPU\n", "", cpu * 1e3);
+    }
+
+    pthread_mutex_destroy(&channel.lock);
+    stack_destroy(channel.polled);
+    blocking_stack_destroy(channel.blocking);
+}
+
+int main(void) {
+    printf("=== Blocking Stack Benchmark ===\n");
+    printf("One producer, one consumer, capacity %d, %ld online CPUs\n\n",
+           CAPACITY, sysconf(_SC_NPROCESSORS_ONLN));
+
+    printf("Stream of %d items:\n", STREAM_ITEMS);
+    run_pair("polling Stack + mutex", polling_producer, polling_consumer, STREAM_ITEMS, 0, 1);
+    run_pair("blocking push_wait/pop_wait", blocking_producer, blocking_consumer, STREAM_ITEMS, 0, 1);
+    run_pair("blocking push_many/pop_many", blocking_producer, blocking_consumer, STREAM_ITEMS, 0,
+             BATCH_SIZE);
+
+    printf("\n%d items, %d us apart (consumer mostly idle):\n", SPARSE_ITEMS, SPARSE_GAP_NS / 1000);
+    run_pair("polling Stack + mutex", polling_producer, polling_consumer, SPARSE_ITEMS, SPARSE_GAP_NS, 1);
+    run_pair("blocking push_wait/pop_wait", blocking_producer, blocking_consumer, SPARSE_ITEMS,
+             SPARSE_GAP_NS, 1);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file bench_bracket_validator.c
+ * @brief Benchmark: SIMD bracket validator vs char_stack byte-at-a-time
+ * @author Jaden Mardini
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench_util.h"
+#include "bracket_validator.h"
+#include "static_stack.h"
+
+#define PAYLOAD_BYTES (64u * 1024u * 1024u)
+#define REPETITIONS 5
+
+/**
+ * @brief Builds a JSON-like payload of nested objects and arrays
+ */
+static char* build_payload(size_t* length) {
+    static const char record[] =
+        "{\"id\": 12345, \"name\": \"example record\", \"tags\": [\"alpha\", \"beta\"], "
+        "\"nested\": {\"values\": [1, 2, 3, 4], \"note\": \"text (with) parens\"}}, ";
+    size_t record_length = sizeof(record) - 1;
+    char* payload = malloc(PAYLOAD_BYTES + 2);
+    if (!payload) {
+        return NULL;
+    }
+
+    size_t used = 0;
+    payload[used++] = '[';
+    while (used + record_length + 1 < PAYLOAD_BYTES) {
+        memcpy(payload + used, record, record_length);
+        used += record_length;
+    }
+    payload[used++] = ']';
+    *length = used;
+    return payload;
+}
+
+/**
+ * @brief Validation through the 256-deep global char stack
+ */
+static bool naive_validate(const char* data, size_t length) {
+    char_stack_clear();
+    for (size_t i = 0; i < length; i++) {
+        char c = data[i];
+        char open;
+        if (c == '(' || c == '[' || c == '{') {
+            if (char_stack_push(c) != CHAR_STACK_SUCCESS) {
+                return false;
+            }
+        } else if (c == ')' || c == ']' || c == '}') {
+            if (char_stack_pop(&open) != CHAR_STACK_SUCCESS ||
+                (c == ')' && open != '(') || (c == ']' && open != '[') || (c == '}' && open != '{')) {
+                return false;
+            }
+        }
+    }
+    return char_stack_is_empty();
+}
+
+int main(void) {
+    size_t length = 0;
+    char* payload = build_payload(&length);
+    if (!payload) {
+        fprintf(stderr, "allocation failed\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("=== Bracket Validator Benchmark ===\n");
+    printf("Payload: %zu bytes of JSON-like text, %d repetitions\n\n", length, REPETITIONS);
+
+    double bytes = (double)length * REPETITIONS;
+    double start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        bench_sink += naive_validate(payload, length);
+    }
+    double elapsed = bench_now() - start;
+    bench_report("char_stack byte-at-a-time", elapsed, bytes);
+    printf("  %-40s %10.2f GB/s\n", "", bytes / elapsed / 1e9);
+
+    BracketReport report;
+    start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        bench_sink += bracket_validate(payload, length, NULL, &report);
+    }
+    elapsed = bench_now() - start;
+    bench_report("bracket_validate", elapsed, bytes);
+    printf("  %-40s %10.2f GB/s\n", "", bytes / elapsed / 1e9);
+
+    BracketOptions options = { NULL, true, '"' };
+    start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        bench_sink += bracket_validate(payload, length, &options, &report);
+    }
+    elapsed = bench_now() - start;
+    bench_report("bracket_validate (skip strings)", elapsed, bytes);
+    printf("  %-40s %10.2f GB/s\n", "", bytes / elapsed / 1e9);
+
+    free(payload);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file bench_compact_stack.c
+ * @brief Benchmark: compact stack memory and speed vs the int Stack
+ * @author Jaden Mardini
+ *
+ * Each workload fills a stack to its capacity and drains it, repeatedly,
+ * with values typical of one use: small state IDs, depths that need two
+ * bytes, and rising offsets. Memory is the element storage each stack
+ * allocates; the int Stack always needs four bytes per element.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench_util.h"
+#include "compact_stack.h"
+#include "dynamic_stack.h"
+
+#define DEPTH 100000
+#define ROUNDS 50
+
+/* Value generators for the workloads */
+static int state_id(int i) { return i % 97; }
+static int depth_value(int i) { return (i * 37) % 20000; }
+static int rising_offset(int i) { return 1000000 + i * 3 + (i % 5); }
+
+/**
+ * @brief Fills and drains an int Stack
+ */
+static double run_stack(int (*value_at)(int)) {
+    Stack* stack = stack_create(DEPTH);
+    stack_set_wipe_policy(stack, STACK_WIPE_NEVER);
+    long long sum = 0;
+
+    double start = bench_now();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int i = 0; i < DEPTH; i++) {
+            stack_push(stack, value_at(i));
+        }
+        int value;
+        while (stack_pop(stack, &value) == STACK_SUCCESS) {
+            sum += value;
+        }
+    }
+    double elapsed = bench_now() - start;
+
+    bench_sink += sum;
+    stack_destroy(stack);
+    return elapsed;
+}
+
+/**
+ * @brief Fills and drains a compact stack, reporting the storage it needed
+ */
+static double run_compact(int (*value_at)(int), CompactStackMode mode, size_t* bytes) {
+    CompactStack* stack = compact_stack_create(DEPTH, mode);
+    long long sum = 0;
+
+    double start = bench_now();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int i = 0; i < DEPTH; i++) {
+            compact_stack_push(stack, value_at(i));
+        }
+        int value;
+        while (compact_stack_pop(stack, &value) == STACK_SUCCESS) {
+            sum += value;
+        }
+    }
+    double elapsed = bench_now() - start;
+
+    *bytes = compact_stack_memory_usage(stack);
+    bench_sink += sum;
+    compact_stack_destroy(stack);
+    return elapsed;
+}
+
+/**
+ * @brief Runs one workload on the int Stack and a compact stack
+ */
+static void run_workload(const char* name, int (*value_at)(int), CompactStackMode mode) {
+    double operations = 2.0 * DEPTH * ROUNDS;
+    size_t bytes = 0;
+    size_t stack_bytes = (size_t)DEPTH * sizeof(int);
+
+    printf("%s:\n", name);
+    bench_report("Stack (int)", run_stack(value_at), operations);
+    bench_report(mode == COMPACT_STACK_DELTA ? "CompactStack (delta)" : "CompactStack (narrow)",
+                 run_compact(value_at, mode, &bytes), operations);
+    printf("  %-40s %10zu KiB vs %zu KiB (%.1fx smaller)\n\n", "", bytes / 1024, stack_bytes / 1024,
+           (double)stack_bytes / (double)bytes);
+}
+
+int main(void) {
+    printf("=== Compact Stack Benchmark ===\n");
+    printf("%d rounds of %d pushes and pops\n\n", ROUNDS, DEPTH);
+
+    run_workload("State IDs 0-96", state_id, COMPACT_STACK_NARROW);
+    run_workload("Depths 0-19999", depth_value, COMPACT_STACK_NARROW);
+    run_workload("Rising offsets from 1000000", rising_offset, COMPACT_STACK_DELTA);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file bench_monotonic_stack.c
+ * @brief Benchmark: monotonic-stack kernels vs naive Stack-based versions
+ * @author Jaden Mardini
+ *
+ * The naive versions are what teams write on top of the public Stack API:
+ * one stack_push/stack_pop/stack_peek call per step, storing indices as
+ * ints. The batch run processes many independent arrays across threads.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "dynamic_stack.h"
+#include "monotonic_stack.h"
+
+#define ARRAY_LENGTH 500000
+#define REPETITIONS 20
+#define BATCH_ARRAYS 64
+#define BATCH_LENGTH 100000
+
+/**
+ * @brief Next-greater-element through the Stack API
+ */
+static void naive_next_greater(const int* values, size_t count, size_t* out) {
+    Stack* stack = stack_create(count);
+    int top;
+    for (size_t i = 0; i < count; i++) {
+        while (stack_peek(stack, &top) == STACK_SUCCESS && values[i] > values[top]) {
+            stack_pop(stack, &top);
+            out[top] = i;
+        }
+        stack_push(stack, (int)i);
+    }
+    while (stack_pop(stack, &top) == STACK_SUCCESS) {
+        out[top] = MONOTONIC_NONE;
+    }
+    stack_destroy(stack);
+}
+
+/**
+ * @brief Largest rectangle through the Stack API
+ */
+static long long naive_largest_rectangle(const int* heights, size_t count) {
+    Stack* stack = stack_create(count + 1);
+    long long best = 0;
+    int top;
+    for (size_t i = 0; i <= count; i++) {
+        int current = i < count ? heights[i] : 0;
+        while (stack_peek(stack, &top) == STACK_SUCCESS && heights[top] >= current) {
+            stack_pop(stack, &top);
+            int left;
+            size_t start = stack_peek(stack, &left) == STACK_SUCCESS ? (size_t)left + 1 : 0;
+            long long candidate = (long long)heights[top] * (long long)(i - start);
+            if (candidate > best) {
+                best = candidate;
+            }
+        }
+        stack_push(stack, (int)i);
+    }
+    stack_destroy(stack);
+    return best;
+}
+
+static void fill_random(int* values, size_t count, unsigned seed) {
+    srand(seed);
+    for (size_t i = 0; i < count; i++) {
+        values[i] = rand() % 10000;
+    }
+}
+
+int main(void) {
+    int* values = malloc(ARRAY_LENGTH * sizeof(int));
+    size_t* out = malloc(ARRAY_LENGTH * sizeof(size_t));
+    if (!values || !out) {
+        fprintf(stderr, "allocation failed\n");
+        return EXIT_FAILURE;
+    }
+    fill_random(values, ARRAY_LENGTH, 42);
+
+    printf("=== Monotonic Stack Kernel Benchmark ===\n");
+    printf("Single array of %d values, %d repetitions\n\n", ARRAY_LENGTH, REPETITIONS);
+
+    double operations = (double)ARRAY_LENGTH * REPETITIONS;
+    double start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        naive_next_greater(values, ARRAY_LENGTH, out);
+        bench_sink += (long long)out[r];
+    }
+    bench_report("naive next greater (Stack API)", bench_now() - start, operations);
+
+    MonotonicWorkspace* workspace = monotonic_workspace_create(ARRAY_LENGTH);
+    start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        monotonic_next_greater(workspace, values, ARRAY_LENGTH, out);
+        bench_sink += (long long)out[r];
+    }
+    bench_report("kernel next greater", bench_now() - start, operations);
+
+    start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        bench_sink += naive_largest_rectangle(values, ARRAY_LENGTH);
+    }
+    bench_report("naive largest rectangle (Stack API)", bench_now() - start, operations);
+
+    start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        long long area;
+        monotonic_largest_rectangle(workspace, values, ARRAY_LENGTH, &area);
+        bench_sink += area;
+    }
+    bench_report("kernel largest rectangle", bench_now() - start, operations);
+    monotonic_workspace_destroy(workspace);
+
+    /* Batch of independent arrays */
+    int* batch_values = malloc((size_t)BATCH_ARRAYS * BATCH_LENGTH * sizeof(int));
+    size_t* batch_out = malloc((size_t)BATCH_ARRAYS * BATCH_LENGTH * sizeof(size_t));
+    MonotonicJob jobs[BATCH_ARRAYS];
+    if (!batch_values || !batch_out) {
+        fprintf(stderr, "allocation failed\n");
+        return EXIT_FAILURE;
+    }
+    fill_random(batch_values, (size_t)BATCH_ARRAYS * BATCH_LENGTH, 7);
+
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t max_threads = cores > 0 ? (size_t)cores : 1;
+    printf("\nBatch of %d arrays x %d values (stock span)\n", BATCH_ARRAYS, BATCH_LENGTH);
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        for (size_t j = 0; j < BATCH_ARRAYS; j++) {
+            jobs[j].kernel = MONOTONIC_STOCK_SPAN;
+            jobs[j].values = batch_values + j * BATCH_LENGTH;
+            jobs[j].count = BATCH_LENGTH;
+            jobs[j].indices = batch_out + j * BATCH_LENGTH;
+        }
+        char name[64];
+        snprintf(name, sizeof(name), "kernel batch, %zu thread(s)", threads);
+        start = bench_now();
+        monotonic_run_batch(jobs, BATCH_ARRAYS, threads);
+        bench_report(name, bench_now() - start, (double)BATCH_ARRAYS * BATCH_LENGTH);
+    }
+
+    free(batch_values);
+    free(batch_out);
+    free(values);
+    free(out);
+    return EXIT_SUCCESS;
+}
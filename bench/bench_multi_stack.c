@@ -0,0 +1,122 @@
+/**
+ * @file bench_multi_stack.c
+ * @brief Benchmark: separately allocated stacks vs one shared buffer
+ * @author Jaden Mardini
+ *
+ * Two workloads are run both ways. Short-lived requests each create an
+ * operand and an operator stack, push and pop a few values on both and
+ * destroy them; at this depth every Stack needs a separate element array.
+ * Long-lived nesting levels keep LEVELS stacks about half full in total
+ * and push and pop mostly on two of them, which makes the shared buffer
+ * reallocate; the separate stacks each reserve the whole capacity.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench_util.h"
+#include "dynamic_stack.h"
+#include "multi_stack.h"
+
+#define REQUESTS 1000000
+#define REQUEST_DEPTH 64
+#define LEVELS 8
+#define LEVEL_CAPACITY 4096
+#define LEVEL_OPERATIONS 20000000
+
+/**
+ * @brief Picks the stack for the next nesting-level operation; low levels are busiest
+ */
+static size_t pick_level(unsigned* seed) {
+    *seed = *seed * 1103515245u + 12345u;
+    unsigned bits = *seed >> 16;
+    return (bits & 3) != 0 ? (bits >> 2) % 2 : (bits >> 2) % LEVELS;
+}
+
+/**
+ * @brief Decides whether the next operation pushes, keeping the total near half the capacity
+ */
+static bool should_push(unsigned seed, size_t total) {
+    bool below_half = total < LEVEL_CAPACITY / 2;
+    return ((seed >> 8) % 3 != 0) == below_half;
+}
+
+int main(void) {
+    printf("=== Multi-Stack Benchmark ===\n\n");
+    int value;
+
+    printf("Requests with an operand and an operator stack (%d pushes each):\n", REQUEST_DEPTH);
+    double start = bench_now();
+    for (int request = 0; request < REQUESTS; request++) {
+        Stack* operands = stack_create(REQUEST_DEPTH);
+        Stack* operators = stack_create(REQUEST_DEPTH);
+        for (int i = 0; i < REQUEST_DEPTH; i++) {
+            stack_push(operands, i);
+            stack_push(operators, -i);
+        }
+        while (stack_pop(operands, &value) == STACK_SUCCESS && stack_pop(operators, &value) == STACK_SUCCESS) {
+            bench_sink += value;
+        }
+        stack_destroy(operators);
+        stack_destroy(operands);
+    }
+    bench_report("two stack_create calls", bench_now() - start, REQUESTS);
+
+    start = bench_now();
+    for (int request = 0; request < REQUESTS; request++) {
+        MultiStack* stacks = multi_stack_create(2, 2 * REQUEST_DEPTH);
+        for (int i = 0; i < REQUEST_DEPTH; i++) {
+            multi_stack_push(stacks, 0, i);
+            multi_stack_push(stacks, 1, -i);
+        }
+        while (multi_stack_pop(stacks, 0, &value) == STACK_SUCCESS &&
+               multi_stack_pop(stacks, 1, &value) == STACK_SUCCESS) {
+            bench_sink += value;
+        }
+        multi_stack_destroy(stacks);
+    }
+    bench_report("one multi_stack_create call", bench_now() - start, REQUESTS);
+
+    printf("\n%d nesting-level stacks, %d slots in total:\n", LEVELS, LEVEL_CAPACITY);
+    Stack* levels[LEVELS];
+    for (size_t i = 0; i < LEVELS; i++) {
+        levels[i] = stack_create(LEVEL_CAPACITY);
+        stack_set_wipe_policy(levels[i], STACK_WIPE_NEVER);
+    }
+    unsigned seed = 1;
+    size_t total = 0;
+    start = bench_now();
+    for (int i = 0; i < LEVEL_OPERATIONS; i++) {
+        size_t level = pick_level(&seed);
+        if (should_push(seed, total)) {
+            total += stack_push(levels[level], i) == STACK_SUCCESS;
+        } else if (stack_pop(levels[level], &value) == STACK_SUCCESS) {
+            bench_sink += value;
+            total--;
+        }
+    }
+    bench_report("separate stacks, 8x the slots", bench_now() - start, LEVEL_OPERATIONS);
+    for (size_t i = 0; i < LEVELS; i++) {
+        stack_destroy(levels[i]);
+    }
+
+    MultiStack* stacks = multi_stack_create(LEVELS, LEVEL_CAPACITY);
+    seed = 1;
+    total = 0;
+    start = bench_now();
+    for (int i = 0; i < LEVEL_OPERATIONS; i++) {
+        size_t level = pick_level(&seed);
+        if (should_push(seed, total)) {
+            total += multi_stack_push(stacks, level, i) == STACK_SUCCESS;
+        } else if (multi_stack_pop(stacks, level, &value) == STACK_SUCCESS) {
+            bench_sink += value;
+            total--;
+        }
+    }
+    bench_report("shared buffer", bench_now() - start, LEVEL_OPERATIONS);
+    multi_stack_destroy(stacks);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file bench_palindrome.c
+ * @brief Benchmark: mirror compare vs reverse-then-strcmp palindrome checks
+ * @author Jaden Mardini
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench_util.h"
+#include "palindrome.h"
+#include "static_stack.h"
+
+#define STRING_COUNT 100000
+#define MAX_STRING_LENGTH 200
+#define LONG_STRING_BYTES (16u * 1024u * 1024u)
+#define REPETITIONS 5
+
+/**
+ * @brief Fills a buffer with a palindrome, occasionally broken near the middle
+ */
+static size_t make_candidate(char* buffer, unsigned* seed) {
+    *seed = *seed * 1103515245u + 12345u;
+    size_t length = 1 + (*seed >> 16) % MAX_STRING_LENGTH;
+    for (size_t i = 0; i < (length + 1) / 2; i++) {
+        *seed = *seed * 1103515245u + 12345u;
+        buffer[i] = (char)('a' + (*seed >> 16) % 26);
+        buffer[length - 1 - i] = buffer[i];
+    }
+    if ((*seed >> 8) % 2 == 0 && length > 2) {
+        buffer[length / 2 + 1] ^= 1;
+    }
+    buffer[length] = '\0';
+    return length;
+}
+
+int main(void) {
+    char (*storage)[MAX_STRING_LENGTH + 1] = malloc(STRING_COUNT * sizeof(*storage));
+    const char** strings = malloc(STRING_COUNT * sizeof(char*));
+    size_t* lengths = malloc(STRING_COUNT * sizeof(size_t));
+    uint64_t* bitmap = malloc(PALINDROME_BITMAP_WORDS(STRING_COUNT) * sizeof(uint64_t));
+    char* text = malloc(LONG_STRING_BYTES);
+    if (!storage || !strings || !lengths || !bitmap || !text) {
+        fprintf(stderr, "allocation failed\n");
+        return EXIT_FAILURE;
+    }
+
+    unsigned seed = 42;
+    double total_bytes = 0;
+    for (size_t i = 0; i < STRING_COUNT; i++) {
+        lengths[i] = make_candidate(storage[i], &seed);
+        strings[i] = storage[i];
+        total_bytes += (double)lengths[i];
+    }
+
+    printf("=== Palindrome Benchmark ===\n");
+    printf("Batch: %d strings of 1-%d bytes, %d repetitions\n\n", STRING_COUNT, MAX_STRING_LENGTH, REPETITIONS);
+
+    double operations = (double)STRING_COUNT * REPETITIONS;
+    char reversed[MAX_STRING_LENGTH + 1];
+    double start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        for (size_t i = 0; i < STRING_COUNT; i++) {
+            char_stack_reverse_string(strings[i], reversed, sizeof(reversed));
+            bench_sink += strcmp(strings[i], reversed) == 0;
+        }
+    }
+    double elapsed = bench_now() - start;
+    bench_report("char_stack_reverse_string + strcmp", elapsed, operations);
+
+    start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        for (size_t i = 0; i < STRING_COUNT; i++) {
+            bench_sink += palindrome_check(strings[i], lengths[i], PALINDROME_EXACT);
+        }
+    }
+    elapsed = bench_now() - start;
+    bench_report("palindrome_check", elapsed, operations);
+
+    start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        palindrome_check_batch(strings, lengths, STRING_COUNT, PALINDROME_EXACT, bitmap);
+        bench_sink += (long long)bitmap[0];
+    }
+    elapsed = bench_now() - start;
+    bench_report("palindrome_check_batch", elapsed, operations);
+
+    start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        palindrome_check_batch(strings, lengths, STRING_COUNT, PALINDROME_NATURAL, bitmap);
+        bench_sink += (long long)bitmap[0];
+    }
+    elapsed = bench_now() - start;
+    bench_report("palindrome_check_batch (natural)", elapsed, operations);
+    printf("  %-40s %10.2f GB/s\n", "", total_bytes * REPETITIONS / elapsed / 1e9);
+
+    /* One long palindrome shows the streaming rate */
+    for (size_t i = 0; i < LONG_STRING_BYTES / 2; i++) {
+        text[i] = (char)('a' + i % 26);
+        text[LONG_STRING_BYTES - 1 - i] = text[i];
+    }
+    printf("\nLong string: %u bytes\n", LONG_STRING_BYTES);
+    start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        bench_sink += palindrome_check(text, LONG_STRING_BYTES, PALINDROME_FOLD_CASE);
+    }
+    elapsed = bench_now() - start;
+    bench_report("palindrome_check (fold case)", elapsed, (double)LONG_STRING_BYTES * REPETITIONS);
+    printf("  %-40s %10.2f GB/s\n", "", (double)LONG_STRING_BYTES * REPETITIONS / elapsed / 1e9);
+
+    free(storage);
+    free(strings);
+    free(lengths);
+    free(bitmap);
+    free(text);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file bench_persistent_stack.c
+ * @brief Benchmark: persistent stack snapshots vs copying an array Stack
+ * @author Jaden Mardini
+ *
+ * Models speculative work: a stack of a given depth is snapshotted, a few
+ * speculative pushes are made on the copy, and the copy is discarded. The
+ * array-based Stack has no copy primitive, so its snapshot drains the
+ * stack into a buffer and rebuilds both the original and the copy.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench_util.h"
+#include "dynamic_stack.h"
+#include "persistent_stack.h"
+
+#define SNAPSHOT_COUNT 10000
+#define SPECULATIVE_PUSHES 8
+
+/**
+ * @brief Copies an array Stack through its public API
+ */
+static Stack* copy_array_stack(Stack* source, int* scratch) {
+    size_t size = stack_size(source);
+    Stack* copy = stack_create(stack_capacity(source));
+    if (!copy) {
+        return NULL;
+    }
+
+    for (size_t i = size; i > 0; i--) {
+        stack_pop(source, &scratch[i - 1]);
+    }
+    for (size_t i = 0; i < size; i++) {
+        stack_push(source, scratch[i]);
+        stack_push(copy, scratch[i]);
+    }
+
+    return copy;
+}
+
+static double bench_array_copy(size_t depth) {
+    Stack* base = stack_create(depth + SPECULATIVE_PUSHES);
+    int* scratch = malloc(depth * sizeof(int));
+    if (!base || !scratch) {
+        fprintf(stderr, "allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < depth; i++) {
+        stack_push(base, (int)i);
+    }
+
+    double start = bench_now();
+    for (int s = 0; s < SNAPSHOT_COUNT; s++) {
+        Stack* copy = copy_array_stack(base, scratch);
+        for (int p = 0; p < SPECULATIVE_PUSHES; p++) {
+            stack_push(copy, p);
+        }
+        int top = 0;
+        stack_peek(copy, &top);
+        bench_sink += top;
+        stack_destroy(copy);
+    }
+    double elapsed = bench_now() - start;
+
+    free(scratch);
+    stack_destroy(base);
+    return elapsed;
+}
+
+static double bench_persistent(size_t depth) {
+    PersistentStackPool* pool = persistent_stack_pool_create();
+    PersistentStack base;
+    if (!pool || persistent_stack_init(&base, pool) != STACK_SUCCESS) {
+        fprintf(stderr, "allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < depth; i++) {
+        persistent_stack_push(&base, (int)i);
+    }
+
+    double start = bench_now();
+    for (int s = 0; s < SNAPSHOT_COUNT; s++) {
+        PersistentStack copy;
+        persistent_stack_snapshot(&base, &copy);
+        for (int p = 0; p < SPECULATIVE_PUSHES; p++) {
+            persistent_stack_push(&copy, p);
+        }
+        int top = 0;
+        persistent_stack_peek(&copy, &top);
+        bench_sink += top;
+        persistent_stack_release(&copy);
+    }
+    double elapsed = bench_now() - start;
+
+    persistent_stack_release(&base);
+    persistent_stack_pool_destroy(pool);
+    return elapsed;
+}
+
+int main(void) {
+    static const size_t depths[] = {16, 256, 4096};
+
+    printf("=== Persistent Stack Snapshot Benchmark ===\n");
+    printf("%d snapshots, %d speculative pushes each\n", SNAPSHOT_COUNT, SPECULATIVE_PUSHES);
+
+    for (size_t i = 0; i < sizeof(depths) / sizeof(depths[0]); i++) {
+        printf("\nDepth %zu:\n", depths[i]);
+        bench_report("array Stack copy", bench_array_copy(depths[i]), SNAPSHOT_COUNT);
+        bench_report("persistent snapshot", bench_persistent(depths[i]), SNAPSHOT_COUNT);
+    }
+
+    return EXIT_SUCCESS;
+}
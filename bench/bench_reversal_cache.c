@@ -0,0 +1,130 @@
+/**
+ * @file bench_reversal_cache.c
+ * @brief Benchmark: reversal cache vs recomputing each reversal
+ * @author Jaden Mardini
+ *
+ * Requests draw keys from a Zipf distribution, so a few keys repeat
+ * constantly and most are rare. Each input length is reversed three ways:
+ * through char_stack_reverse_string(), which pushes and pops every
+ * character, through the SIMD reversal of a reversed view, and through a
+ * cache that holds about a fifth of the keys. The crossover is the
+ * shortest length at which the cache beats a given recomputation.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench_util.h"
+#include "reversal_cache.h"
+#include "reversed_view.h"
+#include "static_stack.h"
+
+#define KEY_COUNT 4096
+#define REQUEST_COUNT 200000
+
+/**
+ * @brief Draws request key indices from a Zipf distribution (exponent 1) over KEY_COUNT keys
+ */
+static void make_requests(int* requests) {
+    static double cumulative[KEY_COUNT];
+    double total = 0.0;
+    for (int k = 0; k < KEY_COUNT; k++) {
+        total += 1.0 / (k + 1);
+        cumulative[k] = total;
+    }
+
+    unsigned seed = 12345;
+    for (int r = 0; r < REQUEST_COUNT; r++) {
+        seed = seed * 1103515245u + 12345u;
+        double pick = (double)(seed >> 8) / (double)(1u << 24) * total;
+        int low = 0;
+        int high = KEY_COUNT - 1;
+        while (low < high) {
+            int middle = (low + high) / 2;
+            if (cumulative[middle] < pick) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        requests[r] = low;
+    }
+}
+
+/**
+ * @brief Runs the three reversal strategies for one key length
+ */
+static void run_length(size_t length, const int* requests) {
+    char* keys = malloc(KEY_COUNT * (length + 1));
+    if (!keys) {
+        fprintf(stderr, "allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int k = 0; k < KEY_COUNT; k++) {
+        char* key = keys + (size_t)k * (length + 1);
+        for (size_t i = 0; i < length; i++) {
+            key[i] = (char)('a' + (k * 31 + (int)i * 7) % 26);
+        }
+        /* A decimal prefix keeps the keys distinct */
+        int number = k;
+        for (size_t i = length < 8 ? length : 8; i > 0; i--) {
+            key[i - 1] = (char)('0' + number % 10);
+            number /= 10;
+        }
+        key[length] = '\0';
+    }
+
+    char output[512];
+    printf("%zu-byte keys:\n", length);
+
+    double start = bench_now();
+    for (int r = 0; r < REQUEST_COUNT; r++) {
+        char_stack_reverse_string(keys + (size_t)requests[r] * (length + 1), output, sizeof(output));
+        bench_sink += output[0];
+    }
+    double stack = bench_now() - start;
+
+    start = bench_now();
+    for (int r = 0; r < REQUEST_COUNT; r++) {
+        reversed_view_copy(reversed_view_make(keys + (size_t)requests[r] * (length + 1), length), output,
+                           sizeof(output));
+        bench_sink += output[0];
+    }
+    double simd = bench_now() - start;
+
+    /* Budget for about a fifth of the keys, with per-entry overhead */
+    ReversalCache* cache = reversal_cache_create(KEY_COUNT / 5 * (2 * length + 80), 0);
+    start = bench_now();
+    for (int r = 0; r < REQUEST_COUNT; r++) {
+        reversal_cache_reverse(cache, keys + (size_t)requests[r] * (length + 1), length, output, sizeof(output));
+        bench_sink += output[0];
+    }
+    double cached = bench_now() - start;
+    ReversalCacheStats stats;
+    reversal_cache_stats(cache, &stats);
+    reversal_cache_destroy(cache);
+
+    bench_report("char_stack_reverse_string", stack, REQUEST_COUNT);
+    bench_report("SIMD reversal", simd, REQUEST_COUNT);
+    bench_report("reversal cache", cached, REQUEST_COUNT);
+    printf("  %-40s %9.1f%% hits, %.2fx vs stack, %.2fx vs SIMD\n\n", "",
+           100.0 * (double)stats.hits / (double)(stats.hits + stats.misses), stack / cached, simd / cached);
+
+    free(keys);
+}
+
+int main(void) {
+    static int requests[REQUEST_COUNT];
+    make_requests(requests);
+
+    printf("=== Reversal Cache Benchmark ===\n");
+    printf("%d requests over %d Zipf-distributed keys\n\n", REQUEST_COUNT, KEY_COUNT);
+
+    size_t lengths[] = { 4, 8, 16, 32, 64, 128, 255 };
+    for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        run_length(lengths[i], requests);
+    }
+
+    return EXIT_SUCCESS;
+}
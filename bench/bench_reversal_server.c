@@ -0,0 +1,299 @@
+/**
+ * @file bench_reversal_server.c
+ * @brief Load generator for the local reversal service
+ * @author Jaden Mardini
+ *
+ * Each client thread opens one connection and sends its requests in
+ * pipelined batches: a batch is one iovec array with a header and a body
+ * entry per request, handed to writev() as the socket accepts it, while
+ * the thread reads the responses, stamping each one as its last byte
+ * arrives, and checks every body.
+ * Latency is measured from the batch send to the arrival of each
+ * response, so it includes the time spent queued behind earlier requests
+ * of the same batch. Without --socket the benchmark starts its own server
+ * in the same process.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "reversal_server.h"
+
+/* Largest batch; two iovecs per request must stay within IOV_MAX */
+#define MAX_PIPELINE 512
+
+/* Load parameters */
+typedef struct {
+    const char* socket_path;
+    int connections;
+    int requests;               /* Per connection */
+    int pipeline;
+    size_t size;
+} LoadConfig;
+
+/* State of one client thread */
+typedef struct {
+    const LoadConfig* config;
+    pthread_t thread;
+    double* latencies;          /* Seconds, one per request */
+    bool failed;
+} Client;
+
+/**
+ * @brief Writes as much of an iovec array as the socket takes, advancing past what was sent
+ * @return false on a socket error
+ */
+static bool write_some(int fd, struct iovec** iov, int* count) {
+    ssize_t written = writev(fd, *iov, *count);
+    if (written < 0) {
+        return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+    }
+    while (*count > 0 && (size_t)written >= (*iov)->iov_len) {
+        written -= (ssize_t)(*iov)->iov_len;
+        (*iov)++;
+        (*count)--;
+    }
+    if (*count > 0) {
+        (*iov)->iov_base = (char*)(*iov)->iov_base + written;
+        (*iov)->iov_len -= (size_t)written;
+    }
+    return true;
+}
+
+/**
+ * @brief Connects and sends a client's requests, recording each latency
+ * @return false on a connection error or a wrong response
+ */
+static bool run_connection(Client* client, const unsigned char* header, const char* body,
+                           const char* expected, char* responses, struct iovec* iov) {
+    const LoadConfig* config = client->config;
+    size_t frame = REVERSAL_SERVER_HEADER_SIZE + config->size;
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return false;
+    }
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, config->socket_path, sizeof(address.sun_path) - 1);
+    if (connect(fd, (const struct sockaddr*)&address, sizeof(address)) != 0 ||
+        fcntl(fd, F_SETFL, O_NONBLOCK) != 0) {
+        close(fd);
+        return false;
+    }
+
+    bool ok = true;
+    for (int done = 0; done < config->requests && ok; ) {
+        int batch = config->requests - done < config->pipeline ? config->requests - done : config->pipeline;
+        for (int r = 0; r < batch; r++) {
+            iov[2 * r].iov_base = (void*)header;
+            iov[2 * r].iov_len = REVERSAL_SERVER_HEADER_SIZE;
+            iov[2 * r + 1].iov_base = (void*)body;
+            iov[2 * r + 1].iov_len = config->size;
+        }
+
+        /* Read while still writing: the server stops reading while its responses back up */
+        struct iovec* pending = iov;
+        int pending_count = 2 * batch;
+        size_t total = frame * (size_t)batch;
+        size_t received = 0;
+        int answered = 0;
+        double sent = bench_now();
+        while (received < total) {
+            struct pollfd ready = { fd, (short)(POLLIN | (pending_count > 0 ? POLLOUT : 0)), 0 };
+            if (poll(&ready, 1, -1) < 0) {
+                continue;
+            }
+            if ((ready.revents & POLLOUT) && !write_some(fd, &pending, &pending_count)) {
+                ok = false;
+                break;
+            }
+            if (!(ready.revents & (POLLIN | POLLHUP | POLLERR))) {
+                continue;
+            }
+            ssize_t n = read(fd, responses + received, total - received);
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+                continue;
+            }
+            if (n <= 0) {
+                ok = false;
+                break;
+            }
+            received += (size_t)n;
+            double now = bench_now();
+            for (; answered < (int)(received / frame); answered++) {
+                client->latencies[done + answered] = now - sent;
+            }
+        }
+
+        for (int r = 0; r < answered; r++) {
+            const char* response = responses + frame * (size_t)r;
+            if (memcmp(response, header, REVERSAL_SERVER_HEADER_SIZE) != 0 ||
+                memcmp(response + REVERSAL_SERVER_HEADER_SIZE, expected, config->size) != 0) {
+                ok = false;
+            }
+        }
+        done += batch;
+    }
+
+    close(fd);
+    return ok;
+}
+
+/**
+ * @brief Runs one connection's share of the load
+ */
+static void* client_main(void* argument) {
+    Client* client = argument;
+    const LoadConfig* config = client->config;
+
+    unsigned char header[REVERSAL_SERVER_HEADER_SIZE] = {
+        (unsigned char)(config->size >> 24), (unsigned char)(config->size >> 16),
+        (unsigned char)(config->size >> 8), (unsigned char)config->size
+    };
+    char* body = malloc(config->size + 1);
+    char* expected = malloc(config->size + 1);
+    char* responses = malloc((REVERSAL_SERVER_HEADER_SIZE + config->size) * (size_t)config->pipeline);
+    struct iovec* iov = malloc(sizeof(struct iovec) * 2 * (size_t)config->pipeline);
+
+    if (body && expected && responses && iov) {
+        for (size_t i = 0; i < config->size; i++) {
+            body[i] = (char)('a' + i % 26);
+            expected[config->size - 1 - i] = body[i];
+        }
+        client->failed = !run_connection(client, header, body, expected, responses, iov);
+    } else {
+        client->failed = true;
+    }
+
+    free(body);
+    free(expected);
+    free(responses);
+    free(iov);
+    return NULL;
+}
+
+/**
+ * @brief Orders latencies for percentile lookup
+ */
+static int compare_doubles(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Prints command-line usage
+ */
+static void print_usage(const char* program) {
+    printf("Usage: %s [--socket=PATH] [--connections=N] [--requests=N] [--pipeline=N] [--size=BYTES]\n",
+           program);
+    printf("  --socket=PATH      Use a running server (default: start one in-process)\n");
+    printf("  --connections=N    Concurrent client connections (default: 4)\n");
+    printf("  --requests=N       Requests per connection (default: 20000)\n");
+    printf("  --pipeline=N       Requests in flight per connection, at most %d (default: 16)\n", MAX_PIPELINE);
+    printf("  --size=BYTES       Request body size (default: 64)\n");
+}
+
+int main(int argc, char* argv[]) {
+    LoadConfig config = { NULL, 4, 20000, 16, 64 };
+
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--socket=", 9) == 0) {
+            config.socket_path = argv[i] + 9;
+        } else if (strncmp(argv[i], "--connections=", 14) == 0) {
+            config.connections = atoi(argv[i] + 14);
+        } else if (strncmp(argv[i], "--requests=", 11) == 0) {
+            config.requests = atoi(argv[i] + 11);
+        } else if (strncmp(argv[i], "--pipeline=", 11) == 0) {
+            config.pipeline = atoi(argv[i] + 11);
+        } else if (strncmp(argv[i], "--size=", 7) == 0) {
+            config.size = (size_t)atol(argv[i] + 7);
+        } else {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (config.connections <= 0 || config.requests <= 0 || config.pipeline <= 0 ||
+        config.pipeline > MAX_PIPELINE || config.size > REVERSAL_SERVER_DEFAULT_MAX_REQUEST) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    /* Start an in-process server unless one was given */
+    char own_path[64];
+    ReversalServer* server = NULL;
+    if (!config.socket_path) {
+        snprintf(own_path, sizeof(own_path), "/tmp/reversal-bench-%ld.sock", (long)getpid());
+        ReversalServerOptions options;
+        reversal_server_options_init(&options);
+        options.socket_path = own_path;
+        ReversalServerResult result = reversal_server_start(&options, &server);
+        if (result != REVERSAL_SERVER_SUCCESS) {
+            fprintf(stderr, "server: %s\n", reversal_server_error_string(result));
+            return EXIT_FAILURE;
+        }
+        config.socket_path = own_path;
+    }
+
+    size_t total = (size_t)config.connections * (size_t)config.requests;
+    double* latencies = malloc(total * sizeof(double));
+    Client* clients = calloc((size_t)config.connections, sizeof(Client));
+    if (!latencies || !clients) {
+        fprintf(stderr, "allocation failed\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("=== Reversal Server Load Test ===\n");
+    printf("%d connections x %d requests of %zu bytes, pipeline depth %d\n\n",
+           config.connections, config.requests, config.size, config.pipeline);
+
+    double start = bench_now();
+    for (int c = 0; c < config.connections; c++) {
+        clients[c].config = &config;
+        clients[c].latencies = latencies + (size_t)c * (size_t)config.requests;
+        if (pthread_create(&clients[c].thread, NULL, client_main, &clients[c]) != 0) {
+            fprintf(stderr, "thread creation failed\n");
+            return EXIT_FAILURE;
+        }
+    }
+    bool failed = false;
+    for (int c = 0; c < config.connections; c++) {
+        pthread_join(clients[c].thread, NULL);
+        failed |= clients[c].failed;
+    }
+    double elapsed = bench_now() - start;
+
+    reversal_server_stop(server);
+
+    if (failed) {
+        fprintf(stderr, "a connection failed or returned a wrong reversal\n");
+        free(latencies);
+        free(clients);
+        return EXIT_FAILURE;
+    }
+
+    qsort(latencies, total, sizeof(double), compare_doubles);
+    bench_report("pipelined requests", elapsed, (double)total);
+    printf("  %-40s %10.0f req/s  %9.1f MB/s\n", "throughput", (double)total / elapsed,
+           (double)total * (double)config.size / elapsed / 1e6);
+    printf("  %-40s %10.1f us p50  %9.1f us p99\n", "latency",
+           latencies[total / 2] * 1e6, latencies[total * 99 / 100] * 1e6);
+
+    free(latencies);
+    free(clients);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file bench_reverse_transform.c
+ * @brief Benchmark: fused reverse-and-transform vs reverse then transform
+ * @author Jaden Mardini
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench_util.h"
+#include "reverse_transform.h"
+#include "static_stack.h"
+
+#define BUFFER_BYTES (16u * 1024u * 1024u)
+#define SHORT_STRING_COUNT 100000
+#define REPETITIONS 5
+
+/**
+ * @brief Plain byte-at-a-time reversal, the first of two passes
+ */
+static void reverse_pass(const char* input, size_t length, char* output) {
+    for (size_t i = 0; i < length; i++) {
+        output[i] = input[length - 1 - i];
+    }
+    output[length] = '\0';
+}
+
+/**
+ * @brief Times one fused transform against reversal followed by a second pass
+ */
+static void compare(const char* name, const char* input, char* output, ReverseTransformKind kind) {
+    char label[64];
+    ReverseTransform transform = { kind, '?', NULL };
+
+    double start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        reverse_pass(input, BUFFER_BYTES, output);
+        size_t kept = 0;
+        for (size_t i = 0; i < BUFFER_BYTES; i++) {
+            unsigned char c = (unsigned char)output[i];
+            if (kind == REVERSE_TRANSFORM_UPPER) {
+                output[i] = (char)toupper(c);
+            } else if (isprint(c) || c == '\t') {
+                output[kept++] = (char)c;
+            }
+        }
+        bench_sink += output[0];
+    }
+    double elapsed = bench_now() - start;
+    snprintf(label, sizeof(label), "reverse, then %s pass", name);
+    bench_report(label, elapsed, (double)BUFFER_BYTES * REPETITIONS);
+    printf("  %-40s %10.2f GB/s\n", "", (double)BUFFER_BYTES * REPETITIONS / elapsed / 1e9);
+
+    start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        reverse_transform(input, BUFFER_BYTES, output, BUFFER_BYTES + 1, &transform, NULL);
+        bench_sink += output[0];
+    }
+    elapsed = bench_now() - start;
+    snprintf(label, sizeof(label), "reverse_transform (%s)", name);
+    bench_report(label, elapsed, (double)BUFFER_BYTES * REPETITIONS);
+    printf("  %-40s %10.2f GB/s\n", "", (double)BUFFER_BYTES * REPETITIONS / elapsed / 1e9);
+}
+
+int main(void) {
+    char* input = malloc(BUFFER_BYTES);
+    char* output = malloc(BUFFER_BYTES + 1);
+    if (!input || !output) {
+        fprintf(stderr, "allocation failed\n");
+        return EXIT_FAILURE;
+    }
+
+    /* Mixed-case text with a rare control byte */
+    unsigned seed = 3;
+    for (size_t i = 0; i < BUFFER_BYTES; i++) {
+        seed = seed * 1103515245u + 12345u;
+        unsigned r = seed >> 16;
+        input[i] = r % 997 == 0 ? '\x07' : r % 7 == 0 ? ' ' : (char)((r % 2 ? 'a' : 'A') + r % 26);
+    }
+
+    printf("=== Fused Reverse-and-Transform Benchmark ===\n");
+    printf("Buffer: %u bytes, %d repetitions\n\n", BUFFER_BYTES, REPETITIONS);
+    compare("upper", input, output, REVERSE_TRANSFORM_UPPER);
+    compare("filter", input, output, REVERSE_TRANSFORM_FILTER);
+
+    /* Short strings through the character stack, then an upper-case pass */
+    printf("\nShort strings: %d of 100 bytes\n", SHORT_STRING_COUNT);
+    char line[101];
+    char reversed[CHAR_STACK_MAX_SIZE];
+    memcpy(line, input, 100);
+    line[100] = '\0';
+    for (size_t i = 0; i < 100; i++) {
+        line[i] = line[i] == '\x07' ? 'x' : line[i];
+    }
+
+    double start = bench_now();
+    for (int i = 0; i < SHORT_STRING_COUNT; i++) {
+        char_stack_reverse_string(line, reversed, sizeof(reversed));
+        for (char* p = reversed; *p; p++) {
+            *p = (char)toupper((unsigned char)*p);
+        }
+        bench_sink += reversed[0];
+    }
+    double elapsed = bench_now() - start;
+    bench_report("char_stack_reverse_string + toupper", elapsed, SHORT_STRING_COUNT);
+
+    ReverseTransform upper = { REVERSE_TRANSFORM_UPPER, 0, NULL };
+    start = bench_now();
+    for (int i = 0; i < SHORT_STRING_COUNT; i++) {
+        reverse_transform(line, 100, reversed, sizeof(reversed), &upper, NULL);
+        bench_sink += reversed[0];
+    }
+    elapsed = bench_now() - start;
+    bench_report("reverse_transform (upper)", elapsed, SHORT_STRING_COUNT);
+
+    free(input);
+    free(output);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file bench_reversed_view.c
+ * @brief Benchmark: reversed view vs materializing the reversal first
+ * @author Jaden Mardini
+ *
+ * Each consumer reads the reversed string once: hashing it, comparing it
+ * with a reference, and writing it to /dev/null. The materializing side
+ * reverses into a full-size output buffer and then consumes that buffer;
+ * the view side consumes the view directly.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "reverse_transform.h"
+#include "reversed_view.h"
+
+/* Bytes each consumer processes per input length */
+#define BYTES_PER_CONSUMER (64u << 20)
+
+/**
+ * @brief FNV-1a over a materialized buffer, matching reversed_view_hash()
+ */
+static uint64_t hash_buffer(const char* data, size_t length) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ (unsigned char)data[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief Runs the three consumers over one input length
+ */
+static void run_length(size_t length, int null_fd) {
+    char* input = malloc(length);
+    char* output = malloc(length + 1);
+    char* reference = malloc(length + 1);
+    if (!input || !output || !reference) {
+        fprintf(stderr, "allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < length; i++) {
+        input[i] = (char)('a' + (i * 7) % 26);
+    }
+    reverse_transform(input, length, reference, length + 1, NULL, NULL);
+    ReversedView view = reversed_view_make(input, length);
+    int iterations = (int)(BYTES_PER_CONSUMER / length);
+    double bytes = (double)length * iterations;
+
+    printf("%zu bytes:\n", length);
+
+    double start = bench_now();
+    for (int i = 0; i < iterations; i++) {
+        reverse_transform(input, length, output, length + 1, NULL, NULL);
+        bench_sink += (long long)hash_buffer(output, length);
+    }
+    double materialized = bench_now() - start;
+    start = bench_now();
+    for (int i = 0; i < iterations; i++) {
+        bench_sink += (long long)reversed_view_hash(view);
+    }
+    double viewed = bench_now() - start;
+    bench_report("hash: reverse + hash", materialized, bytes);
+    bench_report("hash: view", viewed, bytes);
+
+    start = bench_now();
+    for (int i = 0; i < iterations; i++) {
+        reverse_transform(input, length, output, length + 1, NULL, NULL);
+        bench_sink += memcmp(output, reference, length);
+    }
+    materialized = bench_now() - start;
+    start = bench_now();
+    for (int i = 0; i < iterations; i++) {
+        bench_sink += reversed_view_compare(view, reference, length);
+    }
+    viewed = bench_now() - start;
+    bench_report("compare: reverse + memcmp", materialized, bytes);
+    bench_report("compare: view", viewed, bytes);
+    printf("  %-40s %10.2f GB/s vs %.2f GB/s\n", "", bytes / viewed / 1e9, bytes / materialized / 1e9);
+
+    start = bench_now();
+    for (int i = 0; i < iterations; i++) {
+        reverse_transform(input, length, output, length + 1, NULL, NULL);
+        bench_sink += write(null_fd, output, length);
+    }
+    materialized = bench_now() - start;
+    start = bench_now();
+    for (int i = 0; i < iterations; i++) {
+        bench_sink += reversed_view_write_fd(view, null_fd);
+    }
+    viewed = bench_now() - start;
+    bench_report("write: reverse + write", materialized, bytes);
+    bench_report("write: view", viewed, bytes);
+    printf("\n");
+
+    free(input);
+    free(output);
+    free(reference);
+}
+
+int main(void) {
+    int null_fd = open("/dev/null", O_WRONLY);
+    if (null_fd < 0) {
+        perror("/dev/null");
+        return EXIT_FAILURE;
+    }
+
+    printf("=== Reversed View Benchmark ===\n");
+    printf("%u MiB per consumer, ns/op is per byte\n\n", BYTES_PER_CONSUMER >> 20);
+
+    run_length(4096, null_fd);
+    run_length(1u << 20, null_fd);
+    run_length(16u << 20, null_fd);
+
+    close(null_fd);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file bench_sharded_stack.c
+ * @brief Benchmark: sharded stack vs one mutex-guarded Stack as a shared free list
+ * @author Jaden Mardini
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "dynamic_stack.h"
+#include "sharded_stack.h"
+
+#define MAX_THREADS 64
+#define OPERATIONS_PER_THREAD 200000
+#define ITEMS_PER_THREAD 64
+
+/* Shared state for one run */
+typedef struct {
+    ShardedStack* sharded;
+    Stack* locked;
+    pthread_mutex_t lock;
+} FreeList;
+
+/**
+ * @brief Recycles items from the sharded stack: pop one, use it, push it back
+ */
+static void* sharded_worker(void* argument) {
+    FreeList* list = argument;
+    long long sum = 0;
+    for (int i = 0; i < ITEMS_PER_THREAD; i++) {
+        sharded_stack_push(list->sharded, i);
+    }
+    for (int i = 0; i < OPERATIONS_PER_THREAD; i++) {
+        int item;
+        if (sharded_stack_pop(list->sharded, &item) == STACK_SUCCESS) {
+            sum += item;
+            sharded_stack_push(list->sharded, item);
+        }
+    }
+    bench_sink += sum;
+    return NULL;
+}
+
+/**
+ * @brief Same recycling loop against one Stack behind a mutex
+ */
+static void* locked_worker(void* argument) {
+    FreeList* list = argument;
+    long long sum = 0;
+    pthread_mutex_lock(&list->lock);
+    for (int i = 0; i < ITEMS_PER_THREAD; i++) {
+        stack_push(list->locked, i);
+    }
+    pthread_mutex_unlock(&list->lock);
+    for (int i = 0; i < OPERATIONS_PER_THREAD; i++) {
+        int item;
+        pthread_mutex_lock(&list->lock);
+        StackResult result = stack_pop(list->locked, &item);
+        pthread_mutex_unlock(&list->lock);
+        if (result == STACK_SUCCESS) {
+            sum += item;
+            pthread_mutex_lock(&list->lock);
+            stack_push(list->locked, item);
+            pthread_mutex_unlock(&list->lock);
+        }
+    }
+    bench_sink += sum;
+    return NULL;
+}
+
+/**
+ * @brief Runs worker on thread_count threads and returns the elapsed time
+ */
+static double run_threads(void* (*worker)(void*), FreeList* list, int thread_count) {
+    pthread_t threads[MAX_THREADS];
+    double start = bench_now();
+    for (int t = 0; t < thread_count; t++) {
+        pthread_create(&threads[t], NULL, worker, list);
+    }
+    for (int t = 0; t < thread_count; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    return bench_now() - start;
+}
+
+int main(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    printf("=== Sharded Stack Benchmark ===\n");
+    printf("Free-list recycling, %d pop+push pairs per thread, %ld online CPUs\n\n",
+           OPERATIONS_PER_THREAD, cpus);
+    printf("  %7s %18s %18s %9s %9s\n", "threads", "locked Mops/s", "sharded Mops/s", "ratio", "steals");
+
+    for (int threads = 1; threads <= MAX_THREADS; threads *= 2) {
+        double operations = 2.0 * OPERATIONS_PER_THREAD * threads;
+
+        FreeList list;
+        list.locked = stack_create((size_t)ITEMS_PER_THREAD * MAX_THREADS);
+        pthread_mutex_init(&list.lock, NULL);
+        double locked = run_threads(locked_worker, &list, threads);
+        stack_destroy(list.locked);
+        pthread_mutex_destroy(&list.lock);
+
+        list.sharded = sharded_stack_create((size_t)threads, (size_t)ITEMS_PER_THREAD * 2);
+        double sharded = run_threads(sharded_worker, &list, threads);
+        size_t steals = sharded_stack_steal_count(list.sharded);
+        sharded_stack_destroy(list.sharded);
+
+        printf("  %7d %18.1f %18.1f %8.2fx %9zu\n", threads, operations / locked / 1e6,
+               operations / sharded / 1e6, locked / sharded, steals);
+    }
+
+    return EXIT_SUCCESS;
+}
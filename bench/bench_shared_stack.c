@@ -0,0 +1,165 @@
+/**
+ * @file bench_shared_stack.c
+ * @brief Benchmark: shared-memory stack vs pipe handoff between processes
+ * @author Jaden Mardini
+ *
+ * A forked producer hands ITEMS integers to the parent, which consumes
+ * and checks them. Over a pipe each item is either written on its own,
+ * as a work item serialized per message would be, or batched into large
+ * writes. Through the shared stack the producer pushes and the consumer
+ * pops directly; either side yields the CPU while the stack is full or
+ * empty.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "shared_stack.h"
+
+#define ITEMS 1000000
+#define PIPE_BATCH 1024
+#define STACK_CAPACITY 4096
+
+/* Sum every item 0..ITEMS-1 handed over must add up to */
+#define EXPECTED_SUM ((long long)ITEMS * (ITEMS - 1) / 2)
+
+/**
+ * @brief Reads exactly length bytes from a pipe
+ */
+static void read_full(int fd, void* buffer, size_t length) {
+    char* bytes = buffer;
+    while (length > 0) {
+        ssize_t n = read(fd, bytes, length);
+        if (n <= 0) {
+            fprintf(stderr, "pipe read failed\n");
+            exit(EXIT_FAILURE);
+        }
+        bytes += n;
+        length -= (size_t)n;
+    }
+}
+
+/**
+ * @brief Writes exactly length bytes to a pipe
+ */
+static void write_full(int fd, const void* buffer, size_t length) {
+    const char* bytes = buffer;
+    while (length > 0) {
+        ssize_t n = write(fd, bytes, length);
+        if (n <= 0) {
+            _exit(EXIT_FAILURE);
+        }
+        bytes += n;
+        length -= (size_t)n;
+    }
+}
+
+/**
+ * @brief Hands ITEMS integers over a pipe, batch at a time
+ */
+static double run_pipe(int batch) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        perror("pipe");
+        exit(EXIT_FAILURE);
+    }
+
+    double start = bench_now();
+    pid_t producer = fork();
+    if (producer == 0) {
+        close(fds[0]);
+        int items[PIPE_BATCH];
+        for (int i = 0; i < ITEMS; i += batch) {
+            int count = ITEMS - i < batch ? ITEMS - i : batch;
+            for (int j = 0; j < count; j++) {
+                items[j] = i + j;
+            }
+            write_full(fds[1], items, (size_t)count * sizeof(int));
+        }
+        _exit(EXIT_SUCCESS);
+    }
+    close(fds[1]);
+
+    long long sum = 0;
+    int items[PIPE_BATCH];
+    for (int i = 0; i < ITEMS; i += batch) {
+        int count = ITEMS - i < batch ? ITEMS - i : batch;
+        read_full(fds[0], items, (size_t)count * sizeof(int));
+        for (int j = 0; j < count; j++) {
+            sum += items[j];
+        }
+    }
+    double elapsed = bench_now() - start;
+
+    close(fds[0]);
+    waitpid(producer, NULL, 0);
+    if (sum != EXPECTED_SUM) {
+        fprintf(stderr, "pipe handoff lost items\n");
+        exit(EXIT_FAILURE);
+    }
+    return elapsed;
+}
+
+/**
+ * @brief Hands ITEMS integers through a shared stack
+ */
+static double run_shared_stack(void) {
+    char name[64];
+    snprintf(name, sizeof(name), "/bench-shared-stack-%ld", (long)getpid());
+    SharedStack* stack = shared_stack_create(name, STACK_CAPACITY);
+    if (!stack) {
+        fprintf(stderr, "shared stack creation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    double start = bench_now();
+    pid_t producer = fork();
+    if (producer == 0) {
+        SharedStack* attached = shared_stack_attach(name);
+        if (!attached) {
+            _exit(EXIT_FAILURE);
+        }
+        for (int i = 0; i < ITEMS; i++) {
+            while (shared_stack_push(attached, i) != STACK_SUCCESS) {
+                sched_yield();
+            }
+        }
+        shared_stack_detach(attached);
+        _exit(EXIT_SUCCESS);
+    }
+
+    long long sum = 0;
+    for (int i = 0; i < ITEMS; i++) {
+        int value;
+        while (shared_stack_pop(stack, &value) != STACK_SUCCESS) {
+            sched_yield();
+        }
+        sum += value;
+    }
+    double elapsed = bench_now() - start;
+
+    waitpid(producer, NULL, 0);
+    shared_stack_detach(stack);
+    shared_stack_unlink(name);
+    if (sum != EXPECTED_SUM) {
+        fprintf(stderr, "shared stack handoff lost items\n");
+        exit(EXIT_FAILURE);
+    }
+    return elapsed;
+}
+
+int main(void) {
+    printf("=== Shared Stack Benchmark ===\n");
+    printf("%d integers from a forked producer to the parent\n\n", ITEMS);
+
+    bench_report("pipe, one write per item", run_pipe(1), ITEMS);
+    bench_report("pipe, batches of 1024", run_pipe(PIPE_BATCH), ITEMS);
+    bench_report("shared stack push/pop", run_shared_stack(), ITEMS);
+
+    return EXIT_SUCCESS;
+}
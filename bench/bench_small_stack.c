@@ -0,0 +1,63 @@
+/**
+ * @file bench_small_stack.c
+ * @brief Benchmark: small-stack create/push/pop/destroy cycle
+ * @author Jaden Mardini
+ *
+ * Built twice by the Makefile: bench_small_stack links the default
+ * dynamic_stack.o with inline storage, and bench_small_stack_heap links a
+ * copy compiled with STACK_INLINE_CAPACITY=0 for comparison. Each size is
+ * run with the capacity equal to the elements pushed, and with
+ * STACK_DEFAULT_CAPACITY holding only that many elements.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench_util.h"
+#include "dynamic_stack.h"
+
+#define CYCLES 2000000
+
+/**
+ * @brief Runs CYCLES create/push/pop/destroy cycles
+ * @return Elapsed seconds
+ */
+static double run_cycles(size_t capacity, size_t size) {
+    double start = bench_now();
+    for (int c = 0; c < CYCLES; c++) {
+        Stack* stack = stack_create(capacity);
+        for (size_t i = 0; i < size; i++) {
+            stack_push(stack, (int)i);
+        }
+        int value = 0;
+        while (stack_pop(stack, &value) == STACK_SUCCESS) {
+            bench_sink += value;
+        }
+        stack_destroy(stack);
+    }
+    return bench_now() - start;
+}
+
+int main(int argc, char* argv[]) {
+    static const size_t sizes[] = {4, 8, 16, 32};
+    (void)argc;
+
+    printf("=== Small Stack Cycle Benchmark (%s) ===\n", argv[0]);
+    printf("%d create/push/pop/destroy cycles per size\n\n", CYCLES);
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t size = sizes[s];
+        char name[64];
+        snprintf(name, sizeof(name), "capacity %zu cycle", size);
+        bench_report(name, run_cycles(size, size), CYCLES);
+    }
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t size = sizes[s];
+        char name[64];
+        snprintf(name, sizeof(name), "capacity %d holding %zu cycle", STACK_DEFAULT_CAPACITY, size);
+        bench_report(name, run_cycles(STACK_DEFAULT_CAPACITY, size), CYCLES);
+    }
+    
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file bench_spill_stack.c
+ * @brief Benchmark: spill stack vs the int Stack, within and beyond its memory budget
+ * @author Jaden Mardini
+ *
+ * The first workload stays within STACK_MAX_CAPACITY and the spill
+ * stack's budget, so it compares the hot paths alone. The second pushes
+ * sixteen times the budget, which a Stack cannot hold at all, and drains
+ * it again; the prefetch counters show how often a pop found the next
+ * spilled segment already read back.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench_util.h"
+#include "dynamic_stack.h"
+#include "spill_stack.h"
+
+#define IN_MEMORY_DEPTH 1000000
+#define IN_MEMORY_ROUNDS 20
+#define BUDGET_BYTES (8u * 1024u * 1024u)
+#define SPILL_DEPTH (16u * BUDGET_BYTES / sizeof(int))
+
+/**
+ * @brief Fills and drains an int Stack
+ */
+static double run_stack(void) {
+    Stack* stack = stack_create(IN_MEMORY_DEPTH);
+    stack_set_wipe_policy(stack, STACK_WIPE_NEVER);
+    long long sum = 0;
+
+    double start = bench_now();
+    for (int round = 0; round < IN_MEMORY_ROUNDS; round++) {
+        for (int i = 0; i < IN_MEMORY_DEPTH; i++) {
+            stack_push(stack, i);
+        }
+        int value;
+        while (stack_pop(stack, &value) == STACK_SUCCESS) {
+            sum += value;
+        }
+    }
+    double elapsed = bench_now() - start;
+
+    bench_sink += sum;
+    stack_destroy(stack);
+    return elapsed;
+}
+
+/**
+ * @brief Fills and drains a spill stack depth values deep, rounds times
+ */
+static double run_spill(size_t depth, int rounds, SpillStackStats* stats) {
+    SpillStack* stack = spill_stack_create(BUDGET_BYTES, NULL);
+    if (!stack) {
+        fprintf(stderr, "spill stack creation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    long long sum = 0;
+
+    double start = bench_now();
+    for (int round = 0; round < rounds; round++) {
+        for (size_t i = 0; i < depth; i++) {
+            if (spill_stack_push(stack, (int)i) != STACK_SUCCESS) {
+                fprintf(stderr, "spill stack push failed\n");
+                exit(EXIT_FAILURE);
+            }
+        }
+        int value;
+        while (spill_stack_pop(stack, &value) == STACK_SUCCESS) {
+            sum += value;
+        }
+    }
+    double elapsed = bench_now() - start;
+
+    spill_stack_stats(stack, stats);
+    bench_sink += sum;
+    spill_stack_destroy(stack);
+    return elapsed;
+}
+
+int main(void) {
+    SpillStackStats stats;
+
+    printf("=== Spill Stack Benchmark ===\n");
+    printf("Budget %u MiB, segments of %d values\n\n", BUDGET_BYTES >> 20, SPILL_STACK_SEGMENT_VALUES);
+
+    printf("Within budget (%d values, %d rounds):\n", IN_MEMORY_DEPTH, IN_MEMORY_ROUNDS);
+    bench_report("Stack push+pop", run_stack(), 2.0 * IN_MEMORY_DEPTH * IN_MEMORY_ROUNDS);
+    bench_report("spill stack push+pop",
+                 run_spill(IN_MEMORY_DEPTH, IN_MEMORY_ROUNDS, &stats), 2.0 * IN_MEMORY_DEPTH * IN_MEMORY_ROUNDS);
+    printf("  %-40s %10llu bytes spilled\n\n", "", (unsigned long long)stats.bytes_written);
+
+    Stack* too_deep = stack_create(SPILL_DEPTH);
+    printf("Beyond budget (%zu values, %zu MiB; stack_create %s):\n", (size_t)SPILL_DEPTH,
+           SPILL_DEPTH * sizeof(int) >> 20, too_deep ? "succeeds" : "fails");
+    stack_destroy(too_deep);
+    bench_report("spill stack push+pop", run_spill(SPILL_DEPTH, 1, &stats), 2.0 * SPILL_DEPTH);
+    printf("  %-40s %10.1f MiB written, %.1f MiB read\n", "",
+           (double)stats.bytes_written / (1 << 20), (double)stats.bytes_read / (1 << 20));
+    printf("  %-40s %10llu prefetch hits, %llu misses\n", "",
+           (unsigned long long)stats.prefetch_hits, (unsigned long long)stats.prefetch_misses);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file bench_stack_scan.c
+ * @brief Benchmark: inspecting stack contents by popping vs reading in place
+ * @author Jaden Mardini
+ *
+ * Without span access, summing or searching a Stack means popping every
+ * element into a scratch stack and pushing it back. The same questions are
+ * answered here through an iterator, through a plain loop over
+ * stack_data(), and through the SIMD bulk operations.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench_util.h"
+#include "dynamic_stack.h"
+#include "stack_scan.h"
+
+#define DEPTH STACK_MAX_CAPACITY
+#define ROUNDS 20
+
+/**
+ * @brief Sums a stack by popping everything into a scratch stack and restoring it
+ */
+static long long sum_by_popping(Stack* stack, Stack* scratch) {
+    long long sum = 0;
+    int value;
+    while (stack_pop(stack, &value) == STACK_SUCCESS) {
+        sum += value;
+        stack_push(scratch, value);
+    }
+    while (stack_pop(scratch, &value) == STACK_SUCCESS) {
+        stack_push(stack, value);
+    }
+    return sum;
+}
+
+int main(void) {
+    Stack* stack = stack_create(DEPTH);
+    Stack* scratch = stack_create(DEPTH);
+    if (!stack || !scratch) {
+        fprintf(stderr, "stack creation failed\n");
+        return EXIT_FAILURE;
+    }
+    stack_set_wipe_policy(stack, STACK_WIPE_NEVER);
+    stack_set_wipe_policy(scratch, STACK_WIPE_NEVER);
+    for (int i = 0; i < DEPTH; i++) {
+        stack_push(stack, (int)((i * 7919LL) % 1000));
+    }
+
+    printf("=== Stack Scan Benchmark ===\n");
+    printf("%d elements, %d rounds\n\n", DEPTH, ROUNDS);
+    double operations = (double)DEPTH * ROUNDS;
+
+    double start = bench_now();
+    for (int round = 0; round < ROUNDS; round++) {
+        bench_sink += sum_by_popping(stack, scratch);
+    }
+    bench_report("sum: pop and re-push", bench_now() - start, operations);
+
+    start = bench_now();
+    for (int round = 0; round < ROUNDS; round++) {
+        StackIterator iterator;
+        int value;
+        long long sum = 0;
+        stack_iterator_init(&iterator, stack, STACK_ORDER_TOP_DOWN);
+        while (stack_iterator_next(&iterator, &value)) {
+            sum += value;
+        }
+        bench_sink += sum;
+    }
+    bench_report("sum: iterator", bench_now() - start, operations);
+
+    start = bench_now();
+    for (int round = 0; round < ROUNDS; round++) {
+        const int* data = stack_data(stack);
+        size_t size = stack_size(stack);
+        long long sum = 0;
+        for (size_t i = 0; i < size; i++) {
+            sum += data[i];
+        }
+        bench_sink += sum;
+    }
+    bench_report("sum: loop over stack_data", bench_now() - start, operations);
+
+    start = bench_now();
+    for (int round = 0; round < ROUNDS; round++) {
+        bench_sink += stack_sum(stack);
+    }
+    bench_report("sum: stack_sum", bench_now() - start, operations);
+
+    start = bench_now();
+    for (int round = 0; round < ROUNDS; round++) {
+        bench_sink += (long long)stack_count(stack, 500);
+    }
+    bench_report("count: stack_count", bench_now() - start, operations);
+
+    start = bench_now();
+    for (int round = 0; round < ROUNDS; round++) {
+        size_t depth = 0;
+        bench_sink += stack_find(stack, -1, &depth);     /* Absent: scans everything */
+    }
+    bench_report("find (absent): stack_find", bench_now() - start, operations);
+
+    int* output = malloc(DEPTH * sizeof(int));
+    start = bench_now();
+    for (int round = 0; round < ROUNDS; round++) {
+        bench_sink += (long long)stack_copy_out(stack, output, DEPTH, STACK_ORDER_TOP_DOWN);
+    }
+    bench_report("copy out top-down: stack_copy_out", bench_now() - start, operations);
+
+    free(output);
+    stack_destroy(scratch);
+    stack_destroy(stack);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file bench_stack_vm.c
+ * @brief Benchmark: bytecode VM vs token-by-token Stack interpretation
+ * @author Jaden Mardini
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench_util.h"
+#include "dynamic_stack.h"
+#include "stack_vm.h"
+
+#define VECTOR_COUNT 1000000
+#define INPUTS_PER_VECTOR 4
+#define NAIVE_VECTOR_COUNT 100000
+#define REPETITIONS 5
+
+/* Same expression in both syntaxes */
+static const char INFIX_SOURCE[] = "($0 + $1) * ($2 - 3) / ($3 % 7 + 8) + $0 * $1 - ($2 + $3) * 5";
+static const char RPN_SOURCE[] = "$0 $1 + $2 3 - * $3 7 % 8 + / $0 $1 * + $2 $3 + 5 * -";
+
+/**
+ * @brief Interprets RPN text directly with stack_push/stack_pop, as the demo loop would
+ */
+static int interpret_tokens(Stack* stack, const char* source, const int* inputs) {
+    char buffer[sizeof(RPN_SOURCE)];
+    memcpy(buffer, source, sizeof(buffer));
+    stack_clear(stack);
+
+    char* save = NULL;
+    for (char* token = strtok_r(buffer, " ", &save); token; token = strtok_r(NULL, " ", &save)) {
+        int a;
+        int b;
+        if (token[0] == '$') {
+            stack_push(stack, inputs[atoi(token + 1)]);
+        } else if (token[0] >= '0' && token[0] <= '9') {
+            stack_push(stack, atoi(token));
+        } else {
+            stack_pop(stack, &b);
+            stack_pop(stack, &a);
+            switch (token[0]) {
+                case '+': stack_push(stack, a + b); break;
+                case '-': stack_push(stack, a - b); break;
+                case '*': stack_push(stack, a * b); break;
+                case '/': stack_push(stack, a / b); break;
+                default: stack_push(stack, a % b); break;
+            }
+        }
+    }
+
+    int result = 0;
+    stack_pop(stack, &result);
+    return result;
+}
+
+int main(void) {
+    int* inputs = malloc(VECTOR_COUNT * INPUTS_PER_VECTOR * sizeof(int));
+    int* results = malloc(VECTOR_COUNT * sizeof(int));
+    if (!inputs || !results) {
+        fprintf(stderr, "allocation failed\n");
+        return EXIT_FAILURE;
+    }
+
+    unsigned seed = 7;
+    for (size_t i = 0; i < VECTOR_COUNT * INPUTS_PER_VECTOR; i++) {
+        seed = seed * 1103515245u + 12345u;
+        inputs[i] = (int)((seed >> 16) % 2001) - 1000;
+    }
+
+    StackVmProgram* infix;
+    StackVmProgram* rpn;
+    if (stack_vm_compile(INFIX_SOURCE, strlen(INFIX_SOURCE), STACK_VM_SYNTAX_INFIX, &infix, NULL) != STACK_VM_SUCCESS ||
+        stack_vm_compile(RPN_SOURCE, strlen(RPN_SOURCE), STACK_VM_SYNTAX_RPN, &rpn, NULL) != STACK_VM_SUCCESS) {
+        fprintf(stderr, "compilation failed\n");
+        return EXIT_FAILURE;
+    }
+
+    size_t instructions = stack_vm_instruction_count(infix);
+    printf("=== Stack VM Benchmark ===\n");
+    printf("Expression: %s\n", INFIX_SOURCE);
+    printf("Bytecode: %zu instructions in %zu bytes, %d input vectors\n\n",
+           instructions, stack_vm_code_size(infix), VECTOR_COUNT);
+
+    Stack* stack = stack_create(64);
+    double start = bench_now();
+    for (int i = 0; i < NAIVE_VECTOR_COUNT; i++) {
+        bench_sink += interpret_tokens(stack, RPN_SOURCE, inputs + (size_t)i * INPUTS_PER_VECTOR);
+    }
+    double elapsed = bench_now() - start;
+    bench_report("token interpreter on Stack (per vector)", elapsed, NAIVE_VECTOR_COUNT);
+    printf("  %-40s %10.1f M instructions/s\n", "", (double)instructions * NAIVE_VECTOR_COUNT / elapsed / 1e6);
+
+    start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        stack_vm_run_batch(infix, inputs, INPUTS_PER_VECTOR, VECTOR_COUNT, results, NULL);
+        bench_sink += results[r];
+    }
+    elapsed = bench_now() - start;
+    bench_report("stack_vm_run_batch (per vector)", elapsed, (double)VECTOR_COUNT * REPETITIONS);
+    printf("  %-40s %10.1f M instructions/s\n", "",
+           (double)instructions * VECTOR_COUNT * REPETITIONS / elapsed / 1e6);
+
+    /* Both front ends must agree with the token interpreter */
+    bool agree = true;
+    for (int i = 0; i < NAIVE_VECTOR_COUNT && agree; i++) {
+        agree = interpret_tokens(stack, RPN_SOURCE, inputs + (size_t)i * INPUTS_PER_VECTOR) == results[i];
+    }
+    stack_vm_run_batch(rpn, inputs, INPUTS_PER_VECTOR, NAIVE_VECTOR_COUNT, results, NULL);
+    for (int i = 0; i < NAIVE_VECTOR_COUNT && agree; i++) {
+        agree = interpret_tokens(stack, RPN_SOURCE, inputs + (size_t)i * INPUTS_PER_VECTOR) == results[i];
+    }
+    printf("\nResults agree: %s\n", agree ? "yes" : "NO");
+
+    start = bench_now();
+    for (int i = 0; i < VECTOR_COUNT; i++) {
+        stack_vm_run(infix, inputs + (size_t)i * INPUTS_PER_VECTOR, INPUTS_PER_VECTOR, stack);
+        stack_pop(stack, &results[i]);
+    }
+    elapsed = bench_now() - start;
+    bench_report("stack_vm_run + stack_pop (per vector)", elapsed, VECTOR_COUNT);
+
+    stack_destroy(stack);
+    stack_vm_destroy(infix);
+    stack_vm_destroy(rpn);
+    free(inputs);
+    free(results);
+    return agree ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file bench_task_pool.c
+ * @brief Benchmark and demo: recursive tasks on a work-stealing pool
+ * @author Jaden Mardini
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench_util.h"
+#include "dynamic_stack.h"
+#include "task_pool.h"
+#include "work_stealing_deque.h"
+
+#define FIB_INPUT 32
+#define FIB_SERIAL_CUTOFF 18
+#define DEQUE_OPERATIONS 10000000
+
+/* One node of the recursive fib task tree */
+typedef struct {
+    int n;
+    long long result;
+} FibTask;
+
+/**
+ * @brief Plain recursive fib, used below the cutoff and as the baseline
+ */
+static long long fib_serial(int n) {
+    return n < 2 ? n : fib_serial(n - 1) + fib_serial(n - 2);
+}
+
+/**
+ * @brief Spawns fib(n - 1), computes fib(n - 2) inline, then joins
+ */
+static void fib_task(void* argument) {
+    FibTask* task = argument;
+    if (task->n < FIB_SERIAL_CUTOFF) {
+        task->result = fib_serial(task->n);
+        return;
+    }
+
+    TaskGroup group = TASK_GROUP_INITIALIZER;
+    FibTask left = { task->n - 1, 0 };
+    FibTask right = { task->n - 2, 0 };
+    task_group_spawn(&group, fib_task, &left);
+    fib_task(&right);
+    task_group_wait(&group);
+    task->result = left.result + right.result;
+}
+
+int main(void) {
+    printf("=== Work-Stealing Task Pool Benchmark ===\n");
+
+    TaskPool* pool = task_pool_create(0);
+    if (!pool) {
+        fprintf(stderr, "pool creation failed\n");
+        return EXIT_FAILURE;
+    }
+    printf("fib(%d), serial below %d, %zu workers\n\n", FIB_INPUT, FIB_SERIAL_CUTOFF,
+           task_pool_thread_count(pool));
+
+    double start = bench_now();
+    long long expected = fib_serial(FIB_INPUT);
+    double elapsed = bench_now() - start;
+    bench_report("serial recursion", elapsed, 1);
+
+    FibTask root = { FIB_INPUT, 0 };
+    start = bench_now();
+    task_pool_run(pool, fib_task, &root);
+    double pooled = bench_now() - start;
+    bench_report("task pool", pooled, 1);
+
+    TaskPoolStats stats;
+    task_pool_get_stats(pool, &stats);
+    printf("  result %lld (%s), %zu tasks, %zu stolen, speedup %.2fx\n",
+           root.result, root.result == expected ? "ok" : "MISMATCH",
+           stats.executed, stats.stolen, elapsed / pooled);
+    task_pool_destroy(pool);
+
+    /* Owner-side cost: push/pop pairs against the plain Stack */
+    printf("\nOwner push/pop: %d pairs\n", DEQUE_OPERATIONS);
+    Stack* stack = stack_create(64);
+    WorkStealingDeque* deque = ws_deque_create(64);
+    if (!stack || !deque) {
+        fprintf(stderr, "allocation failed\n");
+        return EXIT_FAILURE;
+    }
+
+    int value;
+    start = bench_now();
+    for (int i = 0; i < DEQUE_OPERATIONS; i++) {
+        stack_push(stack, i);
+        stack_pop(stack, &value);
+        bench_sink += value;
+    }
+    elapsed = bench_now() - start;
+    bench_report("stack_push + stack_pop", elapsed, DEQUE_OPERATIONS);
+
+    void* item;
+    start = bench_now();
+    for (int i = 0; i < DEQUE_OPERATIONS; i++) {
+        ws_deque_push(deque, &value);
+        ws_deque_pop(deque, &item);
+        bench_sink += item != NULL;
+    }
+    elapsed = bench_now() - start;
+    bench_report("ws_deque_push + ws_deque_pop", elapsed, DEQUE_OPERATIONS);
+
+    ws_deque_destroy(deque);
+    stack_destroy(stack);
+    return root.result == expected ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,40 @@
+/**
+ * @file bench_util.h
+ * @brief Shared helpers for the benchmark programs
+ * @author Jaden Mardini
+ *
+ * Benchmarks define _POSIX_C_SOURCE before including any header so that
+ * clock_gettime() is available under -std=c11.
+ */
+
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <stdio.h>
+#include <time.h>
+
+/**
+ * @brief Reads the monotonic clock
+ * @return Current time in seconds
+ */
+static inline double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Prints one benchmark result line
+ * @param name Benchmark name
+ * @param seconds Elapsed wall time
+ * @param operations Number of operations performed
+ */
+static inline void bench_report(const char* name, double seconds, double operations) {
+    printf("  %-40s %10.3f ms  %12.1f ns/op\n",
+           name, seconds * 1e3, operations > 0 ? seconds * 1e9 / operations : 0.0);
+}
+
+/* Prevents the compiler from discarding a computed value */
+static volatile long long bench_sink;
+
+#endif /* BENCH_UTIL_H */
@@ -0,0 +1,126 @@
+/**
+ * @file bench_word_reverse.c
+ * @brief Benchmark: SIMD word-order reversal vs byte-at-a-time double reversal
+ * @author Jaden Mardini
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench_util.h"
+#include "word_reverse.h"
+
+#define PAYLOAD_BYTES (32u * 1024u * 1024u)
+#define REPETITIONS 5
+
+/**
+ * @brief Builds English-like text with occasional runs of whitespace
+ */
+static char* build_payload(size_t* length) {
+    static const char* words[] = {
+        "the", "quick", "brown", "fox", "jumps", "over", "a", "lazy", "dog",
+        "stack", "reversal", "benchmark", "tokenized", "sentence", "of", "words"
+    };
+    char* payload = malloc(PAYLOAD_BYTES + 32);
+    if (!payload) {
+        return NULL;
+    }
+
+    size_t used = 0;
+    unsigned seed = 12345;
+    while (used < PAYLOAD_BYTES) {
+        seed = seed * 1103515245u + 12345u;
+        const char* word = words[(seed >> 16) % 16];
+        size_t word_length = strlen(word);
+        memcpy(payload + used, word, word_length);
+        used += word_length;
+        payload[used++] = ' ';
+        if ((seed >> 8) % 8 == 0) {
+            payload[used++] = ' ';
+        }
+    }
+    *length = used;
+    return payload;
+}
+
+/**
+ * @brief Classic approach: reverse all bytes, then reverse each word back
+ */
+static void naive_word_reverse(const char* input, size_t length, char* output) {
+    for (size_t i = 0; i < length; i++) {
+        output[i] = input[length - 1 - i];
+    }
+
+    size_t start = 0;
+    while (start < length) {
+        while (start < length && isspace((unsigned char)output[start])) {
+            start++;
+        }
+        size_t end = start;
+        while (end < length && !isspace((unsigned char)output[end])) {
+            end++;
+        }
+        for (size_t a = start, b = end; a + 1 < b; a++, b--) {
+            char t = output[a];
+            output[a] = output[b - 1];
+            output[b - 1] = t;
+        }
+        start = end;
+    }
+    output[length] = '\0';
+}
+
+int main(void) {
+    size_t length = 0;
+    char* payload = build_payload(&length);
+    char* output = malloc(PAYLOAD_BYTES + 32);
+    char* expected = malloc(PAYLOAD_BYTES + 32);
+    if (!payload || !output || !expected) {
+        fprintf(stderr, "allocation failed\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("=== Word Reversal Benchmark ===\n");
+    printf("Payload: %zu bytes of text, %d repetitions\n\n", length, REPETITIONS);
+
+    double bytes = (double)length * REPETITIONS;
+    double start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        naive_word_reverse(payload, length, expected);
+        bench_sink += expected[0];
+    }
+    double elapsed = bench_now() - start;
+    bench_report("reverse bytes, then each word", elapsed, bytes);
+    printf("  %-40s %10.2f GB/s\n", "", bytes / elapsed / 1e9);
+
+    size_t output_length = 0;
+    start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        bench_sink += word_reverse(payload, length, output, PAYLOAD_BYTES + 32, NULL, &output_length);
+    }
+    elapsed = bench_now() - start;
+    bench_report("word_reverse", elapsed, bytes);
+    printf("  %-40s %10.2f GB/s\n", "", bytes / elapsed / 1e9);
+
+    if (output_length != length || memcmp(output, expected, length) != 0) {
+        fprintf(stderr, "word_reverse output differs from reference\n");
+        return EXIT_FAILURE;
+    }
+
+    WordReverseOptions options = { NULL, true };
+    start = bench_now();
+    for (int r = 0; r < REPETITIONS; r++) {
+        bench_sink += word_reverse(payload, length, output, PAYLOAD_BYTES + 32, &options, &output_length);
+    }
+    elapsed = bench_now() - start;
+    bench_report("word_reverse (collapse)", elapsed, bytes);
+    printf("  %-40s %10.2f GB/s\n", "", bytes / elapsed / 1e9);
+
+    free(payload);
+    free(output);
+    free(expected);
+    return EXIT_SUCCESS;
+}
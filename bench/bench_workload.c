@@ -0,0 +1,185 @@
+/**
+ * @file bench_workload.c
+ * @brief Representative mixed workload used to train and measure PGO builds
+ * @author Jaden Mardini
+ *
+ * Exercises the hot paths in realistic proportions: push/pop mixes on the
+ * dynamic stack that hit the full and empty checks, and string reversal
+ * over varied lengths with occasional rejected characters. Run with
+ * --total to print only the best total time of TOTAL_RUNS runs, in seconds.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench_util.h"
+#include "dynamic_stack.h"
+#include "static_stack.h"
+#include "word_reverse.h"
+
+#define STACK_OPERATIONS 10000000
+#define STACK_CAPACITY 512
+#define STRING_COUNT 20000
+#define STRING_PASSES 10
+#define LONG_STRING_COUNT 5000
+#define LONG_STRING_PASSES 2
+#define MAX_SHORT_LENGTH (CHAR_STACK_MAX_SIZE - 1)
+#define MAX_LONG_LENGTH 4000
+#define TOTAL_RUNS 3
+
+/**
+ * @brief Advances a linear congruential generator
+ */
+static unsigned next_random(unsigned* seed) {
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 16;
+}
+
+/**
+ * @brief Push/pop mix in phases: push-heavy, balanced, pop-heavy
+ */
+static double run_stack_mix(void) {
+    Stack* stack = stack_create(STACK_CAPACITY);
+    if (!stack) {
+        return 0;
+    }
+
+    unsigned seed = 1;
+    int value = 0;
+    double start = bench_now();
+    for (int i = 0; i < STACK_OPERATIONS; i++) {
+        unsigned push_percent = (i / 4096) % 3 == 0 ? 75 : (i / 4096) % 3 == 1 ? 50 : 25;
+        unsigned roll = next_random(&seed) % 100;
+        if (roll < push_percent) {
+            bench_sink += stack_push(stack, i) == STACK_ERROR_OVERFLOW;
+        } else if (roll < push_percent + 5) {
+            bench_sink += stack_peek(stack, &value) == STACK_SUCCESS ? value : 0;
+        } else {
+            bench_sink += stack_pop(stack, &value) == STACK_SUCCESS ? value : -1;
+        }
+    }
+    double elapsed = bench_now() - start;
+
+    stack_destroy(stack);
+    return elapsed;
+}
+
+/**
+ * @brief Builds count NUL-terminated strings of random length up to max_length
+ *
+ * About one string in 50 contains a control character that reversal rejects.
+ */
+static char** make_strings(size_t count, size_t max_length, unsigned seed) {
+    char** strings = malloc(count * sizeof(char*));
+    if (!strings) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        size_t length = next_random(&seed) % (max_length + 1);
+        strings[i] = malloc(length + 1);
+        if (!strings[i]) {
+            return NULL;
+        }
+        for (size_t j = 0; j < length; j++) {
+            unsigned r = next_random(&seed) % 8;
+            strings[i][j] = r == 0 ? ' ' : (char)('a' + next_random(&seed) % 26);
+        }
+        if (length > 0 && next_random(&seed) % 50 == 0) {
+            strings[i][next_random(&seed) % length] = '\x01';
+        }
+        strings[i][length] = '\0';
+    }
+    return strings;
+}
+
+/**
+ * @brief Frees strings from make_strings()
+ */
+static void free_strings(char** strings, size_t count) {
+    if (strings) {
+        for (size_t i = 0; i < count; i++) {
+            free(strings[i]);
+        }
+        free(strings);
+    }
+}
+
+/**
+ * @brief Reverses short strings with the fixed character stack
+ */
+static double run_short_reversal(char** strings) {
+    char output[CHAR_STACK_MAX_SIZE];
+    double start = bench_now();
+    for (int pass = 0; pass < STRING_PASSES; pass++) {
+        for (size_t i = 0; i < STRING_COUNT; i++) {
+            bench_sink += char_stack_reverse_string(strings[i], output, sizeof(output));
+            bench_sink += output[0];
+        }
+    }
+    return bench_now() - start;
+}
+
+/**
+ * @brief Reverses longer strings with a spilling sized stack and by word order
+ */
+static double run_long_reversal(char** strings) {
+    char* output = malloc(MAX_LONG_LENGTH + 1);
+    if (!output) {
+        return 0;
+    }
+
+    CHAR_STACK_DEFINE(stack, CHAR_STACK_MAX_SIZE, CHAR_STACK_SPILL_HEAP);
+    double start = bench_now();
+    for (int pass = 0; pass < LONG_STRING_PASSES; pass++) {
+        for (size_t i = 0; i < LONG_STRING_COUNT; i++) {
+            bench_sink += sized_char_stack_reverse_string(&stack, strings[i], output, MAX_LONG_LENGTH + 1);
+            size_t length = 0;
+            bench_sink += word_reverse(strings[i], strlen(strings[i]), output, MAX_LONG_LENGTH + 1, NULL, &length);
+            bench_sink += (long long)length;
+        }
+    }
+    double elapsed = bench_now() - start;
+
+    sized_char_stack_release(&stack);
+    free(output);
+    return elapsed;
+}
+
+int main(int argc, char* argv[]) {
+    bool total_only = argc > 1 && strcmp(argv[1], "--total") == 0;
+
+    char** short_strings = make_strings(STRING_COUNT, MAX_SHORT_LENGTH, 11);
+    char** long_strings = make_strings(LONG_STRING_COUNT, MAX_LONG_LENGTH, 13);
+    if (!short_strings || !long_strings) {
+        fprintf(stderr, "allocation failed\n");
+        return EXIT_FAILURE;
+    }
+
+    double stack_time = run_stack_mix();
+    double short_time = run_short_reversal(short_strings);
+    double long_time = run_long_reversal(long_strings);
+    double total = stack_time + short_time + long_time;
+
+    if (total_only) {
+        for (int run = 1; run < TOTAL_RUNS; run++) {
+            double again = run_stack_mix() + run_short_reversal(short_strings) + run_long_reversal(long_strings);
+            total = again < total ? again : total;
+        }
+        printf("%.6f\n", total);
+    } else {
+        printf("=== Mixed Workload Benchmark ===\n\n");
+        bench_report("push/pop/peek mix", stack_time, STACK_OPERATIONS);
+        bench_report("char_stack_reverse_string (0-255 bytes)", short_time,
+                     (double)STRING_COUNT * STRING_PASSES);
+        bench_report("sized reverse + word_reverse (0-4000)", long_time,
+                     (double)LONG_STRING_COUNT * LONG_STRING_PASSES);
+        printf("  %-40s %10.3f ms\n", "total", total * 1e3);
+    }
+
+    free_strings(short_strings, STRING_COUNT);
+    free_strings(long_strings, LONG_STRING_COUNT);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file blocking_stack.h
+ * @brief Bounded Blocking Stack Interface
+ * @author Jaden Mardini
+ *
+ * This header defines a fixed-capacity stack shared by producer and
+ * consumer threads. Where stack_push on a full Stack returns
+ * STACK_ERROR_OVERFLOW and stack_pop on an empty one returns
+ * STACK_ERROR_UNDERFLOW, the operations here wait: a push blocks until
+ * there is room and a pop until there is a value, which gives producers
+ * backpressure without busy polling. Waiting threads spin briefly on
+ * multi-core machines and then sleep until woken or until a timeout
+ * expires.
+ */
+
+#ifndef BLOCKING_STACK_H
+#define BLOCKING_STACK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "dynamic_stack.h"
+
+/* Forward declaration for opaque blocking stack structure */
+typedef struct BlockingStack BlockingStack;
+
+/* Counters describing how often threads had to sleep and be woken */
+typedef struct {
+    uint64_t sleeps;            /* Times a push or pop went to sleep */
+    uint64_t wakeups;           /* Wake calls issued; uncontended transfers issue none */
+} BlockingStackStats;
+
+/**
+ * @brief Creates a bounded blocking stack
+ * @param capacity Maximum number of values held at once
+ * @return Pointer to new blocking stack or NULL on failure
+ */
+BlockingStack* blocking_stack_create(size_t capacity);
+
+/**
+ * @brief Destroys a blocking stack and frees all associated memory
+ * @param stack Pointer to blocking stack to destroy
+ *
+ * No thread may be waiting on the stack.
+ */
+void blocking_stack_destroy(BlockingStack* stack);
+
+/**
+ * @brief Pushes a value, waiting while the stack is full
+ * @param stack Pointer to the blocking stack
+ * @param value Value to push
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult blocking_stack_push_wait(BlockingStack* stack, int value);
+
+/**
+ * @brief Pops a value, waiting while the stack is empty
+ * @param stack Pointer to the blocking stack
+ * @param value Pointer to store popped value
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult blocking_stack_pop_wait(BlockingStack* stack, int* value);
+
+/**
+ * @brief Pushes a value, waiting at most timeout_ns nanoseconds for room
+ * @param stack Pointer to the blocking stack
+ * @param value Value to push
+ * @param timeout_ns Longest wait; 0 tries once without waiting
+ * @return STACK_SUCCESS on success, STACK_ERROR_TIMEOUT if still full
+ */
+StackResult blocking_stack_push_timed(BlockingStack* stack, int value, uint64_t timeout_ns);
+
+/**
+ * @brief Pops a value, waiting at most timeout_ns nanoseconds for one
+ * @param stack Pointer to the blocking stack
+ * @param value Pointer to store popped value
+ * @param timeout_ns Longest wait; 0 tries once without waiting
+ * @return STACK_SUCCESS on success, STACK_ERROR_TIMEOUT if still empty
+ */
+StackResult blocking_stack_pop_timed(BlockingStack* stack, int* value, uint64_t timeout_ns);
+
+/**
+ * @brief Pushes several values in order, waiting for room as needed
+ * @param stack Pointer to the blocking stack
+ * @param values Values to push; values[count - 1] ends on top
+ * @param count Number of values
+ * @return STACK_SUCCESS once every value is pushed, error code on failure
+ *
+ * Values are pushed under one lock acquisition for as long as there is
+ * room, and waiting consumers are woken with one call sized to the
+ * number of values pushed rather than one wakeup per value.
+ */
+StackResult blocking_stack_push_many(BlockingStack* stack, const int* values, size_t count);
+
+/**
+ * @brief Pops up to max_count values, waiting until at least one is available
+ * @param stack Pointer to the blocking stack
+ * @param values Buffer receiving the values, top of stack first
+ * @param max_count Size of values
+ * @param popped Pointer to store the number of values popped
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult blocking_stack_pop_many(BlockingStack* stack, int* values, size_t max_count, size_t* popped);
+
+/**
+ * @brief Returns the number of values currently held
+ * @param stack Pointer to the blocking stack
+ * @return Current size, or 0 if stack is NULL
+ */
+size_t blocking_stack_size(const BlockingStack* stack);
+
+/**
+ * @brief Returns the capacity of the stack
+ * @param stack Pointer to the blocking stack
+ * @return Capacity, or 0 if stack is NULL
+ */
+size_t blocking_stack_capacity(const BlockingStack* stack);
+
+/**
+ * @brief Reports sleep and wakeup counters
+ * @param stack Pointer to the blocking stack
+ * @param stats Receives the counters; zeroed if stack is NULL
+ */
+void blocking_stack_stats(const BlockingStack* stack, BlockingStackStats* stats);
+
+#endif /* BLOCKING_STACK_H */
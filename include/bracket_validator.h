@@ -0,0 +1,66 @@
+/**
+ * @file bracket_validator.h
+ * @brief Bracket/Delimiter Balance Validator Interface
+ * @author Jaden Mardini
+ *
+ * This header defines a validator that checks nesting of paired delimiters
+ * in large JSON-, XML- or code-like payloads. Structural characters are
+ * located a block at a time with SIMD compares, and a delimiter stack is
+ * touched only at those positions. Nesting depth is limited only by
+ * available memory, and the exact offset of the first error is reported.
+ */
+
+#ifndef BRACKET_VALIDATOR_H
+#define BRACKET_VALIDATOR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Constants */
+#define BRACKET_MAX_PAIRS 8
+#define BRACKET_DEFAULT_PAIRS "()[]{}"
+
+/* Validation outcomes */
+typedef enum {
+    BRACKET_BALANCED = 0,
+    BRACKET_ERROR_MISMATCH,             /* Closer does not match innermost opener */
+    BRACKET_ERROR_UNEXPECTED_CLOSE,     /* Closer with no open delimiter */
+    BRACKET_ERROR_UNCLOSED,             /* Input ended with delimiters open */
+    BRACKET_ERROR_UNTERMINATED_STRING,  /* Input ended inside a quoted string */
+    BRACKET_ERROR_INVALID_INPUT,
+    BRACKET_ERROR_MEMORY_ALLOCATION
+} BracketResult;
+
+/* Validation options */
+typedef struct {
+    const char* pairs;      /* Opener/closer pairs, e.g. "()[]{}"; NULL for default */
+    bool skip_strings;      /* Ignore delimiters inside quoted strings */
+    char quote;             /* Quote character when skip_strings is set ('"' if 0) */
+} BracketOptions;
+
+/* Details of a validation run */
+typedef struct {
+    size_t error_offset;    /* Offset of first error (length for end-of-input errors) */
+    size_t max_depth;       /* Deepest nesting reached */
+    size_t delimiter_count; /* Delimiters processed */
+} BracketReport;
+
+/**
+ * @brief Validates delimiter nesting in a buffer
+ * @param data Buffer to validate
+ * @param length Number of bytes in the buffer
+ * @param options Validation options, or NULL for "()[]{}" without string skipping
+ * @param report Optional pointer to receive details, may be NULL
+ * @return BRACKET_BALANCED if every delimiter is matched, error code otherwise
+ */
+BracketResult bracket_validate(const char* data, size_t length,
+                               const BracketOptions* options, BracketReport* report);
+
+/**
+ * @brief Converts a validation result to human-readable string
+ * @param result Validation result
+ * @return String description of the result
+ */
+const char* bracket_result_string(BracketResult result);
+
+#endif /* BRACKET_VALIDATOR_H */
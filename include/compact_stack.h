@@ -0,0 +1,126 @@
+/**
+ * @file compact_stack.h
+ * @brief Compact Integer Stack Interface
+ * @author Jaden Mardini
+ *
+ * This header defines an integer stack with the same operations as Stack
+ * that stores small values in less than four bytes each. Narrow mode keeps
+ * every element at the narrowest width (1, 2 or 4 bytes) that has held all
+ * values pushed so far, and widens the whole array at once the first time
+ * a value needs more room. Delta mode stores each element as the
+ * variable-length encoded difference from the element below it, which
+ * takes a single byte per element for slowly rising or falling sequences
+ * such as counters, offsets and timestamps. Like a Stack under its default
+ * wipe policy, the storage of popped, cleared and destroyed elements is
+ * zeroed.
+ */
+
+#ifndef COMPACT_STACK_H
+#define COMPACT_STACK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "dynamic_stack.h"
+
+/* Element encoding */
+typedef enum {
+    COMPACT_STACK_NARROW = 0,   /* Fixed-width elements, widened on demand */
+    COMPACT_STACK_DELTA         /* Zigzag varint differences between neighbours */
+} CompactStackMode;
+
+/* Forward declaration for opaque compact stack structure */
+typedef struct CompactStack CompactStack;
+
+/**
+ * @brief Creates a new compact stack
+ * @param capacity Maximum number of elements the stack can hold
+ * @param mode Element encoding
+ * @return Pointer to new stack or NULL on failure
+ */
+CompactStack* compact_stack_create(size_t capacity, CompactStackMode mode);
+
+/**
+ * @brief Destroys a compact stack and frees all associated memory
+ * @param stack Pointer to stack to destroy
+ */
+void compact_stack_destroy(CompactStack* stack);
+
+/**
+ * @brief Pushes a value onto the top of the stack
+ * @param stack Pointer to the stack
+ * @param value Value to push
+ * @return STACK_SUCCESS on success, error code on failure
+ *
+ * In narrow mode a value wider than the current element width widens
+ * every stored element first, which is O(n) once per width change.
+ */
+StackResult compact_stack_push(CompactStack* stack, int value);
+
+/**
+ * @brief Pops a value from the top of the stack
+ * @param stack Pointer to the stack
+ * @param value Pointer to store the popped value
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult compact_stack_pop(CompactStack* stack, int* value);
+
+/**
+ * @brief Peeks at the top value without removing it
+ * @param stack Pointer to the stack
+ * @param value Pointer to store the top value
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult compact_stack_peek(const CompactStack* stack, int* value);
+
+/**
+ * @brief Checks if the stack is empty
+ * @param stack Pointer to the stack
+ * @return true if empty, false otherwise
+ */
+bool compact_stack_is_empty(const CompactStack* stack);
+
+/**
+ * @brief Checks if the stack is full
+ * @param stack Pointer to the stack
+ * @return true if full, false otherwise
+ */
+bool compact_stack_is_full(const CompactStack* stack);
+
+/**
+ * @brief Gets the current number of elements in the stack
+ * @param stack Pointer to the stack
+ * @return Number of elements, or 0 if stack is NULL
+ */
+size_t compact_stack_size(const CompactStack* stack);
+
+/**
+ * @brief Gets the maximum capacity of the stack
+ * @param stack Pointer to the stack
+ * @return Capacity, or 0 if stack is NULL
+ */
+size_t compact_stack_capacity(const CompactStack* stack);
+
+/**
+ * @brief Clears all elements from the stack
+ * @param stack Pointer to the stack
+ * @return STACK_SUCCESS on success, error code on failure
+ *
+ * A narrow-mode stack keeps its current element width.
+ */
+StackResult compact_stack_clear(CompactStack* stack);
+
+/**
+ * @brief Gets the current element width
+ * @param stack Pointer to the stack
+ * @return 1, 2 or 4 bytes in narrow mode; 0 in delta mode or if stack is NULL
+ */
+size_t compact_stack_element_width(const CompactStack* stack);
+
+/**
+ * @brief Gets the number of bytes allocated for element storage
+ * @param stack Pointer to the stack
+ * @return Allocated element bytes, or 0 if stack is NULL
+ */
+size_t compact_stack_memory_usage(const CompactStack* stack);
+
+#endif /* COMPACT_STACK_H */
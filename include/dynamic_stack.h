@@ -23,14 +23,90 @@ typedef enum {
     STACK_ERROR_MEMORY_ALLOCATION,
     STACK_ERROR_OVERFLOW,
     STACK_ERROR_UNDERFLOW,
-    STACK_ERROR_INVALID_CAPACITY
+    STACK_ERROR_INVALID_CAPACITY,
+    STACK_ERROR_INVALID_MARK,
+    STACK_ERROR_UNSUPPORTED,
+    STACK_ERROR_CONTENDED,
+    STACK_ERROR_TIMEOUT,
+    STACK_ERROR_IO,
+    STACK_ERROR_INVALID_INDEX
 } StackResult;
 
+/* Policy for clearing slots discarded by pop, rewind and clear */
+typedef enum {
+    STACK_WIPE_ALWAYS = 0,  /* Zero discarded slots (default, secure) */
+    STACK_WIPE_NEVER        /* Leave discarded slots untouched (fastest) */
+} StackWipePolicy;
+
+/* Transparent huge page policy for element storage */
+typedef enum {
+    STACK_HUGE_PAGES_NEVER = 0,     /* Regular pages (default) */
+    STACK_HUGE_PAGES_AUTO,          /* Huge pages for arrays of at least STACK_HUGE_PAGE_SIZE */
+    STACK_HUGE_PAGES_ALWAYS         /* Huge pages for any heap-allocated array */
+} StackHugePagePolicy;
+
+/* Placement options for stack_create_with_options() */
+typedef struct {
+    size_t alignment;               /* Element array alignment in bytes (power of two; 0 = default) */
+    bool pad_header;                /* Give the header its own cache line(s) to avoid false sharing */
+    StackHugePagePolicy huge_pages; /* Transparent huge page use */
+    int numa_node;                  /* Preferred NUMA node, or STACK_NUMA_NODE_ANY */
+} StackOptions;
+
+/*
+ * Memory hooks for stack_create_with_allocator(). Every header, element and
+ * bookkeeping allocation of the stack goes through these, with the size of
+ * the block passed back on free so sized allocators need no headers.
+ * reallocate may be NULL, in which case growth allocates, copies and frees.
+ */
+typedef struct {
+    void* (*allocate)(void* context, size_t size, size_t alignment);
+    void* (*reallocate)(void* context, void* ptr, size_t old_size, size_t new_size, size_t alignment);
+    void (*deallocate)(void* context, void* ptr, size_t size);
+    void* context;                  /* Passed unchanged to every hook */
+} StackAllocator;
+
+/* Direction of traversal over the live elements */
+typedef enum {
+    STACK_ORDER_TOP_DOWN = 0,   /* Top element first, as pops would return them */
+    STACK_ORDER_BOTTOM_UP       /* Oldest element first, in push order */
+} StackOrder;
+
+/* Read-only cursor over a stack's elements; see stack_iterator_init() */
+typedef struct {
+    const int* data;        /* Live elements, bottom first */
+    size_t remaining;       /* Elements not yet returned */
+    size_t next;            /* Index of the next element in data */
+    StackOrder order;
+} StackIterator;
+
+/* Checkpoint token returned by stack_mark() */
+typedef struct {
+    size_t size;            /* Stack size when the mark was taken */
+    size_t stamp;           /* Validation stamp (debug builds only) */
+} StackMark;
+
 /* Constants */
 #define STACK_DEFAULT_CAPACITY 100
 #define STACK_MIN_CAPACITY 1
 #define STACK_MAX_CAPACITY 1000000
 
+/* Placement constants */
+#define STACK_CACHE_LINE_SIZE 64
+#define STACK_HUGE_PAGE_SIZE (2u * 1024u * 1024u)
+#define STACK_NUMA_NODE_ANY (-1)
+
+/*
+ * Elements stored inside the stack header before spilling to the heap.
+ * Every stack starts on this array, so one holding no more elements than
+ * this needs a single allocation whatever its capacity; the first push
+ * beyond it allocates the full element array.
+ * Override with -DSTACK_INLINE_CAPACITY=N; 0 disables inline storage.
+ */
+#ifndef STACK_INLINE_CAPACITY
+#define STACK_INLINE_CAPACITY 16
+#endif
+
 /**
  * @brief Creates a new dynamic stack with specified capacity
  * @param capacity Maximum number of elements the stack can hold
@@ -38,6 +114,39 @@ typedef enum {
  */
 Stack* stack_create(size_t capacity);
 
+/**
+ * @brief Creates a new dynamic stack with explicit memory placement
+ * @param capacity Maximum number of elements the stack can hold
+ * @param options Placement options, or NULL for the stack_create() defaults
+ * @return Pointer to new stack or NULL on failure
+ *
+ * Huge pages and NUMA placement use madvise()/mbind() where the platform
+ * provides them and fall back to ordinary allocation elsewhere. Element
+ * memory is zeroed by the creating thread, so without an explicit node it
+ * is placed by first touch. An explicit node that cannot be honoured makes
+ * creation fail.
+ */
+Stack* stack_create_with_options(size_t capacity, const StackOptions* options);
+
+/**
+ * @brief Creates a new dynamic stack whose memory comes from an allocator
+ * @param capacity Maximum number of elements the stack can hold
+ * @param options Placement options, or NULL for the stack_create() defaults
+ * @param allocator Memory hooks, or NULL for the C library allocator
+ * @return Pointer to new stack or NULL on failure
+ *
+ * The allocator is copied into the stack and must outlive it. Huge page
+ * and NUMA options are ignored for custom allocators, which own placement.
+ */
+Stack* stack_create_with_allocator(size_t capacity, const StackOptions* options,
+                                   const StackAllocator* allocator);
+
+/**
+ * @brief Fills options with the defaults used by stack_create()
+ * @param options Options to initialize
+ */
+void stack_options_init(StackOptions* options);
+
 /**
  * @brief Destroys a stack and frees all associated memory
  * @param stack Pointer to stack to destroy
@@ -96,6 +205,47 @@ size_t stack_size(const Stack* stack);
  */
 size_t stack_capacity(const Stack* stack);
 
+/**
+ * @brief Returns the live elements without copying them
+ * @param stack Pointer to the stack
+ * @return stack_size() elements, bottom first (the top is the last one),
+ *         or NULL if stack is NULL
+ *
+ * The span is read-only and stays valid until the next call that modifies
+ * the stack, including pushes that may move the elements when the stack grows.
+ */
+const int* stack_data(const Stack* stack);
+
+/**
+ * @brief Positions an iterator before the first element in the given order
+ * @param iterator Iterator to initialize
+ * @param stack Pointer to the stack; NULL gives an empty iteration
+ * @param order STACK_ORDER_TOP_DOWN or STACK_ORDER_BOTTOM_UP
+ *
+ * Iteration reads the elements in place, like stack_data(), and is
+ * invalidated by the same calls.
+ */
+void stack_iterator_init(StackIterator* iterator, const Stack* stack, StackOrder order);
+
+/**
+ * @brief Advances an iterator
+ * @param iterator Pointer to the iterator
+ * @param value Pointer to store the next element
+ * @return true if an element was stored, false once the iteration is done
+ */
+bool stack_iterator_next(StackIterator* iterator, int* value);
+
+/**
+ * @brief Grows the stack's capacity, preserving its contents
+ * @param stack Pointer to the stack
+ * @param capacity New capacity; smaller than the current capacity is a no-op
+ * @return STACK_SUCCESS on success, error code on failure
+ *
+ * A stack still using inline storage only records the new capacity; its
+ * elements move to the heap when a push outgrows the inline array.
+ */
+StackResult stack_reserve(Stack* stack, size_t capacity);
+
 /**
  * @brief Clears all elements from the stack
  * @param stack Pointer to the stack
@@ -103,6 +253,37 @@ size_t stack_capacity(const Stack* stack);
  */
 StackResult stack_clear(Stack* stack);
 
+/**
+ * @brief Sets how discarded element slots are treated
+ * @param stack Pointer to the stack
+ * @param policy Wipe policy to apply to subsequent pops, rewinds and clears
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult stack_set_wipe_policy(Stack* stack, StackWipePolicy policy);
+
+/**
+ * @brief Records a checkpoint of the current stack contents in O(1)
+ * @param stack Pointer to the stack
+ * @return Checkpoint token (size 0 if stack is NULL)
+ *
+ * Marks nest: taking a mark, pushing, and taking another mark yields an
+ * inner checkpoint that stays valid until the stack is rewound, popped or
+ * cleared below it.
+ */
+StackMark stack_mark(const Stack* stack);
+
+/**
+ * @brief Truncates the stack back to a checkpoint
+ * @param stack Pointer to the stack
+ * @param mark Checkpoint previously returned by stack_mark()
+ * @return STACK_SUCCESS on success, error code on failure
+ *
+ * Runs in O(1) under STACK_WIPE_NEVER; under STACK_WIPE_ALWAYS only the
+ * discarded slots are zeroed. Debug builds additionally detect marks whose
+ * contents were popped and re-pushed since the mark was taken.
+ */
+StackResult stack_rewind(Stack* stack, StackMark mark);
+
 /**
  * @brief Converts error code to human-readable string
  * @param result Error code
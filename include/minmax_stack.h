@@ -0,0 +1,128 @@
+/**
+ * @file minmax_stack.h
+ * @brief Aggregate-Tracking Stack Interface
+ * @author Jaden Mardini
+ *
+ * This header defines an integer stack that maintains its running minimum,
+ * maximum and sum alongside the elements, so aggregate queries are O(1)
+ * instead of requiring the stack to be drained. Extrema are recorded only
+ * when they change, so the auxiliary memory is proportional to the number
+ * of distinct new minima/maxima rather than to the stack size.
+ */
+
+#ifndef MINMAX_STACK_H
+#define MINMAX_STACK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "dynamic_stack.h"
+
+/* Forward declaration for opaque stack structure */
+typedef struct MinMaxStack MinMaxStack;
+
+/* Aggregates that can be tracked */
+#define MINMAX_STACK_TRACK_MIN 0x1u
+#define MINMAX_STACK_TRACK_MAX 0x2u
+#define MINMAX_STACK_TRACK_SUM 0x4u
+#define MINMAX_STACK_TRACK_ALL (MINMAX_STACK_TRACK_MIN | MINMAX_STACK_TRACK_MAX | MINMAX_STACK_TRACK_SUM)
+
+/**
+ * @brief Creates a new aggregate-tracking stack
+ * @param capacity Maximum number of elements the stack can hold
+ * @param track_flags Bitwise OR of MINMAX_STACK_TRACK_* flags
+ * @return Pointer to new stack or NULL on failure
+ */
+MinMaxStack* minmax_stack_create(size_t capacity, unsigned track_flags);
+
+/**
+ * @brief Destroys a stack and frees all associated memory
+ * @param stack Pointer to stack to destroy
+ */
+void minmax_stack_destroy(MinMaxStack* stack);
+
+/**
+ * @brief Pushes a value, updating tracked aggregates in O(1)
+ * @param stack Pointer to the stack
+ * @param value Value to push
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult minmax_stack_push(MinMaxStack* stack, int value);
+
+/**
+ * @brief Pops a value, restoring tracked aggregates in O(1)
+ * @param stack Pointer to the stack
+ * @param value Pointer to store the popped value
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult minmax_stack_pop(MinMaxStack* stack, int* value);
+
+/**
+ * @brief Peeks at the top value without removing it
+ * @param stack Pointer to the stack
+ * @param value Pointer to store the top value
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult minmax_stack_peek(const MinMaxStack* stack, int* value);
+
+/**
+ * @brief Gets the minimum element currently in the stack
+ * @param stack Pointer to the stack
+ * @param value Pointer to store the minimum
+ * @return STACK_SUCCESS, STACK_ERROR_UNDERFLOW if empty, or
+ *         STACK_ERROR_UNSUPPORTED if the minimum is not tracked
+ */
+StackResult minmax_stack_min(const MinMaxStack* stack, int* value);
+
+/**
+ * @brief Gets the maximum element currently in the stack
+ * @param stack Pointer to the stack
+ * @param value Pointer to store the maximum
+ * @return STACK_SUCCESS, STACK_ERROR_UNDERFLOW if empty, or
+ *         STACK_ERROR_UNSUPPORTED if the maximum is not tracked
+ */
+StackResult minmax_stack_max(const MinMaxStack* stack, int* value);
+
+/**
+ * @brief Gets the sum of all elements currently in the stack
+ * @param stack Pointer to the stack
+ * @param sum Pointer to store the sum (0 for an empty stack)
+ * @return STACK_SUCCESS, or STACK_ERROR_UNSUPPORTED if the sum is not tracked
+ */
+StackResult minmax_stack_sum(const MinMaxStack* stack, long long* sum);
+
+/**
+ * @brief Checks if the stack is empty
+ * @param stack Pointer to the stack
+ * @return true if empty, false otherwise
+ */
+bool minmax_stack_is_empty(const MinMaxStack* stack);
+
+/**
+ * @brief Checks if the stack is full
+ * @param stack Pointer to the stack
+ * @return true if full, false otherwise
+ */
+bool minmax_stack_is_full(const MinMaxStack* stack);
+
+/**
+ * @brief Gets the current number of elements in the stack
+ * @param stack Pointer to the stack
+ * @return Number of elements, or 0 if stack is NULL
+ */
+size_t minmax_stack_size(const MinMaxStack* stack);
+
+/**
+ * @brief Gets the maximum capacity of the stack
+ * @param stack Pointer to the stack
+ * @return Capacity, or 0 if stack is NULL
+ */
+size_t minmax_stack_capacity(const MinMaxStack* stack);
+
+/**
+ * @brief Clears all elements and aggregates from the stack
+ * @param stack Pointer to the stack
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult minmax_stack_clear(MinMaxStack* stack);
+
+#endif /* MINMAX_STACK_H */
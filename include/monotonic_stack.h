@@ -0,0 +1,123 @@
+/**
+ * @file monotonic_stack.h
+ * @brief Monotonic-Stack Algorithm Kernels
+ * @author Jaden Mardini
+ *
+ * This header defines batch, array-in/array-out kernels for the classic
+ * monotonic-stack algorithms: next/previous greater and smaller element,
+ * stock span, and largest rectangle in a histogram. Each kernel runs in
+ * O(n) with a single reusable index workspace, so there is no allocation
+ * per element, and independent arrays can be processed on several threads.
+ */
+
+#ifndef MONOTONIC_STACK_H
+#define MONOTONIC_STACK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "dynamic_stack.h"
+
+/* Forward declaration for opaque workspace structure */
+typedef struct MonotonicWorkspace MonotonicWorkspace;
+
+/* Index reported when no qualifying element exists */
+#define MONOTONIC_NONE SIZE_MAX
+
+/* Kernels available to batch jobs */
+typedef enum {
+    MONOTONIC_NEXT_GREATER = 0,
+    MONOTONIC_NEXT_SMALLER,
+    MONOTONIC_PREVIOUS_GREATER,
+    MONOTONIC_PREVIOUS_SMALLER,
+    MONOTONIC_STOCK_SPAN,
+    MONOTONIC_LARGEST_RECTANGLE
+} MonotonicKernel;
+
+/* One independent array to process in a batch */
+typedef struct {
+    MonotonicKernel kernel;     /* Algorithm to run */
+    const int* values;          /* Input array */
+    size_t count;               /* Number of input values */
+    size_t* indices;            /* Output array of count entries (unused for rectangle) */
+    long long area;             /* Output for MONOTONIC_LARGEST_RECTANGLE */
+    StackResult result;         /* Per-job status */
+} MonotonicJob;
+
+/**
+ * @brief Creates a reusable index workspace
+ * @param initial_capacity Number of indices to reserve up front (may be 0)
+ * @return Pointer to new workspace or NULL on failure
+ */
+MonotonicWorkspace* monotonic_workspace_create(size_t initial_capacity);
+
+/**
+ * @brief Destroys a workspace and frees its memory
+ * @param workspace Pointer to workspace to destroy
+ */
+void monotonic_workspace_destroy(MonotonicWorkspace* workspace);
+
+/**
+ * @brief For each element, finds the index of the next strictly greater element
+ * @param workspace Reusable workspace, or NULL to allocate one for this call
+ * @param values Input array
+ * @param count Number of input values
+ * @param indices Output array; MONOTONIC_NONE where no such element exists
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult monotonic_next_greater(MonotonicWorkspace* workspace, const int* values,
+                                   size_t count, size_t* indices);
+
+/**
+ * @brief For each element, finds the index of the next strictly smaller element
+ * @see monotonic_next_greater
+ */
+StackResult monotonic_next_smaller(MonotonicWorkspace* workspace, const int* values,
+                                   size_t count, size_t* indices);
+
+/**
+ * @brief For each element, finds the index of the previous strictly greater element
+ * @see monotonic_next_greater
+ */
+StackResult monotonic_previous_greater(MonotonicWorkspace* workspace, const int* values,
+                                       size_t count, size_t* indices);
+
+/**
+ * @brief For each element, finds the index of the previous strictly smaller element
+ * @see monotonic_next_greater
+ */
+StackResult monotonic_previous_smaller(MonotonicWorkspace* workspace, const int* values,
+                                       size_t count, size_t* indices);
+
+/**
+ * @brief Computes the stock span of each price
+ * @param workspace Reusable workspace, or NULL to allocate one for this call
+ * @param prices Input array
+ * @param count Number of prices
+ * @param spans Output: number of consecutive days up to and including each
+ *              day whose price was less than or equal to that day's price
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult monotonic_stock_span(MonotonicWorkspace* workspace, const int* prices,
+                                 size_t count, size_t* spans);
+
+/**
+ * @brief Computes the largest rectangle area in a histogram
+ * @param workspace Reusable workspace, or NULL to allocate one for this call
+ * @param heights Non-negative bar heights
+ * @param count Number of bars
+ * @param area Pointer to store the largest area
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult monotonic_largest_rectangle(MonotonicWorkspace* workspace, const int* heights,
+                                        size_t count, long long* area);
+
+/**
+ * @brief Runs many independent jobs, optionally across several threads
+ * @param jobs Array of jobs; each job's result field is filled in
+ * @param job_count Number of jobs
+ * @param thread_count Worker threads to use (0 or 1 runs on the caller)
+ * @return STACK_SUCCESS if every job succeeded, otherwise the first failure
+ */
+StackResult monotonic_run_batch(MonotonicJob* jobs, size_t job_count, size_t thread_count);
+
+#endif /* MONOTONIC_STACK_H */
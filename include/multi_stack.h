@@ -0,0 +1,113 @@
+/**
+ * @file multi_stack.h
+ * @brief Multiple Stacks in One Buffer Interface
+ * @author Jaden Mardini
+ *
+ * This header defines a container for a fixed number of related integer
+ * stacks, such as an operand and an operator stack, or one stack per
+ * nesting level, that share a single contiguous buffer. The container,
+ * its bookkeeping and every element come from one allocation and are
+ * released by one call. No stack has a fixed share of the buffer: a push
+ * fails only when every slot of every stack is in use.
+ *
+ * Two stacks grow towards each other from opposite ends of the buffer.
+ * With any other count, each stack owns a region and a stack that runs
+ * out of room moves its neighbours to redistribute the free slots.
+ */
+
+#ifndef MULTI_STACK_H
+#define MULTI_STACK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "dynamic_stack.h"
+
+/* Largest number of stacks in one container */
+#define MULTI_STACK_MAX_STACKS 1024
+
+/* Forward declaration for opaque multi-stack handle */
+typedef struct MultiStack MultiStack;
+
+/**
+ * @brief Creates a container of stacks sharing one buffer
+ * @param stack_count Number of stacks, from 1 to MULTI_STACK_MAX_STACKS
+ * @param capacity Total number of elements across all stacks
+ * @return Pointer to new container or NULL on failure
+ */
+MultiStack* multi_stack_create(size_t stack_count, size_t capacity);
+
+/**
+ * @brief Destroys a container and every stack in it
+ * @param stacks Pointer to container to destroy
+ */
+void multi_stack_destroy(MultiStack* stacks);
+
+/**
+ * @brief Pushes a value onto one stack
+ * @param stacks Pointer to the container
+ * @param index Stack to push onto
+ * @param value Value to push
+ * @return STACK_SUCCESS on success, STACK_ERROR_OVERFLOW if the buffer is full,
+ *         STACK_ERROR_INVALID_INDEX if index is out of range
+ */
+StackResult multi_stack_push(MultiStack* stacks, size_t index, int value);
+
+/**
+ * @brief Pops the top value of one stack
+ * @param stacks Pointer to the container
+ * @param index Stack to pop from
+ * @param value Pointer to store popped value
+ * @return STACK_SUCCESS on success, STACK_ERROR_UNDERFLOW if that stack is empty,
+ *         STACK_ERROR_INVALID_INDEX if index is out of range
+ */
+StackResult multi_stack_pop(MultiStack* stacks, size_t index, int* value);
+
+/**
+ * @brief Reads the top value of one stack without removing it
+ * @param stacks Pointer to the container
+ * @param index Stack to read
+ * @param value Pointer to store top value
+ * @return STACK_SUCCESS on success, STACK_ERROR_UNDERFLOW if that stack is empty,
+ *         STACK_ERROR_INVALID_INDEX if index is out of range
+ */
+StackResult multi_stack_peek(const MultiStack* stacks, size_t index, int* value);
+
+/**
+ * @brief Empties one stack, leaving the others untouched
+ * @param stacks Pointer to the container
+ * @param index Stack to empty
+ * @return STACK_SUCCESS on success, STACK_ERROR_INVALID_INDEX if index is out of range
+ */
+StackResult multi_stack_clear(MultiStack* stacks, size_t index);
+
+/**
+ * @brief Returns the number of elements on one stack
+ * @param stacks Pointer to the container
+ * @param index Stack to measure
+ * @return Number of elements, or 0 if stacks is NULL or index is out of range
+ */
+size_t multi_stack_size(const MultiStack* stacks, size_t index);
+
+/**
+ * @brief Checks if one stack is empty
+ * @param stacks Pointer to the container
+ * @param index Stack to check
+ * @return true if empty, NULL or index is out of range, false otherwise
+ */
+bool multi_stack_is_empty(const MultiStack* stacks, size_t index);
+
+/**
+ * @brief Returns the number of stacks in a container
+ * @param stacks Pointer to the container
+ * @return Number of stacks, or 0 if stacks is NULL
+ */
+size_t multi_stack_count(const MultiStack* stacks);
+
+/**
+ * @brief Returns the total capacity shared by all stacks
+ * @param stacks Pointer to the container
+ * @return Total capacity, or 0 if stacks is NULL
+ */
+size_t multi_stack_capacity(const MultiStack* stacks);
+
+#endif /* MULTI_STACK_H */
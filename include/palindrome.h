@@ -0,0 +1,72 @@
+/**
+ * @file palindrome.h
+ * @brief Palindrome and Mirror-Equality Detection Interface
+ * @author Jaden Mardini
+ *
+ * This header defines checks for whether a string equals its own reverse,
+ * without building the reversed copy that char_stack_reverse_string()
+ * followed by strcmp() would need. Blocks from the front are compared with
+ * byte-reversed blocks from the back using SIMD, and a batch variant tests
+ * many strings and reports the results as a bitmap.
+ */
+
+#ifndef PALINDROME_H
+#define PALINDROME_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Comparison flags */
+#define PALINDROME_EXACT              0x0u  /* Byte-for-byte mirror equality */
+#define PALINDROME_FOLD_CASE          0x1u  /* Treat ASCII letters case-insensitively */
+#define PALINDROME_SKIP_PUNCTUATION   0x2u  /* Ignore ASCII punctuation */
+#define PALINDROME_SKIP_WHITESPACE    0x4u  /* Ignore ASCII whitespace */
+#define PALINDROME_NATURAL            (PALINDROME_FOLD_CASE | PALINDROME_SKIP_PUNCTUATION | \
+                                       PALINDROME_SKIP_WHITESPACE)
+
+/* Bits per bitmap word in palindrome_check_batch() */
+#define PALINDROME_BITMAP_WORD_BITS 64
+
+/* Number of bitmap words needed for count strings */
+#define PALINDROME_BITMAP_WORDS(count) \
+    (((count) + PALINDROME_BITMAP_WORD_BITS - 1) / PALINDROME_BITMAP_WORD_BITS)
+
+/* Error codes for batch checks */
+typedef enum {
+    PALINDROME_SUCCESS = 0,
+    PALINDROME_ERROR_NULL_POINTER
+} PalindromeResult;
+
+/**
+ * @brief Checks whether a buffer reads the same forwards and backwards
+ * @param data Buffer to check
+ * @param length Number of bytes in the buffer
+ * @param flags PALINDROME_* flags
+ * @return true if data equals its mirror under flags; false otherwise or if data is NULL
+ *
+ * Empty input, or input made only of skipped characters, is a palindrome.
+ */
+bool palindrome_check(const char* data, size_t length, unsigned flags);
+
+/**
+ * @brief Checks many strings, setting one bitmap bit per palindrome
+ * @param strings Array of count strings
+ * @param lengths Array of count lengths, or NULL to use strlen()
+ * @param count Number of strings
+ * @param flags PALINDROME_* flags
+ * @param bitmap Receives PALINDROME_BITMAP_WORDS(count) words; bit i of
+ *               word i / 64 is set when strings[i] is a palindrome
+ * @return PALINDROME_SUCCESS on success, error code on failure
+ */
+PalindromeResult palindrome_check_batch(const char* const* strings, const size_t* lengths,
+                                        size_t count, unsigned flags, uint64_t* bitmap);
+
+/**
+ * @brief Converts error code to human-readable string
+ * @param result Error code to convert
+ * @return String description of the error
+ */
+const char* palindrome_error_string(PalindromeResult result);
+
+#endif /* PALINDROME_H */
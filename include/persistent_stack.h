@@ -0,0 +1,139 @@
+/**
+ * @file persistent_stack.h
+ * @brief Persistent (Immutable) Stack Interface
+ * @author Jaden Mardini
+ *
+ * This header defines a persistent stack in which every push creates a
+ * new version that shares its tail with the previous one. Versions are
+ * lightweight handles onto reference-counted nodes drawn from a pool, so
+ * cloning or snapshotting a stack is O(1) regardless of its size and
+ * nodes are reclaimed as soon as the last version using them is released.
+ *
+ * Pools and the versions built from them are not thread-safe; keep each
+ * pool confined to one thread.
+ */
+
+#ifndef PERSISTENT_STACK_H
+#define PERSISTENT_STACK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "dynamic_stack.h"
+
+/* Forward declarations for opaque structures */
+typedef struct PersistentStackNode PersistentStackNode;
+typedef struct PersistentStackPool PersistentStackPool;
+
+/* Constants */
+#define PERSISTENT_STACK_POOL_CHUNK_NODES 1024
+
+/**
+ * @brief Handle onto one version of a persistent stack
+ *
+ * A handle owns a single reference to its top node. Copying the struct
+ * by assignment does NOT take a new reference; use persistent_stack_clone()
+ * or persistent_stack_snapshot() for that.
+ */
+typedef struct {
+    PersistentStackPool* pool;  /* Pool the nodes are allocated from */
+    PersistentStackNode* top;   /* Top node, or NULL when empty */
+    size_t size;                /* Number of elements in this version */
+} PersistentStack;
+
+/**
+ * @brief Creates a node pool for persistent stacks
+ * @return Pointer to new pool or NULL on failure
+ */
+PersistentStackPool* persistent_stack_pool_create(void);
+
+/**
+ * @brief Destroys a pool and every node allocated from it
+ * @param pool Pointer to pool to destroy
+ *
+ * All versions built from the pool become invalid.
+ */
+void persistent_stack_pool_destroy(PersistentStackPool* pool);
+
+/**
+ * @brief Gets the number of nodes currently in use in a pool
+ * @param pool Pointer to the pool
+ * @return Live node count, or 0 if pool is NULL
+ */
+size_t persistent_stack_pool_live_nodes(const PersistentStackPool* pool);
+
+/**
+ * @brief Initializes an empty version bound to a pool
+ * @param stack Handle to initialize
+ * @param pool Pool to allocate nodes from
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult persistent_stack_init(PersistentStack* stack, PersistentStackPool* pool);
+
+/**
+ * @brief Pushes a value, moving the handle to the new version in O(1)
+ * @param stack Handle to advance
+ * @param value Value to push
+ * @return STACK_SUCCESS on success, error code on failure
+ *
+ * Other handles sharing the previous version are unaffected.
+ */
+StackResult persistent_stack_push(PersistentStack* stack, int value);
+
+/**
+ * @brief Pops a value, moving the handle to the tail version in O(1)
+ * @param stack Handle to advance
+ * @param value Pointer to store the popped value
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult persistent_stack_pop(PersistentStack* stack, int* value);
+
+/**
+ * @brief Peeks at the top value of a version
+ * @param stack Handle to inspect
+ * @param value Pointer to store the top value
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult persistent_stack_peek(const PersistentStack* stack, int* value);
+
+/**
+ * @brief Creates an independent handle to the same version in O(1)
+ * @param source Handle to clone
+ * @param clone Handle to initialize with a new reference
+ * @return STACK_SUCCESS on success, error code on failure
+ *
+ * Both handles may be pushed and popped independently afterwards.
+ */
+StackResult persistent_stack_clone(const PersistentStack* source, PersistentStack* clone);
+
+/**
+ * @brief Captures the current version of a working stack in O(1)
+ * @param stack Working handle
+ * @param snapshot Handle to initialize with the captured version
+ * @return STACK_SUCCESS on success, error code on failure
+ *
+ * Equivalent to persistent_stack_clone(); provided for speculative code
+ * that reads better as "snapshot now, restore on failure".
+ */
+StackResult persistent_stack_snapshot(const PersistentStack* stack, PersistentStack* snapshot);
+
+/**
+ * @brief Releases a handle's reference, reclaiming unshared nodes
+ * @param stack Handle to release; left empty but still bound to its pool
+ */
+void persistent_stack_release(PersistentStack* stack);
+
+/**
+ * @brief Checks if a version is empty
+ * @param stack Handle to inspect
+ * @return true if empty or NULL, false otherwise
+ */
+bool persistent_stack_is_empty(const PersistentStack* stack);
+
+/**
+ * @brief Gets the number of elements in a version
+ * @param stack Handle to inspect
+ * @return Number of elements, or 0 if stack is NULL
+ */
+size_t persistent_stack_size(const PersistentStack* stack);
+
+#endif /* PERSISTENT_STACK_H */
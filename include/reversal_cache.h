@@ -0,0 +1,95 @@
+/**
+ * @file reversal_cache.h
+ * @brief Memoizing Reversal Cache Interface
+ * @author Jaden Mardini
+ *
+ * This header defines a bounded, thread-safe cache of string reversals for
+ * workloads that reverse the same keys again and again. A hit copies the
+ * stored reversal instead of recomputing it; a miss reverses the input and
+ * remembers the result. The cache is split into independently locked
+ * shards chosen by the input's hash, and each shard evicts with the CLOCK
+ * algorithm once its share of the byte budget is used, so frequently hit
+ * keys survive a stream of one-off inputs.
+ */
+
+#ifndef REVERSAL_CACHE_H
+#define REVERSAL_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Forward declaration for opaque cache structure */
+typedef struct ReversalCache ReversalCache;
+
+/* Error codes for cached reversal */
+typedef enum {
+    REVERSAL_CACHE_SUCCESS = 0,
+    REVERSAL_CACHE_ERROR_NULL_POINTER,
+    REVERSAL_CACHE_ERROR_BUFFER_TOO_SMALL
+} ReversalCacheResult;
+
+/* Counters summed over all shards */
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    size_t entries;             /* Strings currently cached */
+    size_t bytes;               /* Bytes charged against the budget */
+} ReversalCacheStats;
+
+/**
+ * @brief Creates a reversal cache
+ * @param byte_budget Most bytes the cache may hold, including per-entry overhead
+ * @param shard_count Number of shards, or 0 for one per online CPU
+ * @return Pointer to new cache or NULL on failure
+ *
+ * The budget is split evenly across shards; an input whose entry would
+ * not fit in one shard's share is reversed but never cached.
+ */
+ReversalCache* reversal_cache_create(size_t byte_budget, size_t shard_count);
+
+/**
+ * @brief Destroys a cache and frees all associated memory
+ * @param cache Pointer to cache to destroy
+ */
+void reversal_cache_destroy(ReversalCache* cache);
+
+/**
+ * @brief Reverses a buffer, reusing a cached result when the input was seen before
+ * @param cache Pointer to the cache
+ * @param input Bytes to reverse
+ * @param length Number of bytes in input
+ * @param output Buffer receiving the NUL-terminated result
+ * @param output_size Size of output in bytes; at least length + 1
+ * @return REVERSAL_CACHE_SUCCESS on success, error code on failure
+ *
+ * Running out of memory for a new entry is not an error: the result is
+ * still produced, just not cached.
+ */
+ReversalCacheResult reversal_cache_reverse(ReversalCache* cache, const char* input, size_t length,
+                                           char* output, size_t output_size);
+
+/**
+ * @brief Reads the cache counters
+ * @param cache Pointer to the cache
+ * @param stats Pointer to receive the counters
+ *
+ * Shards are read one at a time, so under concurrent use the totals are
+ * a close snapshot rather than an exact one.
+ */
+void reversal_cache_stats(ReversalCache* cache, ReversalCacheStats* stats);
+
+/**
+ * @brief Removes every entry and resets the counters
+ * @param cache Pointer to the cache
+ */
+void reversal_cache_clear(ReversalCache* cache);
+
+/**
+ * @brief Converts error code to human-readable string
+ * @param result Error code to convert
+ * @return String description of the error
+ */
+const char* reversal_cache_error_string(ReversalCacheResult result);
+
+#endif /* REVERSAL_CACHE_H */
@@ -0,0 +1,98 @@
+/**
+ * @file reversal_server.h
+ * @brief Local Reversal Service Interface
+ * @author Jaden Mardini
+ *
+ * This header defines a string reversal daemon that serves other processes
+ * on the same host over a Unix domain stream socket, so they can share one
+ * warm service instead of each linking its own. A request is a 4-byte
+ * big-endian length followed by that many bytes; the response has the
+ * same framing and carries the bytes reversed. Clients may pipeline any
+ * number of requests on one connection and responses come back in
+ * request order. Worker threads each run their own epoll loop and accept
+ * connections from the shared listening socket, so connections spread
+ * over the workers without a central dispatcher. Linux only; elsewhere
+ * starting a server reports REVERSAL_SERVER_ERROR_UNSUPPORTED.
+ */
+
+#ifndef REVERSAL_SERVER_H
+#define REVERSAL_SERVER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Bytes in a frame's length prefix */
+#define REVERSAL_SERVER_HEADER_SIZE 4
+
+/* Default largest accepted request body */
+#define REVERSAL_SERVER_DEFAULT_MAX_REQUEST (1024u * 1024u)
+
+/* Forward declaration for opaque server structure */
+typedef struct ReversalServer ReversalServer;
+
+/* Server configuration */
+typedef struct {
+    const char* socket_path;    /* Filesystem path of the listening socket */
+    size_t thread_count;        /* Worker threads, or 0 for one per online CPU */
+    size_t max_request;         /* Larger requests close the connection */
+} ReversalServerOptions;
+
+/* Error codes for the reversal server */
+typedef enum {
+    REVERSAL_SERVER_SUCCESS = 0,
+    REVERSAL_SERVER_ERROR_NULL_POINTER,
+    REVERSAL_SERVER_ERROR_INVALID_OPTIONS,
+    REVERSAL_SERVER_ERROR_SOCKET,
+    REVERSAL_SERVER_ERROR_MEMORY_ALLOCATION,
+    REVERSAL_SERVER_ERROR_THREAD,
+    REVERSAL_SERVER_ERROR_UNSUPPORTED
+} ReversalServerResult;
+
+/**
+ * @brief Fills options with defaults: one worker per CPU and a 1 MiB request limit
+ * @param options Options to initialize; socket_path is set to NULL
+ */
+void reversal_server_options_init(ReversalServerOptions* options);
+
+/**
+ * @brief Binds the socket and starts the worker threads
+ * @param options Server configuration
+ * @param server Pointer to receive the running server
+ * @return REVERSAL_SERVER_SUCCESS on success, error code on failure
+ *
+ * A socket left at socket_path by a server that is no longer running is
+ * replaced; any other existing file, or a socket another server is
+ * listening on, makes the call fail with REVERSAL_SERVER_ERROR_SOCKET and
+ * is left untouched. The socket file is removed again when the server
+ * stops.
+ */
+ReversalServerResult reversal_server_start(const ReversalServerOptions* options, ReversalServer** server);
+
+/**
+ * @brief Stops the workers, closes every connection and frees the server
+ * @param server Server to stop
+ */
+void reversal_server_stop(ReversalServer* server);
+
+/**
+ * @brief Runs a server until the process receives SIGINT or SIGTERM
+ * @param options Server configuration
+ * @return REVERSAL_SERVER_SUCCESS after a clean shutdown, error code on failure
+ */
+ReversalServerResult reversal_server_serve(const ReversalServerOptions* options);
+
+/**
+ * @brief Returns the number of requests answered so far
+ * @param server Pointer to the server
+ * @return Request count, or 0 if server is NULL
+ */
+uint64_t reversal_server_request_count(const ReversalServer* server);
+
+/**
+ * @brief Converts error code to human-readable string
+ * @param result Error code to convert
+ * @return String description of the error
+ */
+const char* reversal_server_error_string(ReversalServerResult result);
+
+#endif /* REVERSAL_SERVER_H */
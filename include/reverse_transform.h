@@ -0,0 +1,66 @@
+/**
+ * @file reverse_transform.h
+ * @brief Fused Reverse-and-Transform Interface
+ * @author Jaden Mardini
+ *
+ * This header defines string reversal fused with a per-byte transform, so
+ * that reversing and case-folding, or reversing and dropping non-printable
+ * bytes, is one pass that reads every input byte once and writes every
+ * output byte once instead of a reversal followed by a second pass.
+ */
+
+#ifndef REVERSE_TRANSFORM_H
+#define REVERSE_TRANSFORM_H
+
+#include <stddef.h>
+
+/* Transform applied to each byte as it is reversed */
+typedef enum {
+    REVERSE_TRANSFORM_NONE = 0,     /* Plain reversal */
+    REVERSE_TRANSFORM_UPPER,        /* ASCII letters to upper case */
+    REVERSE_TRANSFORM_LOWER,        /* ASCII letters to lower case */
+    REVERSE_TRANSFORM_FILTER,       /* Drop bytes the character stack would reject */
+    REVERSE_TRANSFORM_REPLACE,      /* Replace those bytes with a replacement byte */
+    REVERSE_TRANSFORM_MAP           /* Map every byte through a 256-entry table */
+} ReverseTransformKind;
+
+/* Transform description */
+typedef struct {
+    ReverseTransformKind kind;
+    char replacement;               /* REVERSE_TRANSFORM_REPLACE: substitute byte */
+    const unsigned char* map;       /* REVERSE_TRANSFORM_MAP: output byte for each input byte */
+} ReverseTransform;
+
+/* Error codes for fused reversal */
+typedef enum {
+    REVERSE_TRANSFORM_SUCCESS = 0,
+    REVERSE_TRANSFORM_ERROR_NULL_POINTER,
+    REVERSE_TRANSFORM_ERROR_INVALID_TRANSFORM,
+    REVERSE_TRANSFORM_ERROR_BUFFER_TOO_SMALL
+} ReverseTransformResult;
+
+/**
+ * @brief Reverses a buffer while applying a transform to every byte
+ * @param input Bytes to reverse
+ * @param length Number of bytes in input
+ * @param output Buffer receiving the NUL-terminated result
+ * @param output_size Size of output in bytes; at least length + 1
+ * @param transform Transform to apply, or NULL for plain reversal
+ * @param output_length Optional pointer to receive the result length
+ * @return REVERSE_TRANSFORM_SUCCESS on success, error code on failure
+ *
+ * The bytes the character stack rejects, and that FILTER and REPLACE act
+ * on, are those outside printable ASCII (0x20-0x7E) other than tab. output
+ * may not overlap input.
+ */
+ReverseTransformResult reverse_transform(const char* input, size_t length, char* output, size_t output_size,
+                                         const ReverseTransform* transform, size_t* output_length);
+
+/**
+ * @brief Converts error code to human-readable string
+ * @param result Error code to convert
+ * @return String description of the error
+ */
+const char* reverse_transform_error_string(ReverseTransformResult result);
+
+#endif /* REVERSE_TRANSFORM_H */
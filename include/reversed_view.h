@@ -0,0 +1,133 @@
+/**
+ * @file reversed_view.h
+ * @brief Lazy Reversed String View Interface
+ * @author Jaden Mardini
+ *
+ * This header defines a read-only view of a buffer in reverse order. Code
+ * that only hashes, compares or writes out a reversed string can work on
+ * the view directly instead of first reversing the whole string into an
+ * output buffer: the view is reversed a block at a time into a small
+ * scratch buffer that stays in L1 cache, and the full reversed copy is
+ * never built. The viewed buffer must outlive the view and stay unchanged
+ * while it is used.
+ */
+
+#ifndef REVERSED_VIEW_H
+#define REVERSED_VIEW_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Bytes yielded per iteration step */
+#define REVERSED_VIEW_BLOCK_SIZE 256
+
+/* Reversed view of data[0..length) */
+typedef struct {
+    const char* data;
+    size_t length;
+} ReversedView;
+
+/* Block-wise iterator over a reversed view */
+typedef struct {
+    ReversedView view;
+    size_t remaining;                       /* Bytes of data not yet yielded */
+    char block[REVERSED_VIEW_BLOCK_SIZE];   /* Scratch receiving each reversed block */
+} ReversedViewIterator;
+
+/* Error codes for reversed view operations */
+typedef enum {
+    REVERSED_VIEW_SUCCESS = 0,
+    REVERSED_VIEW_ERROR_NULL_POINTER,
+    REVERSED_VIEW_ERROR_BUFFER_TOO_SMALL,
+    REVERSED_VIEW_ERROR_IO
+} ReversedViewResult;
+
+/**
+ * @brief Creates a reversed view of a buffer
+ * @param data Buffer to view; may be NULL only if length is 0
+ * @param length Number of bytes in data
+ * @return View whose first byte is data[length - 1]
+ */
+ReversedView reversed_view_make(const char* data, size_t length);
+
+/**
+ * @brief Returns one byte of the view
+ * @param view View to read
+ * @param index Position in reversed order; must be less than view.length
+ * @return data[length - 1 - index]
+ */
+char reversed_view_at(ReversedView view, size_t index);
+
+/**
+ * @brief Starts block-wise iteration over a view
+ * @param iterator Iterator to initialize
+ * @param view View to iterate
+ */
+void reversed_view_iterator_init(ReversedViewIterator* iterator, ReversedView view);
+
+/**
+ * @brief Reverses the next block of the view into the iterator's scratch buffer
+ * @param iterator Iterator to advance
+ * @param block Pointer to receive the start of the block
+ * @return Number of bytes in the block, or 0 when the view is exhausted
+ *
+ * Blocks are REVERSED_VIEW_BLOCK_SIZE bytes except possibly the last, and
+ * stay valid until the next call.
+ */
+size_t reversed_view_next_block(ReversedViewIterator* iterator, const char** block);
+
+/**
+ * @brief Hashes the view's bytes in reversed order
+ * @param view View to hash
+ * @return 64-bit FNV-1a hash, equal to the hash of the materialized reversal
+ */
+uint64_t reversed_view_hash(ReversedView view);
+
+/**
+ * @brief Compares the view with a buffer as memcmp() would
+ * @param view View to compare
+ * @param other Buffer to compare against; may be NULL only if other_length is 0
+ * @param other_length Number of bytes in other
+ * @return Negative, zero or positive as the view sorts before, equal to or
+ *         after other; a proper prefix sorts first
+ */
+int reversed_view_compare(ReversedView view, const char* other, size_t other_length);
+
+/**
+ * @brief Tests whether the view reads the same as a buffer
+ * @param view View to compare
+ * @param other Buffer to compare against
+ * @param other_length Number of bytes in other
+ * @return true if the lengths and bytes match
+ */
+bool reversed_view_equals(ReversedView view, const char* other, size_t other_length);
+
+/**
+ * @brief Copies the view into a NUL-terminated buffer
+ * @param view View to copy
+ * @param output Buffer receiving the reversed bytes; may not overlap the view
+ * @param output_size Size of output in bytes; at least view.length + 1
+ * @return REVERSED_VIEW_SUCCESS on success, error code on failure
+ */
+ReversedViewResult reversed_view_copy(ReversedView view, char* output, size_t output_size);
+
+/**
+ * @brief Writes the view to a file descriptor
+ * @param view View to write
+ * @param fd Open file descriptor
+ * @return REVERSED_VIEW_SUCCESS on success, REVERSED_VIEW_ERROR_IO if a write fails
+ *
+ * Short writes are continued and interrupted writes retried, so on
+ * success every byte was written.
+ */
+ReversedViewResult reversed_view_write_fd(ReversedView view, int fd);
+
+/**
+ * @brief Converts error code to human-readable string
+ * @param result Error code to convert
+ * @return String description of the error
+ */
+const char* reversed_view_error_string(ReversedViewResult result);
+
+#endif /* REVERSED_VIEW_H */
@@ -0,0 +1,87 @@
+/**
+ * @file sharded_stack.h
+ * @brief Sharded Stack Pool Interface
+ * @author Jaden Mardini
+ *
+ * This header defines a stack split into per-thread shards for free-list
+ * and buffer-recycling workloads, where any free item will do and strict
+ * global LIFO order does not matter. Each thread pushes to and pops from
+ * its own shard, an ordinary Stack behind a lock that is almost never
+ * contended, and only when that shard is empty does it steal a batch from
+ * another shard. Items pop LIFO within a shard but in no global order.
+ */
+
+#ifndef SHARDED_STACK_H
+#define SHARDED_STACK_H
+
+#include <stddef.h>
+#include "dynamic_stack.h"
+
+/* Largest number of items moved by one steal */
+#define SHARDED_STACK_STEAL_BATCH 32
+
+/* Forward declaration for opaque sharded stack structure */
+typedef struct ShardedStack ShardedStack;
+
+/**
+ * @brief Creates a sharded stack
+ * @param shard_count Number of shards, or 0 for one per online CPU
+ * @param shard_capacity Capacity of each shard
+ * @return Pointer to new sharded stack or NULL on failure
+ *
+ * Threads are assigned shards round-robin on first use, so with at least
+ * as many shards as threads no two threads share one.
+ */
+ShardedStack* sharded_stack_create(size_t shard_count, size_t shard_capacity);
+
+/**
+ * @brief Destroys a sharded stack and frees all associated memory
+ * @param stack Pointer to sharded stack to destroy
+ */
+void sharded_stack_destroy(ShardedStack* stack);
+
+/**
+ * @brief Pushes a value onto the calling thread's shard
+ * @param stack Pointer to the sharded stack
+ * @param value Value to push
+ * @return STACK_SUCCESS on success, STACK_ERROR_OVERFLOW if every shard is full
+ *
+ * When the thread's own shard is full the value goes to the next shard
+ * with room.
+ */
+StackResult sharded_stack_push(ShardedStack* stack, int value);
+
+/**
+ * @brief Pops a value, stealing a batch from another shard if the own shard is empty
+ * @param stack Pointer to the sharded stack
+ * @param value Pointer to store popped value
+ * @return STACK_SUCCESS on success, STACK_ERROR_UNDERFLOW if no value was found
+ *
+ * Shards locked by other threads are skipped and retried a few times, so
+ * under heavy contention a pop may report underflow while a busy shard
+ * still holds values.
+ */
+StackResult sharded_stack_pop(ShardedStack* stack, int* value);
+
+/**
+ * @brief Returns the approximate number of values across all shards
+ * @param stack Pointer to the sharded stack
+ * @return Sum of per-shard counters, exact when no push or pop is in progress
+ */
+size_t sharded_stack_size_approx(const ShardedStack* stack);
+
+/**
+ * @brief Returns the number of shards
+ * @param stack Pointer to the sharded stack
+ * @return Shard count, or 0 if stack is NULL
+ */
+size_t sharded_stack_shard_count(const ShardedStack* stack);
+
+/**
+ * @brief Returns the number of successful batch steals so far
+ * @param stack Pointer to the sharded stack
+ * @return Steal count, or 0 if stack is NULL
+ */
+size_t sharded_stack_steal_count(const ShardedStack* stack);
+
+#endif /* SHARDED_STACK_H */
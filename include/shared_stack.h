@@ -0,0 +1,100 @@
+/**
+ * @file shared_stack.h
+ * @brief Shared-Memory Cross-Process Stack Interface
+ * @author Jaden Mardini
+ *
+ * This header defines a bounded integer stack that lives entirely in a
+ * named POSIX shared memory object, so cooperating processes on one host
+ * can hand work items to each other without a pipe or serialization. One
+ * process creates the stack; others attach to it by name and may push
+ * and pop concurrently. The region contains no pointers, only slot
+ * indices, so each process may map it at a different address.
+ *
+ * Operations are lock-free: no process ever waits on another, so a
+ * process that crashes while attached cannot block the rest. If it dies
+ * in the middle of a push or pop, the one slot it was moving is lost to
+ * the stack's capacity and everything else stays consistent.
+ */
+
+#ifndef SHARED_STACK_H
+#define SHARED_STACK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "dynamic_stack.h"
+
+/* Largest capacity; slot indices are stored in 32 bits */
+#define SHARED_STACK_MAX_CAPACITY 0x7FFFFFFFu
+
+/* Forward declaration for opaque shared stack handle */
+typedef struct SharedStack SharedStack;
+
+/**
+ * @brief Creates a named shared stack and attaches to it
+ * @param name Shared memory object name, starting with '/'
+ * @param capacity Maximum number of values
+ * @return Handle to the new stack or NULL on failure, including when the name exists
+ */
+SharedStack* shared_stack_create(const char* name, size_t capacity);
+
+/**
+ * @brief Attaches to a shared stack created by another process
+ * @param name Name the stack was created with
+ * @return Handle to the stack or NULL if it does not exist or is not a shared stack
+ */
+SharedStack* shared_stack_attach(const char* name);
+
+/**
+ * @brief Unmaps a shared stack from this process and frees the handle
+ * @param stack Handle to detach
+ *
+ * The stack and its contents remain for other processes until the name is
+ * unlinked and the last process has detached.
+ */
+void shared_stack_detach(SharedStack* stack);
+
+/**
+ * @brief Removes a shared stack's name so no new process can attach
+ * @param name Name the stack was created with
+ * @return STACK_SUCCESS on success, STACK_ERROR_IO if no such object could be removed
+ */
+StackResult shared_stack_unlink(const char* name);
+
+/**
+ * @brief Pushes a value
+ * @param stack Handle to the shared stack
+ * @param value Value to push
+ * @return STACK_SUCCESS on success, STACK_ERROR_OVERFLOW if full
+ */
+StackResult shared_stack_push(SharedStack* stack, int value);
+
+/**
+ * @brief Pops the most recently pushed value
+ * @param stack Handle to the shared stack
+ * @param value Pointer to store popped value
+ * @return STACK_SUCCESS on success, STACK_ERROR_UNDERFLOW if empty
+ */
+StackResult shared_stack_pop(SharedStack* stack, int* value);
+
+/**
+ * @brief Returns the number of values on a shared stack
+ * @param stack Handle to the shared stack
+ * @return Number of values, or 0 if stack is NULL; a snapshot while other processes run
+ */
+size_t shared_stack_size(const SharedStack* stack);
+
+/**
+ * @brief Returns the capacity a shared stack was created with
+ * @param stack Handle to the shared stack
+ * @return Capacity, or 0 if stack is NULL
+ */
+size_t shared_stack_capacity(const SharedStack* stack);
+
+/**
+ * @brief Checks if a shared stack is empty
+ * @param stack Handle to the shared stack
+ * @return true if empty or NULL, false otherwise; a snapshot while other processes run
+ */
+bool shared_stack_is_empty(const SharedStack* stack);
+
+#endif /* SHARED_STACK_H */
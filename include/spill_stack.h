@@ -0,0 +1,111 @@
+/**
+ * @file spill_stack.h
+ * @brief Spill-to-Disk Stack Interface
+ * @author Jaden Mardini
+ *
+ * This header defines an unbounded integer stack that holds at most a
+ * configured number of bytes in memory. Values live in fixed-size
+ * segments; once the resident segments exceed the budget, the bottom one
+ * is written to an anonymous temporary file in one sequential block.
+ * The top segment is always resident, so push and pop cost the same as
+ * on an in-memory stack except when they cross a segment boundary. As
+ * pops work down towards the spilled segments, a background thread reads
+ * the next one back before it is needed.
+ */
+
+#ifndef SPILL_STACK_H
+#define SPILL_STACK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "dynamic_stack.h"
+
+/*
+ * Values per segment, the unit of spilling and prefetching. Override with
+ * -DSPILL_STACK_SEGMENT_VALUES=N.
+ */
+#ifndef SPILL_STACK_SEGMENT_VALUES
+#define SPILL_STACK_SEGMENT_VALUES 65536
+#endif
+
+/* Smallest budget, in segments, a spill stack works with */
+#define SPILL_STACK_MIN_SEGMENTS 5
+
+/* Forward declaration for opaque spill stack structure */
+typedef struct SpillStack SpillStack;
+
+/* Memory and I/O counters of a spill stack */
+typedef struct {
+    size_t resident_segments;   /* Segments in memory, including the top */
+    size_t spilled_segments;    /* Segments currently only in the spill file */
+    uint64_t bytes_written;     /* Bytes written to the spill file */
+    uint64_t bytes_read;        /* Bytes read back from it */
+    uint64_t prefetch_hits;     /* Segments that were already read back when needed */
+    uint64_t prefetch_misses;   /* Segments the popping thread had to wait for */
+} SpillStackStats;
+
+/**
+ * @brief Creates an empty spill stack
+ * @param memory_budget Bytes of segment memory to use, rounded down to whole
+ *                      segments and raised to SPILL_STACK_MIN_SEGMENTS
+ * @param directory Directory for the spill file, or NULL for $TMPDIR or /tmp
+ * @return Pointer to new spill stack or NULL on failure
+ *
+ * The spill file is created on the first spill and unlinked at once, so
+ * it disappears when the stack is destroyed or the process exits.
+ */
+SpillStack* spill_stack_create(size_t memory_budget, const char* directory);
+
+/**
+ * @brief Destroys a spill stack, its spill file and its I/O thread
+ * @param stack Pointer to spill stack to destroy
+ */
+void spill_stack_destroy(SpillStack* stack);
+
+/**
+ * @brief Pushes a value, spilling the bottom resident segment if the budget requires it
+ * @param stack Pointer to the spill stack
+ * @param value Value to push
+ * @return STACK_SUCCESS on success, STACK_ERROR_IO if a spill failed
+ */
+StackResult spill_stack_push(SpillStack* stack, int value);
+
+/**
+ * @brief Pops the top value, reading a spilled segment back if needed
+ * @param stack Pointer to the spill stack
+ * @param value Pointer to store popped value
+ * @return STACK_SUCCESS on success, STACK_ERROR_IO if a read failed
+ */
+StackResult spill_stack_pop(SpillStack* stack, int* value);
+
+/**
+ * @brief Reads the top value without removing it
+ * @param stack Pointer to the spill stack
+ * @param value Pointer to store top value
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult spill_stack_peek(const SpillStack* stack, int* value);
+
+/**
+ * @brief Checks if a spill stack is empty
+ * @param stack Pointer to the spill stack
+ * @return true if empty or NULL, false otherwise
+ */
+bool spill_stack_is_empty(const SpillStack* stack);
+
+/**
+ * @brief Returns the number of values on a spill stack
+ * @param stack Pointer to the spill stack
+ * @return Number of values, or 0 if stack is NULL
+ */
+size_t spill_stack_size(const SpillStack* stack);
+
+/**
+ * @brief Reports memory use and spill file traffic
+ * @param stack Pointer to the spill stack
+ * @param stats Receives the counters; zeroed if stack is NULL
+ */
+void spill_stack_stats(const SpillStack* stack, SpillStackStats* stats);
+
+#endif /* SPILL_STACK_H */
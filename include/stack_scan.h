@@ -0,0 +1,57 @@
+/**
+ * @file stack_scan.h
+ * @brief Read-Only Bulk Operations over Stack Contents
+ * @author Jaden Mardini
+ *
+ * This header defines searches, counts, sums and copies over the live
+ * elements of a Stack. They read the elements in place through
+ * stack_data(), several at a time with SIMD where available, and never
+ * pop, modify or wipe anything, so inspecting a stack for monitoring or
+ * debugging costs one linear read instead of popping and re-pushing
+ * every element.
+ */
+
+#ifndef STACK_SCAN_H
+#define STACK_SCAN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "dynamic_stack.h"
+
+/**
+ * @brief Finds the occurrence of a value nearest the top
+ * @param stack Pointer to the stack
+ * @param value Value to look for
+ * @param depth Receives the distance from the top (0 is the top element); may be NULL
+ * @return true if the value is on the stack, false otherwise or if stack is NULL
+ */
+bool stack_find(const Stack* stack, int value, size_t* depth);
+
+/**
+ * @brief Counts the occurrences of a value
+ * @param stack Pointer to the stack
+ * @param value Value to count
+ * @return Number of elements equal to value, or 0 if stack is NULL
+ */
+size_t stack_count(const Stack* stack, int value);
+
+/**
+ * @brief Adds up every element
+ * @param stack Pointer to the stack
+ * @return Sum of the elements, computed without overflow, or 0 if stack is NULL
+ */
+int64_t stack_sum(const Stack* stack);
+
+/**
+ * @brief Copies elements out in the given order
+ * @param stack Pointer to the stack
+ * @param output Buffer for the elements
+ * @param max_count Capacity of output in elements
+ * @param order STACK_ORDER_TOP_DOWN copies the top max_count elements, top
+ *              first; STACK_ORDER_BOTTOM_UP the bottom max_count, bottom first
+ * @return Number of elements copied, or 0 if stack or output is NULL
+ */
+size_t stack_copy_out(const Stack* stack, int* output, size_t max_count, StackOrder order);
+
+#endif /* STACK_SCAN_H */
@@ -0,0 +1,130 @@
+/**
+ * @file stack_vm.h
+ * @brief Bytecode Stack Virtual Machine Interface
+ * @author Jaden Mardini
+ *
+ * This header defines a small stack machine for integer expressions. RPN
+ * or infix text is compiled once into compact bytecode, with the operand
+ * stack depth checked and constant subexpressions folded at compile time,
+ * and the bytecode is then run as often as needed with threaded-code
+ * dispatch. Expressions read their inputs as $0, $1, ... so one program
+ * can be evaluated over many input vectors in a batch.
+ *
+ * Arithmetic wraps on overflow like unsigned arithmetic, INT_MIN / -1 is
+ * INT_MIN, and division or remainder by zero is a runtime error.
+ */
+
+#ifndef STACK_VM_H
+#define STACK_VM_H
+
+#include <stddef.h>
+#include "dynamic_stack.h"
+
+/* Constants */
+#define STACK_VM_MAX_DEPTH 256      /* Deepest operand stack a program may use */
+#define STACK_VM_MAX_INPUTS 256     /* Inputs addressable as $0 .. $255 */
+
+/* Forward declaration for opaque program structure */
+typedef struct StackVmProgram StackVmProgram;
+
+/* Source syntax accepted by stack_vm_compile() */
+typedef enum {
+    STACK_VM_SYNTAX_RPN = 0,    /* "$0 $1 + 3 *"; also neg, min, max, dup, swap, drop */
+    STACK_VM_SYNTAX_INFIX       /* "($0 + $1) * 3"; + - * / % with unary minus and parentheses */
+} StackVmSyntax;
+
+/* Error codes for compilation and execution */
+typedef enum {
+    STACK_VM_SUCCESS = 0,
+    STACK_VM_ERROR_NULL_POINTER,
+    STACK_VM_ERROR_MEMORY_ALLOCATION,
+    STACK_VM_ERROR_SYNTAX,
+    STACK_VM_ERROR_UNDERFLOW,
+    STACK_VM_ERROR_TOO_DEEP,
+    STACK_VM_ERROR_MISSING_INPUT,
+    STACK_VM_ERROR_DIVISION_BY_ZERO,
+    STACK_VM_ERROR_STACK_FULL
+} StackVmResult;
+
+/**
+ * @brief Compiles expression text into a program
+ * @param source Expression text
+ * @param length Number of bytes in source
+ * @param syntax Syntax of source
+ * @param program Receives the new program on success
+ * @param error_offset Optional pointer to receive the byte offset of a compile error
+ * @return STACK_VM_SUCCESS on success, error code on failure
+ *
+ * Integer literals must fit in an int. A program must leave at least one
+ * value on the operand stack, and no point of it may pop more than it has
+ * pushed (STACK_VM_ERROR_UNDERFLOW) or hold more than STACK_VM_MAX_DEPTH
+ * values (STACK_VM_ERROR_TOO_DEEP).
+ */
+StackVmResult stack_vm_compile(const char* source, size_t length, StackVmSyntax syntax,
+                               StackVmProgram** program, size_t* error_offset);
+
+/**
+ * @brief Destroys a program
+ * @param program Pointer to program to destroy
+ */
+void stack_vm_destroy(StackVmProgram* program);
+
+/**
+ * @brief Runs a program and pushes the values it leaves onto a stack
+ * @param program Compiled program
+ * @param inputs Values of $0, $1, ...; may be NULL if the program reads none
+ * @param input_count Number of inputs
+ * @param stack Stack receiving the results, bottom-most first
+ * @return STACK_VM_SUCCESS on success, error code on failure
+ *
+ * On failure nothing is pushed.
+ */
+StackVmResult stack_vm_run(const StackVmProgram* program, const int* inputs, size_t input_count,
+                           Stack* stack);
+
+/**
+ * @brief Runs a program once per input vector, keeping the top result of each
+ * @param program Compiled program
+ * @param inputs vector_count vectors of input_stride values each
+ * @param input_stride Values per vector; at least stack_vm_input_count(program)
+ * @param vector_count Number of vectors
+ * @param results Receives vector_count results
+ * @param failed_index Optional pointer to receive the index of a failing vector
+ * @return STACK_VM_SUCCESS on success, or the error of the first failing vector
+ *
+ * Results before the failing vector are written; later ones are not.
+ */
+StackVmResult stack_vm_run_batch(const StackVmProgram* program, const int* inputs, size_t input_stride,
+                                 size_t vector_count, int* results, size_t* failed_index);
+
+/**
+ * @brief Returns the number of inputs a program reads (highest $N plus one)
+ * @param program Compiled program
+ * @return Input count, or 0 if program is NULL
+ */
+size_t stack_vm_input_count(const StackVmProgram* program);
+
+/**
+ * @brief Returns the number of instructions executed per run
+ * @param program Compiled program
+ * @return Instruction count excluding the final halt, or 0 if program is NULL
+ *
+ * Programs have no branches, so every run executes each instruction once.
+ */
+size_t stack_vm_instruction_count(const StackVmProgram* program);
+
+/**
+ * @brief Returns the size of a program's bytecode
+ * @param program Compiled program
+ * @return Bytecode size in bytes, or 0 if program is NULL
+ */
+size_t stack_vm_code_size(const StackVmProgram* program);
+
+/**
+ * @brief Converts error code to human-readable string
+ * @param result Error code to convert
+ * @return String description of the error
+ */
+const char* stack_vm_error_string(StackVmResult result);
+
+#endif /* STACK_VM_H */
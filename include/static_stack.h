@@ -22,9 +22,39 @@ typedef enum {
     CHAR_STACK_SUCCESS = 0,
     CHAR_STACK_ERROR_OVERFLOW,
     CHAR_STACK_ERROR_UNDERFLOW,
-    CHAR_STACK_ERROR_INVALID_INPUT
+    CHAR_STACK_ERROR_INVALID_INPUT,
+    CHAR_STACK_ERROR_MEMORY_ALLOCATION
 } CharStackResult;
 
+/* Behaviour when a sized stack outgrows its inline storage */
+typedef enum {
+    CHAR_STACK_SPILL_NONE = 0,  /* Report CHAR_STACK_ERROR_OVERFLOW */
+    CHAR_STACK_SPILL_HEAP       /* Move contents to a growing heap buffer */
+} CharStackSpillPolicy;
+
+/*
+ * Character stack with caller-chosen inline capacity. Declare one with
+ * CHAR_STACK_DEFINE so its storage lives on the caller's stack; call
+ * sized_char_stack_release() when done if it may have spilled.
+ */
+typedef struct {
+    char* elements;                     /* Active storage (inline or heap) */
+    size_t size;                        /* Current number of elements */
+    size_t capacity;                    /* Capacity of active storage */
+    char* inline_elements;              /* Caller-provided storage */
+    size_t inline_capacity;             /* Size of caller-provided storage */
+    CharStackSpillPolicy spill_policy;  /* Overflow behaviour */
+} SizedCharStack;
+
+/* Static initializer over existing storage */
+#define CHAR_STACK_INITIALIZER(storage, inline_size, policy) \
+    { (storage), 0, (inline_size), (storage), (inline_size), (policy) }
+
+/* Declares a sized stack named name with inline_size bytes of storage */
+#define CHAR_STACK_DEFINE(name, inline_size, policy) \
+    char name##_storage[(inline_size)]; \
+    SizedCharStack name = CHAR_STACK_INITIALIZER(name##_storage, (inline_size), (policy))
+
 /**
  * @brief Pushes a character onto the stack
  * @param c Character to push
@@ -92,4 +122,94 @@ const char* char_stack_error_string(CharStackResult result);
  */
 CharStackResult char_stack_reverse_string(const char* input, char* output, size_t max_length);
 
+/**
+ * @brief Initializes a sized stack over caller-provided storage
+ * @param stack Stack to initialize
+ * @param storage Inline storage, at least inline_size bytes
+ * @param inline_size Capacity of the inline storage
+ * @param policy Behaviour when inline storage is exhausted
+ * @return CHAR_STACK_SUCCESS on success, error code on failure
+ */
+CharStackResult sized_char_stack_init(SizedCharStack* stack, char* storage, size_t inline_size,
+                                      CharStackSpillPolicy policy);
+
+/**
+ * @brief Pushes a character, spilling to the heap if allowed
+ * @param stack Pointer to the stack
+ * @param c Character to push
+ * @return CHAR_STACK_SUCCESS on success, error code on failure
+ */
+CharStackResult sized_char_stack_push(SizedCharStack* stack, char c);
+
+/**
+ * @brief Pops a character from the stack
+ * @param stack Pointer to the stack
+ * @param c Pointer to store the popped character
+ * @return CHAR_STACK_SUCCESS on success, error code on failure
+ */
+CharStackResult sized_char_stack_pop(SizedCharStack* stack, char* c);
+
+/**
+ * @brief Peeks at the top character without removing it
+ * @param stack Pointer to the stack
+ * @param c Pointer to store the top character
+ * @return CHAR_STACK_SUCCESS on success, error code on failure
+ */
+CharStackResult sized_char_stack_peek(const SizedCharStack* stack, char* c);
+
+/**
+ * @brief Gets the current number of characters in the stack
+ * @param stack Pointer to the stack
+ * @return Number of characters, or 0 if stack is NULL
+ */
+size_t sized_char_stack_size(const SizedCharStack* stack);
+
+/**
+ * @brief Gets the capacity of the stack's current storage
+ * @param stack Pointer to the stack
+ * @return Capacity, or 0 if stack is NULL
+ */
+size_t sized_char_stack_capacity(const SizedCharStack* stack);
+
+/**
+ * @brief Checks if the stack is empty
+ * @param stack Pointer to the stack
+ * @return true if empty, false otherwise
+ */
+bool sized_char_stack_is_empty(const SizedCharStack* stack);
+
+/**
+ * @brief Checks whether the stack has moved to heap storage
+ * @param stack Pointer to the stack
+ * @return true if spilled, false otherwise
+ */
+bool sized_char_stack_is_spilled(const SizedCharStack* stack);
+
+/**
+ * @brief Clears all characters, keeping any heap storage for reuse
+ * @param stack Pointer to the stack
+ * @return CHAR_STACK_SUCCESS on success, error code on failure
+ */
+CharStackResult sized_char_stack_clear(SizedCharStack* stack);
+
+/**
+ * @brief Clears the stack and frees any heap storage, returning to inline storage
+ * @param stack Pointer to the stack
+ */
+void sized_char_stack_release(SizedCharStack* stack);
+
+/**
+ * @brief Reverses a string using a sized character stack
+ * @param stack Stack to use; cleared before and after use
+ * @param input Input string to reverse
+ * @param output Buffer to store reversed string (must be at least strlen(input)+1)
+ * @param max_length Maximum length of output buffer
+ * @return CHAR_STACK_SUCCESS on success, error code on failure
+ *
+ * Inputs that fit the inline storage never allocate; longer inputs spill
+ * once (with CHAR_STACK_SPILL_HEAP) instead of failing.
+ */
+CharStackResult sized_char_stack_reverse_string(SizedCharStack* stack, const char* input,
+                                                char* output, size_t max_length);
+
 #endif /* STATIC_STACK_H */
@@ -0,0 +1,100 @@
+/**
+ * @file task_pool.h
+ * @brief Work-Stealing Task Pool Interface
+ * @author Jaden Mardini
+ *
+ * This header defines a small fork/join thread pool built on the Chase-Lev
+ * deque. Every worker owns a deque: tasks it spawns are pushed and popped
+ * LIFO at its own end, which keeps recursive work depth-first and cache
+ * warm, and idle workers steal the oldest (largest) tasks from others.
+ * A thread waiting on a task group keeps executing tasks until the group
+ * completes, so recursive spawn/wait never blocks a worker.
+ */
+
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include "dynamic_stack.h"
+
+/* Forward declaration for opaque pool structure */
+typedef struct TaskPool TaskPool;
+
+/* Task entry point */
+typedef void (*TaskFunction)(void* argument);
+
+/* Set of spawned tasks that can be waited on together */
+typedef struct {
+    atomic_size_t pending;  /* Tasks spawned but not yet finished */
+} TaskGroup;
+
+/* Initializer for an empty task group */
+#define TASK_GROUP_INITIALIZER { 0 }
+
+/* Pool-wide counters */
+typedef struct {
+    size_t executed;        /* Tasks run */
+    size_t stolen;          /* Tasks run by a worker other than the spawner */
+} TaskPoolStats;
+
+/**
+ * @brief Creates a pool and starts its worker threads
+ * @param thread_count Total workers including the caller of task_pool_run(),
+ *                     or 0 for one per online CPU
+ * @return Pointer to new pool or NULL on failure
+ */
+TaskPool* task_pool_create(size_t thread_count);
+
+/**
+ * @brief Stops the worker threads and destroys the pool
+ * @param pool Pointer to pool to destroy
+ */
+void task_pool_destroy(TaskPool* pool);
+
+/**
+ * @brief Runs a root task with the calling thread acting as worker 0
+ * @param pool Pointer to the pool
+ * @param function Root task
+ * @param argument Argument passed to the root task
+ * @return STACK_SUCCESS on success, error code on failure
+ *
+ * Other workers steal spawned tasks while the root runs. The root must
+ * wait on every group it spawns into before returning.
+ */
+StackResult task_pool_run(TaskPool* pool, TaskFunction function, void* argument);
+
+/**
+ * @brief Spawns a task into a group from inside a running task
+ * @param group Group the task belongs to
+ * @param function Task to run
+ * @param argument Argument passed to the task
+ * @return STACK_SUCCESS on success, error code on failure
+ *
+ * If the task cannot be queued it is run immediately instead, so a
+ * failure is reported only when called outside a pool task.
+ */
+StackResult task_group_spawn(TaskGroup* group, TaskFunction function, void* argument);
+
+/**
+ * @brief Waits until every task in the group has finished, running other tasks meanwhile
+ * @param group Group to wait on
+ */
+void task_group_wait(TaskGroup* group);
+
+/**
+ * @brief Returns the number of workers in the pool
+ * @param pool Pointer to the pool
+ * @return Worker count, including the caller of task_pool_run()
+ */
+size_t task_pool_thread_count(const TaskPool* pool);
+
+/**
+ * @brief Reads pool-wide counters
+ * @param pool Pointer to the pool
+ * @param stats Receives the counters
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult task_pool_get_stats(const TaskPool* pool, TaskPoolStats* stats);
+
+#endif /* TASK_POOL_H */
@@ -0,0 +1,64 @@
+/**
+ * @file word_reverse.h
+ * @brief Word-Order Reversal Interface
+ * @author Jaden Mardini
+ *
+ * This header defines word-order reversal for tokenized text: the words of
+ * a sentence come out last to first while each word keeps its own spelling.
+ * Delimiter boundaries are found a block at a time with SIMD compares, the
+ * resulting word spans are pushed onto a span stack, and the output is
+ * assembled from the popped spans with bulk copies.
+ */
+
+#ifndef WORD_REVERSE_H
+#define WORD_REVERSE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Constants */
+#define WORD_REVERSE_MAX_DELIMITERS 8
+#define WORD_REVERSE_DEFAULT_DELIMITERS " \t\n\r\v\f"
+
+/* Error codes for word reversal */
+typedef enum {
+    WORD_REVERSE_SUCCESS = 0,
+    WORD_REVERSE_ERROR_NULL_POINTER,
+    WORD_REVERSE_ERROR_INVALID_DELIMITERS,
+    WORD_REVERSE_ERROR_BUFFER_TOO_SMALL
+} WordReverseResult;
+
+/* Reversal options */
+typedef struct {
+    const char* delimiters; /* Bytes separating words; NULL for whitespace */
+    bool collapse;          /* Drop delimiter runs and join words with the first delimiter */
+} WordReverseOptions;
+
+/**
+ * @brief Reverses the order of words in a buffer
+ * @param input Text to reverse
+ * @param length Number of bytes in input
+ * @param output Buffer receiving the NUL-terminated result
+ * @param output_size Size of output in bytes
+ * @param options Reversal options, or NULL for whitespace without collapsing
+ * @param output_length Optional pointer to receive the result length
+ * @return WORD_REVERSE_SUCCESS on success, error code on failure
+ *
+ * Without collapsing, delimiter runs are kept and reversed along with the
+ * words, so "a  b c" becomes "c b  a" and the output is exactly as long as
+ * the input. With collapsing, leading and trailing delimiters are dropped
+ * and runs become a single delimiter, so "  a  b c " becomes "c b a".
+ * output may not overlap input, and bytes of output past the result may
+ * be used as scratch space.
+ */
+WordReverseResult word_reverse(const char* input, size_t length, char* output, size_t output_size,
+                               const WordReverseOptions* options, size_t* output_length);
+
+/**
+ * @brief Converts error code to human-readable string
+ * @param result Error code to convert
+ * @return String description of the error
+ */
+const char* word_reverse_error_string(WordReverseResult result);
+
+#endif /* WORD_REVERSE_H */
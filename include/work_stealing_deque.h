@@ -0,0 +1,71 @@
+/**
+ * @file work_stealing_deque.h
+ * @brief Chase-Lev Work-Stealing Deque Interface
+ * @author Jaden Mardini
+ *
+ * This header defines a lock-free per-worker task stack for schedulers.
+ * The owning thread pushes and pops LIFO at the bottom end without locks
+ * or read-modify-write instructions on the common path, while any other
+ * thread may steal FIFO from the top end. The circular buffer grows on
+ * demand. Items are opaque pointers; NULL cannot be stored.
+ */
+
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include <stddef.h>
+#include "dynamic_stack.h"
+
+/* Forward declaration for opaque deque structure */
+typedef struct WorkStealingDeque WorkStealingDeque;
+
+/* Constants */
+#define WS_DEQUE_MIN_CAPACITY 16
+
+/**
+ * @brief Creates an empty deque
+ * @param initial_capacity Slots to reserve, rounded up to a power of two
+ * @return Pointer to new deque or NULL on failure
+ */
+WorkStealingDeque* ws_deque_create(size_t initial_capacity);
+
+/**
+ * @brief Destroys a deque; no thread may be using it
+ * @param deque Pointer to deque to destroy
+ */
+void ws_deque_destroy(WorkStealingDeque* deque);
+
+/**
+ * @brief Pushes an item at the bottom (owner thread only)
+ * @param deque Pointer to the deque
+ * @param item Item to push, not NULL
+ * @return STACK_SUCCESS on success, error code on failure
+ */
+StackResult ws_deque_push(WorkStealingDeque* deque, void* item);
+
+/**
+ * @brief Pops the most recently pushed item (owner thread only)
+ * @param deque Pointer to the deque
+ * @param item Receives the item
+ * @return STACK_SUCCESS, or STACK_ERROR_UNDERFLOW if empty or the last
+ *         item was taken by a thief
+ */
+StackResult ws_deque_pop(WorkStealingDeque* deque, void** item);
+
+/**
+ * @brief Steals the oldest item (any thread)
+ * @param deque Pointer to the deque
+ * @param item Receives the item
+ * @return STACK_SUCCESS, STACK_ERROR_UNDERFLOW if empty, or
+ *         STACK_ERROR_CONTENDED if another thread took the item first
+ */
+StackResult ws_deque_steal(WorkStealingDeque* deque, void** item);
+
+/**
+ * @brief Returns the number of items, which may be stale under concurrency
+ * @param deque Pointer to the deque
+ * @return Approximate item count
+ */
+size_t ws_deque_size(const WorkStealingDeque* deque);
+
+#endif /* WORK_STEALING_DEQUE_H */
@@ -0,0 +1,454 @@
+/**
+ * @file blocking_stack.c
+ * @brief Bounded Blocking Stack Implementation
+ * @author Jaden Mardini
+ *
+ * A Stack guarded by a mutex, plus one wait queue per direction: items for
+ * threads waiting to pop and space for threads waiting to push. A waiter
+ * registers itself and reads the queue's epoch word under the lock, then
+ * sleeps until the word changes; a thread that makes progress bumps the
+ * epoch under the lock only when someone is registered, so the fast path
+ * never makes a system call. On Linux the words are futexes and the
+ * wakeup is issued after the lock is released, so woken threads do not
+ * immediately block on it again; elsewhere, or when built with
+ * -DBLOCKING_STACK_CONDVAR, a condition variable per direction is used.
+ * A transfer of n values wakes at most n waiters in one call, so a bulk
+ * push does not stampede every sleeping consumer. Before sleeping a
+ * waiter spins for a short while on the published size, but only on
+ * machines with more than one CPU, where the other side can run
+ * meanwhile.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE
+
+#include "blocking_stack.h"
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__linux__) && !defined(BLOCKING_STACK_CONDVAR)
+#define BLOCKING_STACK_USE_FUTEX 1
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* Polls of the published size before a waiter goes to sleep */
+#define SPIN_LIMIT 2000
+
+/* Deadline of an untimed wait */
+#define NO_DEADLINE UINT64_MAX
+
+/* Wait word and waiter count for one direction */
+typedef struct {
+    atomic_uint epoch;          /* Bumped under the lock to wake sleepers */
+    size_t waiters;             /* Registered sleepers, guarded by the lock */
+#ifndef BLOCKING_STACK_USE_FUTEX
+    pthread_cond_t ready;
+#endif
+} WaitQueue;
+
+/* Blocking stack structure definition (opaque to users) */
+struct BlockingStack {
+    pthread_mutex_t lock;
+    Stack* stack;
+    size_t capacity;
+    atomic_size_t count;        /* Stack size, published for spinning waiters */
+    bool spin;
+    WaitQueue items;            /* Poppers waiting for a value */
+    WaitQueue space;            /* Pushers waiting for room */
+    _Atomic uint64_t sleeps;    /* Times a waiter went to sleep */
+    _Atomic uint64_t wakeups;   /* Wake calls issued to sleepers */
+};
+
+/* Static function prototypes */
+static uint64_t monotonic_ns(void);
+static uint64_t deadline_after(uint64_t timeout_ns);
+static bool wait_queue_init(WaitQueue* queue);
+static void wait_queue_destroy(WaitQueue* queue);
+static void wait_queue_park(BlockingStack* stack, WaitQueue* queue, uint64_t deadline);
+static void wait_queue_wake(BlockingStack* stack, WaitQueue* queue, size_t count);
+static size_t wake_count(WaitQueue* queue, size_t transferred);
+static void spin_while(const BlockingStack* stack, size_t blocked_size);
+static StackResult push_values(BlockingStack* stack, const int* values, size_t count, uint64_t deadline);
+static StackResult pop_values(BlockingStack* stack, int* values, size_t max_count, size_t* popped,
+                              uint64_t deadline);
+
+/**
+ * @brief Reads the monotonic clock in nanoseconds
+ */
+static uint64_t monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Converts a relative timeout into an absolute monotonic deadline
+ */
+static uint64_t deadline_after(uint64_t timeout_ns) {
+    uint64_t now = monotonic_ns();
+    return timeout_ns >= NO_DEADLINE - now ? NO_DEADLINE - 1 : now + timeout_ns;
+}
+
+/**
+ * @brief Initializes a wait queue
+ */
+static bool wait_queue_init(WaitQueue* queue) {
+    atomic_init(&queue->epoch, 0);
+    queue->waiters = 0;
+#ifndef BLOCKING_STACK_USE_FUTEX
+    pthread_condattr_t attributes;
+    if (pthread_condattr_init(&attributes) != 0) {
+        return false;
+    }
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+    int status = pthread_cond_init(&queue->ready, &attributes);
+    pthread_condattr_destroy(&attributes);
+    return status == 0;
+#else
+    return true;
+#endif
+}
+
+/**
+ * @brief Releases a wait queue
+ */
+static void wait_queue_destroy(WaitQueue* queue) {
+#ifndef BLOCKING_STACK_USE_FUTEX
+    pthread_cond_destroy(&queue->ready);
+#else
+    (void)queue;
+#endif
+}
+
+/**
+ * @brief Sleeps until the queue's epoch changes, the deadline passes or a spurious wakeup
+ *
+ * Called with the lock held and the caller registered as a waiter;
+ * returns with the lock held.
+ */
+static void wait_queue_park(BlockingStack* stack, WaitQueue* queue, uint64_t deadline) {
+    unsigned epoch = atomic_load_explicit(&queue->epoch, memory_order_relaxed);
+
+#ifdef BLOCKING_STACK_USE_FUTEX
+    struct timespec relative;
+    struct timespec* timeout = NULL;
+    if (deadline != NO_DEADLINE) {
+        uint64_t now = monotonic_ns();
+        if (now >= deadline) {
+            return;
+        }
+        uint64_t remaining = deadline - now;
+        relative.tv_sec = (time_t)(remaining / 1000000000u);
+        relative.tv_nsec = (long)(remaining % 1000000000u);
+        timeout = &relative;
+    }
+
+    /* The kernel rechecks the word, so a bump after unlocking is not lost */
+    pthread_mutex_unlock(&stack->lock);
+    syscall(SYS_futex, (void*)&queue->epoch, FUTEX_WAIT_PRIVATE, epoch, timeout, NULL, 0);
+    pthread_mutex_lock(&stack->lock);
+#else
+    (void)epoch;
+    if (deadline == NO_DEADLINE) {
+        pthread_cond_wait(&queue->ready, &stack->lock);
+    } else {
+        struct timespec absolute;
+        absolute.tv_sec = (time_t)(deadline / 1000000000u);
+        absolute.tv_nsec = (long)(deadline % 1000000000u);
+        pthread_cond_timedwait(&queue->ready, &stack->lock, &absolute);
+    }
+#endif
+}
+
+/**
+ * @brief Wakes up to count sleepers; called after the epoch was bumped
+ *
+ * Returns without a system call when count is 0, which is every transfer
+ * that found no one registered.
+ */
+static void wait_queue_wake(BlockingStack* stack, WaitQueue* queue, size_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    atomic_fetch_add_explicit(&stack->wakeups, 1, memory_order_relaxed);
+#ifdef BLOCKING_STACK_USE_FUTEX
+    int wake = count > INT_MAX ? INT_MAX : (int)count;
+    syscall(SYS_futex, (void*)&queue->epoch, FUTEX_WAKE_PRIVATE, wake, NULL, NULL, 0);
+#else
+    for (size_t i = 0; i < count; i++) {
+        pthread_cond_signal(&queue->ready);
+    }
+#endif
+}
+
+/**
+ * @brief Decides how many sleepers a transfer should wake and bumps the epoch if any
+ *
+ * Called with the lock held. A value (or a free slot) can satisfy only
+ * one waiter, so waking more than were transferred only makes the extras
+ * go back to sleep.
+ */
+static size_t wake_count(WaitQueue* queue, size_t transferred) {
+    size_t wake = transferred < queue->waiters ? transferred : queue->waiters;
+    if (wake > 0) {
+        atomic_fetch_add_explicit(&queue->epoch, 1, memory_order_relaxed);
+    }
+    return wake;
+}
+
+/**
+ * @brief Polls the published size while it equals blocked_size, for a bounded time
+ */
+static void spin_while(const BlockingStack* stack, size_t blocked_size) {
+    for (int i = 0; i < SPIN_LIMIT; i++) {
+        if (atomic_load_explicit(&stack->count, memory_order_relaxed) != blocked_size) {
+            return;
+        }
+#if defined(__SSE2__)
+        _mm_pause();
+#endif
+    }
+}
+
+/**
+ * @brief Pushes count values, waiting for room until the deadline
+ */
+static StackResult push_values(BlockingStack* stack, const int* values, size_t count, uint64_t deadline) {
+    size_t pushed = 0;
+    bool spun = !stack->spin;
+
+    pthread_mutex_lock(&stack->lock);
+    for (;;) {
+        size_t batch = 0;
+        while (pushed < count && stack_push(stack->stack, values[pushed]) == STACK_SUCCESS) {
+            pushed++;
+            batch++;
+        }
+        atomic_store_explicit(&stack->count, stack_size(stack->stack), memory_order_relaxed);
+        size_t wake = wake_count(&stack->items, batch);
+
+        if (pushed == count || wake > 0) {
+            pthread_mutex_unlock(&stack->lock);
+            wait_queue_wake(stack, &stack->items, wake);
+            if (pushed == count) {
+                return STACK_SUCCESS;
+            }
+            pthread_mutex_lock(&stack->lock);
+            continue;
+        }
+
+        /* Full: give up, spin once, or sleep */
+        if (deadline != NO_DEADLINE && monotonic_ns() >= deadline) {
+            pthread_mutex_unlock(&stack->lock);
+            return STACK_ERROR_TIMEOUT;
+        }
+        if (!spun) {
+            spun = true;
+            pthread_mutex_unlock(&stack->lock);
+            spin_while(stack, stack->capacity);
+            pthread_mutex_lock(&stack->lock);
+            continue;
+        }
+        stack->space.waiters++;
+        atomic_fetch_add_explicit(&stack->sleeps, 1, memory_order_relaxed);
+        wait_queue_park(stack, &stack->space, deadline);
+        stack->space.waiters--;
+    }
+}
+
+/**
+ * @brief Pops between one and max_count values, waiting for the first until the deadline
+ */
+static StackResult pop_values(BlockingStack* stack, int* values, size_t max_count, size_t* popped,
+                              uint64_t deadline) {
+    bool spun = !stack->spin;
+
+    pthread_mutex_lock(&stack->lock);
+    for (;;) {
+        size_t batch = 0;
+        while (batch < max_count && stack_pop(stack->stack, &values[batch]) == STACK_SUCCESS) {
+            batch++;
+        }
+
+        if (batch > 0) {
+            atomic_store_explicit(&stack->count, stack_size(stack->stack), memory_order_relaxed);
+            size_t wake = wake_count(&stack->space, batch);
+            pthread_mutex_unlock(&stack->lock);
+            wait_queue_wake(stack, &stack->space, wake);
+            *popped = batch;
+            return STACK_SUCCESS;
+        }
+
+        /* Empty: give up, spin once, or sleep */
+        if (deadline != NO_DEADLINE && monotonic_ns() >= deadline) {
+            pthread_mutex_unlock(&stack->lock);
+            *popped = 0;
+            return STACK_ERROR_TIMEOUT;
+        }
+        if (!spun) {
+            spun = true;
+            pthread_mutex_unlock(&stack->lock);
+            spin_while(stack, 0);
+            pthread_mutex_lock(&stack->lock);
+            continue;
+        }
+        stack->items.waiters++;
+        atomic_fetch_add_explicit(&stack->sleeps, 1, memory_order_relaxed);
+        wait_queue_park(stack, &stack->items, deadline);
+        stack->items.waiters--;
+    }
+}
+
+BlockingStack* blocking_stack_create(size_t capacity) {
+    /* Validate input parameters */
+    if (capacity == 0) {
+        return NULL;
+    }
+
+    BlockingStack* stack = malloc(sizeof(BlockingStack));
+    if (!stack) {
+        return NULL;
+    }
+
+    stack->stack = stack_create(capacity);
+    if (!stack->stack) {
+        free(stack);
+        return NULL;
+    }
+    /* Popped slots are recycled, so skip wiping them */
+    stack_set_wipe_policy(stack->stack, STACK_WIPE_NEVER);
+
+    if (pthread_mutex_init(&stack->lock, NULL) != 0) {
+        stack_destroy(stack->stack);
+        free(stack);
+        return NULL;
+    }
+    if (!wait_queue_init(&stack->items)) {
+        pthread_mutex_destroy(&stack->lock);
+        stack_destroy(stack->stack);
+        free(stack);
+        return NULL;
+    }
+    if (!wait_queue_init(&stack->space)) {
+        wait_queue_destroy(&stack->items);
+        pthread_mutex_destroy(&stack->lock);
+        stack_destroy(stack->stack);
+        free(stack);
+        return NULL;
+    }
+
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    stack->spin = online > 1;
+    stack->capacity = capacity;
+    atomic_init(&stack->count, 0);
+    atomic_init(&stack->sleeps, 0);
+    atomic_init(&stack->wakeups, 0);
+    return stack;
+}
+
+void blocking_stack_destroy(BlockingStack* stack) {
+    if (stack) {
+        wait_queue_destroy(&stack->space);
+        wait_queue_destroy(&stack->items);
+        pthread_mutex_destroy(&stack->lock);
+        stack_destroy(stack->stack);
+        free(stack);
+    }
+}
+
+StackResult blocking_stack_push_wait(BlockingStack* stack, int value) {
+    /* Validate input parameters */
+    if (!stack) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    return push_values(stack, &value, 1, NO_DEADLINE);
+}
+
+StackResult blocking_stack_pop_wait(BlockingStack* stack, int* value) {
+    /* Validate input parameters */
+    if (!stack || !value) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    size_t popped;
+    return pop_values(stack, value, 1, &popped, NO_DEADLINE);
+}
+
+StackResult blocking_stack_push_timed(BlockingStack* stack, int value, uint64_t timeout_ns) {
+    /* Validate input parameters */
+    if (!stack) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    return push_values(stack, &value, 1, deadline_after(timeout_ns));
+}
+
+StackResult blocking_stack_pop_timed(BlockingStack* stack, int* value, uint64_t timeout_ns) {
+    /* Validate input parameters */
+    if (!stack || !value) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    size_t popped;
+    return pop_values(stack, value, 1, &popped, deadline_after(timeout_ns));
+}
+
+StackResult blocking_stack_push_many(BlockingStack* stack, const int* values, size_t count) {
+    /* Validate input parameters */
+    if (!stack || (!values && count > 0)) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (count == 0) {
+        return STACK_SUCCESS;
+    }
+    return push_values(stack, values, count, NO_DEADLINE);
+}
+
+StackResult blocking_stack_pop_many(BlockingStack* stack, int* values, size_t max_count, size_t* popped) {
+    /* Validate input parameters */
+    if (!stack || !values || !popped) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (max_count == 0) {
+        *popped = 0;
+        return STACK_ERROR_INVALID_CAPACITY;
+    }
+    return pop_values(stack, values, max_count, popped, NO_DEADLINE);
+}
+
+size_t blocking_stack_size(const BlockingStack* stack) {
+    return stack ? atomic_load_explicit(&stack->count, memory_order_relaxed) : 0;
+}
+
+size_t blocking_stack_capacity(const BlockingStack* stack) {
+    return stack ? stack->capacity : 0;
+}
+
+void blocking_stack_stats(const BlockingStack* stack, BlockingStackStats* stats) {
+    if (!stats) {
+        return;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    if (!stack) {
+        return;
+    }
+
+    stats->sleeps = atomic_load_explicit(&stack->sleeps, memory_order_relaxed);
+    stats->wakeups = atomic_load_explicit(&stack->wakeups, memory_order_relaxed);
+}
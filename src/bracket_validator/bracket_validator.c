@@ -0,0 +1,410 @@
+/**
+ * @file bracket_validator.c
+ * @brief Bracket/Delimiter Balance Validator Implementation
+ * @author Jaden Mardini
+ *
+ * The input is processed in 64-byte blocks. For each block, SSE2 compares
+ * produce 64-bit masks of delimiter, quote and backslash positions. When
+ * string skipping is on, backslash runs and quotes are resolved with bit
+ * arithmetic (odd-length backslash runs escape the next byte; a prefix XOR
+ * of unescaped quotes marks string interiors), and delimiters inside
+ * strings are masked off. Only the surviving delimiter bits reach the
+ * stack, which is updated without branching on opener versus closer.
+ */
+
+#include "bracket_validator.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* Character classes; the low bits carry the pair index */
+#define CLASS_PAIR_MASK 0x07u
+#define CLASS_OPEN      0x40u
+#define CLASS_CLOSE     0x80u
+
+/* Bytes examined per block */
+#define BLOCK_SIZE 64
+
+/* Delimiter stack entries kept on the call stack before spilling to heap */
+#define INLINE_STACK_SIZE 512
+
+/* Stack slot 0 holds a sentinel that never matches a pair index */
+#define STACK_SENTINEL 0xFFu
+
+/* Alternating bit patterns used to resolve backslash runs */
+#define EVEN_BITS 0x5555555555555555ULL
+#define ODD_BITS  (~EVEN_BITS)
+
+/* Scanner state carried across blocks */
+typedef struct {
+    uint8_t classes[256];               /* Class of every byte value */
+#if defined(__SSE2__)
+    __m128i needles[2 * BRACKET_MAX_PAIRS]; /* Broadcast delimiter bytes */
+    __m128i quote_needle;
+    __m128i backslash_needle;
+#endif
+    unsigned char delimiters[2 * BRACKET_MAX_PAIRS];
+    size_t delimiter_kinds;
+    bool skip_strings;
+    unsigned char quote;
+    unsigned char* stack;               /* Sentinel followed by open pair indices */
+    size_t depth;                       /* Entries including the sentinel */
+    size_t stack_capacity;
+    unsigned char inline_stack[INLINE_STACK_SIZE];
+    uint64_t prev_in_string;            /* All ones if the last block ended inside a string */
+    uint64_t prev_odd_backslash;        /* 1 if the last block ended an odd backslash run */
+    size_t max_depth;
+    size_t delimiter_count;
+} Scanner;
+
+/* Per-block position masks */
+typedef struct {
+    uint64_t delimiters;
+    uint64_t quotes;
+    uint64_t backslashes;
+} BlockMasks;
+
+/* Static function prototypes */
+static BracketResult scanner_init(Scanner* scanner, const BracketOptions* options);
+static bool scanner_reserve(Scanner* scanner, size_t extra);
+static void classify_block(const Scanner* scanner, const unsigned char* block, BlockMasks* masks);
+static uint64_t escaped_positions(uint64_t backslashes, uint64_t* prev_odd_backslash);
+static uint64_t prefix_xor(uint64_t bits);
+static BracketResult process_block(Scanner* scanner, const unsigned char* block,
+                                   size_t base, size_t* error_offset);
+static BracketResult finish(Scanner* scanner, BracketResult result, size_t offset, BracketReport* report);
+
+/**
+ * @brief Builds the class table from the options
+ */
+static BracketResult scanner_init(Scanner* scanner, const BracketOptions* options) {
+    const char* pairs = options && options->pairs ? options->pairs : BRACKET_DEFAULT_PAIRS;
+    size_t pair_bytes = strlen(pairs);
+
+    if (pair_bytes == 0 || pair_bytes % 2 != 0 || pair_bytes / 2 > BRACKET_MAX_PAIRS) {
+        return BRACKET_ERROR_INVALID_INPUT;
+    }
+
+    memset(scanner->classes, 0, sizeof(scanner->classes));
+    scanner->delimiter_kinds = 0;
+
+    for (size_t i = 0; i < pair_bytes; i++) {
+        unsigned char c = (unsigned char)pairs[i];
+        if (scanner->classes[c] != 0) {
+            return BRACKET_ERROR_INVALID_INPUT;  /* Each byte may play one role */
+        }
+        scanner->classes[c] = (uint8_t)(((i % 2 == 0) ? CLASS_OPEN : CLASS_CLOSE) | (i / 2));
+        scanner->delimiters[scanner->delimiter_kinds++] = c;
+    }
+
+    scanner->skip_strings = options && options->skip_strings;
+    scanner->quote = (unsigned char)(options && options->quote ? options->quote : '"');
+    if (scanner->skip_strings &&
+        (scanner->classes[scanner->quote] != 0 || scanner->classes['\\'] != 0 || scanner->quote == '\\')) {
+        return BRACKET_ERROR_INVALID_INPUT;
+    }
+
+#if defined(__SSE2__)
+    for (size_t k = 0; k < scanner->delimiter_kinds; k++) {
+        scanner->needles[k] = _mm_set1_epi8((char)scanner->delimiters[k]);
+    }
+    scanner->quote_needle = _mm_set1_epi8((char)scanner->quote);
+    scanner->backslash_needle = _mm_set1_epi8('\\');
+#endif
+
+    scanner->stack = scanner->inline_stack;
+    scanner->stack_capacity = INLINE_STACK_SIZE;
+    scanner->stack[0] = STACK_SENTINEL;
+    scanner->depth = 1;
+    scanner->prev_in_string = 0;
+    scanner->prev_odd_backslash = 0;
+    scanner->max_depth = 1;
+    scanner->delimiter_count = 0;
+
+    return BRACKET_BALANCED;
+}
+
+/**
+ * @brief Ensures room for extra pushes, moving the stack to the heap if needed
+ */
+static bool scanner_reserve(Scanner* scanner, size_t extra) {
+    if (scanner->depth + extra <= scanner->stack_capacity) {
+        return true;
+    }
+
+    size_t new_capacity = scanner->stack_capacity * 2;
+    unsigned char* stack;
+
+    if (scanner->stack == scanner->inline_stack) {
+        stack = malloc(new_capacity);
+        if (stack) {
+            memcpy(stack, scanner->inline_stack, scanner->depth);
+        }
+    } else {
+        stack = realloc(scanner->stack, new_capacity);
+    }
+
+    if (!stack) {
+        return false;
+    }
+
+    scanner->stack = stack;
+    scanner->stack_capacity = new_capacity;
+    return true;
+}
+
+#if defined(__SSE2__)
+/**
+ * @brief Packs four 16-byte compare results into one 64-bit mask
+ */
+static inline uint64_t movemask_64(__m128i m0, __m128i m1, __m128i m2, __m128i m3) {
+    return (uint64_t)(unsigned)_mm_movemask_epi8(m0) |
+           ((uint64_t)(unsigned)_mm_movemask_epi8(m1) << 16) |
+           ((uint64_t)(unsigned)_mm_movemask_epi8(m2) << 32) |
+           ((uint64_t)(unsigned)_mm_movemask_epi8(m3) << 48);
+}
+#endif
+
+/**
+ * @brief Computes delimiter, quote and backslash masks for one block
+ */
+static inline void classify_block(const Scanner* scanner, const unsigned char* block, BlockMasks* masks) {
+#if defined(__SSE2__)
+    __m128i b0 = _mm_loadu_si128((const __m128i*)(const void*)block);
+    __m128i b1 = _mm_loadu_si128((const __m128i*)(const void*)(block + 16));
+    __m128i b2 = _mm_loadu_si128((const __m128i*)(const void*)(block + 32));
+    __m128i b3 = _mm_loadu_si128((const __m128i*)(const void*)(block + 48));
+    __m128i h0 = _mm_setzero_si128();
+    __m128i h1 = _mm_setzero_si128();
+    __m128i h2 = _mm_setzero_si128();
+    __m128i h3 = _mm_setzero_si128();
+
+    /* One pass per delimiter keeps the four lanes independent */
+    for (size_t k = 0; k < scanner->delimiter_kinds; k++) {
+        __m128i needle = scanner->needles[k];
+        h0 = _mm_or_si128(h0, _mm_cmpeq_epi8(b0, needle));
+        h1 = _mm_or_si128(h1, _mm_cmpeq_epi8(b1, needle));
+        h2 = _mm_or_si128(h2, _mm_cmpeq_epi8(b2, needle));
+        h3 = _mm_or_si128(h3, _mm_cmpeq_epi8(b3, needle));
+    }
+    masks->delimiters = movemask_64(h0, h1, h2, h3);
+
+    if (scanner->skip_strings) {
+        __m128i q = scanner->quote_needle;
+        __m128i s = scanner->backslash_needle;
+        masks->quotes = movemask_64(_mm_cmpeq_epi8(b0, q), _mm_cmpeq_epi8(b1, q),
+                                    _mm_cmpeq_epi8(b2, q), _mm_cmpeq_epi8(b3, q));
+        masks->backslashes = movemask_64(_mm_cmpeq_epi8(b0, s), _mm_cmpeq_epi8(b1, s),
+                                         _mm_cmpeq_epi8(b2, s), _mm_cmpeq_epi8(b3, s));
+    } else {
+        masks->quotes = 0;
+        masks->backslashes = 0;
+    }
+#else
+    masks->delimiters = 0;
+    masks->quotes = 0;
+    masks->backslashes = 0;
+
+    for (int i = 0; i < BLOCK_SIZE; i++) {
+        uint64_t bit = 1ULL << i;
+        if (scanner->classes[block[i]] != 0) {
+            masks->delimiters |= bit;
+        }
+        if (scanner->skip_strings) {
+            if (block[i] == scanner->quote) {
+                masks->quotes |= bit;
+            } else if (block[i] == '\\') {
+                masks->backslashes |= bit;
+            }
+        }
+    }
+#endif
+}
+
+/**
+ * @brief Returns the positions escaped by an odd-length backslash run
+ *
+ * A run starting on an even bit and ending on an odd one (or vice versa)
+ * has odd length; adding the run's start bit to the run carries out just
+ * past its end, which is exactly the escaped byte.
+ */
+static inline uint64_t escaped_positions(uint64_t backslashes, uint64_t* prev_odd_backslash) {
+    uint64_t carried = *prev_odd_backslash;
+    uint64_t starts = backslashes & ~(backslashes << 1);
+    uint64_t even_start_mask = EVEN_BITS ^ carried;
+    uint64_t even_starts = starts & even_start_mask;
+    uint64_t odd_starts = starts & ~even_start_mask;
+
+    uint64_t even_carries = backslashes + even_starts;
+    uint64_t odd_carries = backslashes + odd_starts;
+    bool ends_odd = odd_carries < backslashes;
+    odd_carries |= carried;
+    *prev_odd_backslash = ends_odd ? 1 : 0;
+
+    uint64_t even_carry_ends = even_carries & ~backslashes;
+    uint64_t odd_carry_ends = odd_carries & ~backslashes;
+
+    return (even_carry_ends & ODD_BITS) | (odd_carry_ends & EVEN_BITS);
+}
+
+/**
+ * @brief Sets each bit to the XOR of itself and every lower bit
+ */
+static inline uint64_t prefix_xor(uint64_t bits) {
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+/**
+ * @brief Validates one 64-byte block, updating the scanner
+ */
+static inline BracketResult process_block(Scanner* scanner, const unsigned char* block,
+                                          size_t base, size_t* error_offset) {
+    BlockMasks masks;
+    classify_block(scanner, block, &masks);
+
+    uint64_t delimiters = masks.delimiters;
+
+    if (scanner->skip_strings) {
+        uint64_t quotes = masks.quotes & ~escaped_positions(masks.backslashes, &scanner->prev_odd_backslash);
+        uint64_t in_string = prefix_xor(quotes) ^ scanner->prev_in_string;
+        scanner->prev_in_string = (uint64_t)((int64_t)in_string >> 63);
+        delimiters &= ~in_string;
+    }
+
+    if (!delimiters) {
+        return BRACKET_BALANCED;
+    }
+
+    /* A block pushes at most BLOCK_SIZE entries */
+    if (!scanner_reserve(scanner, BLOCK_SIZE)) {
+        *error_offset = base;
+        return BRACKET_ERROR_MEMORY_ALLOCATION;
+    }
+
+    /* Locals keep the loop free of stores that could alias the scanner */
+    const uint8_t* classes = scanner->classes;
+    unsigned char* stack = scanner->stack;
+    size_t depth = scanner->depth;
+    size_t max_depth = scanner->max_depth;
+    uint64_t pending = delimiters;
+
+    while (pending) {
+        unsigned at = (unsigned)__builtin_ctzll(pending);
+        uint8_t cls = classes[block[at]];
+        unsigned char pair = (unsigned char)(cls & CLASS_PAIR_MASK);
+        size_t is_close = cls >> 7;
+
+        /* The sentinel in slot 0 makes a closer on an empty stack a mismatch */
+        if (is_close && stack[depth - 1] != pair) {
+            scanner->depth = depth;
+            scanner->max_depth = max_depth;
+            scanner->delimiter_count += (size_t)__builtin_popcountll(delimiters & ~pending);
+            *error_offset = base + at;
+            return depth == 1 ? BRACKET_ERROR_UNEXPECTED_CLOSE : BRACKET_ERROR_MISMATCH;
+        }
+
+        /* Openers land in the next slot; closers write harmlessly above the top */
+        stack[depth] = pair;
+        depth = depth + 1 - 2 * is_close;
+        max_depth = depth > max_depth ? depth : max_depth;
+
+        pending &= pending - 1;
+    }
+
+    scanner->depth = depth;
+    scanner->max_depth = max_depth;
+    scanner->delimiter_count += (size_t)__builtin_popcountll(delimiters);
+    return BRACKET_BALANCED;
+}
+
+/**
+ * @brief Fills the report and releases scanner memory
+ */
+static BracketResult finish(Scanner* scanner, BracketResult result, size_t offset, BracketReport* report) {
+    if (report) {
+        report->error_offset = offset;
+        report->max_depth = scanner->max_depth - 1;
+        report->delimiter_count = scanner->delimiter_count;
+    }
+
+    if (scanner->stack != scanner->inline_stack) {
+        free(scanner->stack);
+    }
+
+    return result;
+}
+
+BracketResult bracket_validate(const char* data, size_t length,
+                               const BracketOptions* options, BracketReport* report) {
+    /* Validate input parameters */
+    if (!data && length > 0) {
+        return BRACKET_ERROR_INVALID_INPUT;
+    }
+
+    Scanner scanner;
+    BracketResult result = scanner_init(&scanner, options);
+    if (result != BRACKET_BALANCED) {
+        return result;
+    }
+
+    const unsigned char* bytes = (const unsigned char*)data;
+    size_t position = 0;
+    size_t error_offset = 0;
+
+    for (; position + BLOCK_SIZE <= length; position += BLOCK_SIZE) {
+        result = process_block(&scanner, bytes + position, position, &error_offset);
+        if (result != BRACKET_BALANCED) {
+            return finish(&scanner, result, error_offset, report);
+        }
+    }
+
+    /* Pad the tail with NUL bytes, which are never structural */
+    if (position < length) {
+        unsigned char tail[BLOCK_SIZE] = {0};
+        memcpy(tail, bytes + position, length - position);
+        result = process_block(&scanner, tail, position, &error_offset);
+        if (result != BRACKET_BALANCED) {
+            return finish(&scanner, result, error_offset, report);
+        }
+    }
+
+    if (scanner.prev_in_string) {
+        return finish(&scanner, BRACKET_ERROR_UNTERMINATED_STRING, length, report);
+    }
+    if (scanner.depth > 1) {
+        return finish(&scanner, BRACKET_ERROR_UNCLOSED, length, report);
+    }
+
+    return finish(&scanner, BRACKET_BALANCED, length, report);
+}
+
+const char* bracket_result_string(BracketResult result) {
+    switch (result) {
+        case BRACKET_BALANCED:
+            return "All delimiters are balanced";
+        case BRACKET_ERROR_MISMATCH:
+            return "Closing delimiter does not match the innermost opening delimiter";
+        case BRACKET_ERROR_UNEXPECTED_CLOSE:
+            return "Closing delimiter with no open delimiter";
+        case BRACKET_ERROR_UNCLOSED:
+            return "Input ended with unclosed delimiters";
+        case BRACKET_ERROR_UNTERMINATED_STRING:
+            return "Input ended inside a quoted string";
+        case BRACKET_ERROR_INVALID_INPUT:
+            return "Invalid input parameter";
+        case BRACKET_ERROR_MEMORY_ALLOCATION:
+            return "Memory allocation failed";
+        default:
+            return "Unknown error";
+    }
+}
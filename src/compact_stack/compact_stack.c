@@ -0,0 +1,362 @@
+/**
+ * @file compact_stack.c
+ * @brief Compact Integer Stack Implementation
+ * @author Jaden Mardini
+ *
+ * Narrow mode stores elements as int8_t, int16_t or int in one array sized
+ * for the full capacity at the current width. Widening reallocates the
+ * array and converts elements from the top down, so each element is read
+ * at its old offset before the wider copy of any lower element can
+ * overwrite it. Widths never shrink, which keeps push and pop free of any
+ * re-encoding work after the first few pushes.
+ *
+ * Delta mode stores a byte stream of zigzag-encoded differences in
+ * LEB128 varints (7 bits per byte, high bit set on all but the last byte)
+ * and keeps the decoded top value in the header. Popping walks back from
+ * the end of the stream to the previous terminating byte, decodes that one
+ * difference and subtracts it from the top, so both operations stay O(1)
+ * without an index of element offsets. Differences are taken modulo 2^32,
+ * so any int sequence round-trips; a jump across the whole int range costs
+ * at most five bytes.
+ *
+ * As with a Stack under the default STACK_WIPE_ALWAYS policy, popped
+ * elements and varints are zeroed, clear zeroes everything in use, and
+ * growing or destroying copies live bytes out and wipes the old buffer
+ * before it is freed rather than leaving a copy behind in realloc().
+ */
+
+#include "compact_stack.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Longest varint encoding of a 32-bit difference */
+#define VARINT_MAX_BYTES 5
+
+/* Initial byte stream allocation in delta mode */
+#define DELTA_INITIAL_BYTES 64
+
+/* Compact stack structure definition (opaque to users) */
+struct CompactStack {
+    unsigned char* data;        /* Element array or varint byte stream */
+    size_t capacity;            /* Maximum number of elements */
+    size_t size;                /* Current number of elements */
+    size_t allocated;           /* Bytes allocated for data */
+    CompactStackMode mode;
+    size_t width;               /* Narrow: bytes per element */
+    size_t used;                /* Delta: bytes of the stream in use */
+    int top;                    /* Delta: decoded top value, 0 when empty */
+};
+
+/* Static function prototypes */
+static bool is_valid_capacity(size_t capacity);
+static size_t live_bytes(const CompactStack* stack);
+static size_t width_for(int value);
+static int load_element(const CompactStack* stack, size_t index);
+static void store_element(CompactStack* stack, size_t index, size_t width, int value);
+static bool replace_data(CompactStack* stack, size_t allocated);
+static StackResult widen(CompactStack* stack, size_t width);
+static StackResult reserve_stream(CompactStack* stack);
+static void delta_push(CompactStack* stack, int value);
+static int delta_pop(CompactStack* stack);
+
+/**
+ * @brief Validates if capacity is within acceptable range
+ */
+static bool is_valid_capacity(size_t capacity) {
+    return capacity >= STACK_MIN_CAPACITY && capacity <= STACK_MAX_CAPACITY;
+}
+
+/**
+ * @brief Returns the number of bytes of data holding elements
+ */
+static inline size_t live_bytes(const CompactStack* stack) {
+    return stack->mode == COMPACT_STACK_DELTA ? stack->used : stack->size * stack->width;
+}
+
+/**
+ * @brief Returns the narrowest element width that can hold a value
+ */
+static inline size_t width_for(int value) {
+    if (value >= INT8_MIN && value <= INT8_MAX) {
+        return sizeof(int8_t);
+    }
+    if (value >= INT16_MIN && value <= INT16_MAX) {
+        return sizeof(int16_t);
+    }
+    return sizeof(int);
+}
+
+/**
+ * @brief Reads a narrow-mode element at the current width
+ */
+static inline int load_element(const CompactStack* stack, size_t index) {
+    switch (stack->width) {
+        case sizeof(int8_t):
+            return ((const int8_t*)(const void*)stack->data)[index];
+        case sizeof(int16_t):
+            return ((const int16_t*)(const void*)stack->data)[index];
+        default:
+            return ((const int*)(const void*)stack->data)[index];
+    }
+}
+
+/**
+ * @brief Writes a narrow-mode element at the given width
+ */
+static inline void store_element(CompactStack* stack, size_t index, size_t width, int value) {
+    switch (width) {
+        case sizeof(int8_t):
+            ((int8_t*)(void*)stack->data)[index] = (int8_t)value;
+            break;
+        case sizeof(int16_t):
+            ((int16_t*)(void*)stack->data)[index] = (int16_t)value;
+            break;
+        default:
+            ((int*)(void*)stack->data)[index] = value;
+            break;
+    }
+}
+
+/**
+ * @brief Moves the live bytes into a new buffer, wiping the old one before it is freed
+ */
+static bool replace_data(CompactStack* stack, size_t allocated) {
+    unsigned char* data = malloc(allocated);
+    if (!data) {
+        return false;
+    }
+
+    size_t live = live_bytes(stack);
+    memcpy(data, stack->data, live);
+    memset(stack->data, 0, live);
+    free(stack->data);
+
+    stack->data = data;
+    stack->allocated = allocated;
+    return true;
+}
+
+/**
+ * @brief Re-encodes every element at a wider width
+ */
+static StackResult widen(CompactStack* stack, size_t width) {
+    if (!replace_data(stack, stack->capacity * width)) {
+        return STACK_ERROR_MEMORY_ALLOCATION;
+    }
+
+    /* Top down: element i's wide slot only overlaps narrow slots >= i */
+    for (size_t i = stack->size; i > 0; i--) {
+        store_element(stack, i - 1, width, load_element(stack, i - 1));
+    }
+
+    stack->width = width;
+    return STACK_SUCCESS;
+}
+
+/**
+ * @brief Ensures the delta stream has room for one more varint
+ */
+static StackResult reserve_stream(CompactStack* stack) {
+    if (stack->used + VARINT_MAX_BYTES <= stack->allocated) {
+        return STACK_SUCCESS;
+    }
+
+    size_t limit = stack->capacity * VARINT_MAX_BYTES;
+    size_t allocated = stack->allocated * 2;
+    if (allocated > limit) {
+        allocated = limit;
+    }
+
+    if (!replace_data(stack, allocated)) {
+        return STACK_ERROR_MEMORY_ALLOCATION;
+    }
+    return STACK_SUCCESS;
+}
+
+/**
+ * @brief Appends the zigzag varint difference between value and the top
+ */
+static inline void delta_push(CompactStack* stack, int value) {
+    uint32_t difference = (uint32_t)value - (uint32_t)stack->top;
+    uint32_t zigzag = (difference << 1) ^ (0u - (difference >> 31));
+
+    unsigned char* out = stack->data + stack->used;
+    while (zigzag >= 0x80) {
+        *out++ = (unsigned char)(zigzag | 0x80);
+        zigzag >>= 7;
+    }
+    *out++ = (unsigned char)zigzag;
+
+    stack->used = (size_t)(out - stack->data);
+    stack->top = value;
+}
+
+/**
+ * @brief Removes and zeroes the last varint and steps the top back by its difference
+ * @return The value that was on top
+ */
+static inline int delta_pop(CompactStack* stack) {
+    size_t start = stack->used - 1;
+    while (start > 0 && (stack->data[start - 1] & 0x80)) {
+        start--;
+    }
+
+    uint32_t zigzag = 0;
+    for (size_t i = stack->used; i > start; i--) {
+        zigzag = (zigzag << 7) | (stack->data[i - 1] & 0x7Fu);
+        stack->data[i - 1] = 0;
+    }
+    uint32_t difference = (zigzag >> 1) ^ (0u - (zigzag & 1u));
+
+    int value = stack->top;
+    stack->top = (int)((uint32_t)value - difference);
+    stack->used = start;
+    return value;
+}
+
+CompactStack* compact_stack_create(size_t capacity, CompactStackMode mode) {
+    /* Validate input parameters */
+    if (!is_valid_capacity(capacity) || mode > COMPACT_STACK_DELTA) {
+        return NULL;
+    }
+
+    CompactStack* stack = malloc(sizeof(CompactStack));
+    if (!stack) {
+        return NULL;
+    }
+
+    if (mode == COMPACT_STACK_NARROW) {
+        stack->allocated = capacity * sizeof(int8_t);
+    } else {
+        size_t limit = capacity * VARINT_MAX_BYTES;
+        stack->allocated = limit < DELTA_INITIAL_BYTES ? limit : DELTA_INITIAL_BYTES;
+    }
+
+    stack->data = malloc(stack->allocated);
+    if (!stack->data) {
+        free(stack);
+        return NULL;
+    }
+
+    stack->capacity = capacity;
+    stack->size = 0;
+    stack->mode = mode;
+    stack->width = sizeof(int8_t);
+    stack->used = 0;
+    stack->top = 0;
+    return stack;
+}
+
+void compact_stack_destroy(CompactStack* stack) {
+    if (stack) {
+        /* Clear sensitive data before freeing */
+        memset(stack->data, 0, live_bytes(stack));
+        free(stack->data);
+        memset(stack, 0, sizeof(CompactStack));
+        free(stack);
+    }
+}
+
+StackResult compact_stack_push(CompactStack* stack, int value) {
+    /* Validate input parameters */
+    if (!stack) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (stack->size >= stack->capacity) {
+        return STACK_ERROR_OVERFLOW;
+    }
+
+    if (stack->mode == COMPACT_STACK_DELTA) {
+        StackResult result = reserve_stream(stack);
+        if (result != STACK_SUCCESS) {
+            return result;
+        }
+        delta_push(stack, value);
+    } else {
+        size_t width = width_for(value);
+        if (width > stack->width) {
+            StackResult result = widen(stack, width);
+            if (result != STACK_SUCCESS) {
+                return result;
+            }
+        }
+        store_element(stack, stack->size, stack->width, value);
+    }
+
+    stack->size++;
+    return STACK_SUCCESS;
+}
+
+StackResult compact_stack_pop(CompactStack* stack, int* value) {
+    /* Validate input parameters */
+    if (!stack || !value) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (stack->size == 0) {
+        return STACK_ERROR_UNDERFLOW;
+    }
+
+    if (stack->mode == COMPACT_STACK_DELTA) {
+        *value = delta_pop(stack);
+    } else {
+        *value = load_element(stack, stack->size - 1);
+        store_element(stack, stack->size - 1, stack->width, 0);
+    }
+
+    stack->size--;
+    return STACK_SUCCESS;
+}
+
+StackResult compact_stack_peek(const CompactStack* stack, int* value) {
+    /* Validate input parameters */
+    if (!stack || !value) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (stack->size == 0) {
+        return STACK_ERROR_UNDERFLOW;
+    }
+
+    *value = stack->mode == COMPACT_STACK_DELTA ? stack->top : load_element(stack, stack->size - 1);
+    return STACK_SUCCESS;
+}
+
+bool compact_stack_is_empty(const CompactStack* stack) {
+    return !stack || stack->size == 0;
+}
+
+bool compact_stack_is_full(const CompactStack* stack) {
+    return stack && stack->size >= stack->capacity;
+}
+
+size_t compact_stack_size(const CompactStack* stack) {
+    return stack ? stack->size : 0;
+}
+
+size_t compact_stack_capacity(const CompactStack* stack) {
+    return stack ? stack->capacity : 0;
+}
+
+StackResult compact_stack_clear(CompactStack* stack) {
+    /* Validate input parameters */
+    if (!stack) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    memset(stack->data, 0, live_bytes(stack));
+    stack->size = 0;
+    stack->used = 0;
+    stack->top = 0;
+    return STACK_SUCCESS;
+}
+
+size_t compact_stack_element_width(const CompactStack* stack) {
+    return stack && stack->mode == COMPACT_STACK_NARROW ? stack->width : 0;
+}
+
+size_t compact_stack_memory_usage(const CompactStack* stack) {
+    return stack ? stack->allocated : 0;
+}
@@ -7,22 +7,83 @@
  * error handling, memory management, and performance optimizations.
  */
 
+#if defined(__linux__)
+#define _DEFAULT_SOURCE  /* mmap flags, madvise and syscall under -std=c11 */
+#endif
+
 #include "dynamic_stack.h"
 #include <stdlib.h>
+#include <stdalign.h>
+#include <stddef.h>
 #include <string.h>
 #include <assert.h>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/* Largest NUMA node id accepted for explicit placement */
+#define MAX_NUMA_NODE 1023
+
+/* Linux mbind() mode that prefers, but does not require, the node */
+#define NUMA_POLICY_PREFERRED 1
+
+/* Keeps the move out of inline storage off the push fast path */
+#if defined(__GNUC__)
+#define STACK_COLD __attribute__((noinline, cold))
+#else
+#define STACK_COLD
+#endif
+
+/* How the element array was obtained */
+typedef enum {
+    STORAGE_INLINE = 0,     /* Inside the header */
+    STORAGE_HEAP,           /* Stack allocator (C library by default) */
+    STORAGE_MAPPED          /* Anonymous mapping with placement applied */
+} StorageKind;
+
 /* Stack structure definition (opaque to users) */
 struct Stack {
     int* elements;          /* Array to store stack elements */
     size_t top_index;       /* Index of the top element */
     size_t capacity;        /* Maximum number of elements */
+    size_t storage_capacity; /* Slots in the current element array */
     size_t size;            /* Current number of elements */
+    StackWipePolicy wipe_policy; /* Treatment of discarded slots */
+    StorageKind storage;    /* Origin of the element array */
+    size_t mapped_bytes;    /* Mapping length for STORAGE_MAPPED */
+    StackOptions options;   /* Placement reused when the stack grows */
+    const StackAllocator* allocator; /* Custom hooks, or NULL for the C library */
+    StackAllocator allocator_hooks;  /* Copy of the caller's hooks */
+#ifdef DEBUG
+    size_t* push_stamps;    /* Per-slot stamp of the push that wrote it */
+    size_t stamp_capacity;  /* Slots allocated in push_stamps */
+    size_t stamp_clock;     /* Last stamp handed out */
+#endif
+#if STACK_INLINE_CAPACITY > 0
+    int inline_elements[STACK_INLINE_CAPACITY]; /* First elements of every stack */
+#endif
 };
 
 /* Static function prototypes */
 static bool is_valid_capacity(size_t capacity);
+static bool is_valid_options(const StackOptions* options);
 static void initialize_stack_memory(Stack* stack);
+static size_t round_up(size_t value, size_t multiple);
+static size_t element_alignment(const StackOptions* options);
+static size_t header_size(const StackOptions* options);
+static void* memory_allocate(const StackAllocator* allocator, size_t size, size_t alignment);
+static void* memory_reallocate(const StackAllocator* allocator, void* ptr, size_t old_size,
+                               size_t new_size, size_t alignment);
+static void memory_free(const StackAllocator* allocator, void* ptr, size_t size);
+static bool wants_mapping(const StackOptions* options, size_t bytes);
+static int* map_elements(const StackOptions* options, size_t bytes, size_t* mapped_bytes);
+static int* allocate_elements(const StackOptions* options, const StackAllocator* allocator,
+                              size_t capacity, StorageKind* storage, size_t* mapped_bytes);
+static void release_elements(Stack* stack);
+static STACK_COLD StackResult spill_inline_elements(Stack* stack);
 
 /**
  * @brief Validates if capacity is within acceptable range
@@ -31,38 +92,323 @@ static bool is_valid_capacity(size_t capacity) {
     return capacity >= STACK_MIN_CAPACITY && capacity <= STACK_MAX_CAPACITY;
 }
 
+/**
+ * @brief Validates placement options
+ */
+static bool is_valid_options(const StackOptions* options) {
+    bool power_of_two = (options->alignment & (options->alignment - 1)) == 0;
+    return power_of_two &&
+           options->numa_node >= STACK_NUMA_NODE_ANY && options->numa_node <= MAX_NUMA_NODE;
+}
+
 /**
  * @brief Initializes stack memory to zero
+ *
+ * Also the first touch of the pages, which places them near the creator.
  */
 static void initialize_stack_memory(Stack* stack) {
     if (stack && stack->elements) {
-        memset(stack->elements, 0, stack->capacity * sizeof(int));
+        memset(stack->elements, 0, stack->storage_capacity * sizeof(int));
+    }
+}
+
+/**
+ * @brief Rounds value up to a multiple of a power of two
+ */
+static size_t round_up(size_t value, size_t multiple) {
+    return (value + multiple - 1) & ~(multiple - 1);
+}
+
+/**
+ * @brief Alignment requested for the element array
+ */
+static size_t element_alignment(const StackOptions* options) {
+    return options->alignment > alignof(int) ? options->alignment : alignof(int);
+}
+
+/**
+ * @brief Bytes occupied by the header, including any cache-line padding
+ */
+static size_t header_size(const StackOptions* options) {
+    return options->pad_header ? round_up(sizeof(Stack), STACK_CACHE_LINE_SIZE) : sizeof(Stack);
+}
+
+/**
+ * @brief Allocates through the hooks, or the C library when there are none
+ */
+static void* memory_allocate(const StackAllocator* allocator, size_t size, size_t alignment) {
+    if (allocator) {
+        return allocator->allocate(allocator->context, size, alignment);
+    }
+    if (alignment > alignof(max_align_t)) {
+        return aligned_alloc(alignment, round_up(size, alignment));
+    }
+    return malloc(size);
+}
+
+/**
+ * @brief Resizes a block, emulating reallocate when no hook can do it
+ * @return Resized block, or NULL with the original block left intact
+ */
+static void* memory_reallocate(const StackAllocator* allocator, void* ptr, size_t old_size,
+                               size_t new_size, size_t alignment) {
+    if (allocator && allocator->reallocate) {
+        return allocator->reallocate(allocator->context, ptr, old_size, new_size, alignment);
+    }
+    if (!allocator && alignment <= alignof(max_align_t)) {
+        return realloc(ptr, new_size);
+    }
+    
+    /* realloc() cannot preserve over-alignment */
+    void* fresh = memory_allocate(allocator, new_size, alignment);
+    if (fresh) {
+        memcpy(fresh, ptr, old_size < new_size ? old_size : new_size);
+        memory_free(allocator, ptr, old_size);
+    }
+    return fresh;
+}
+
+/**
+ * @brief Frees through the hooks, or the C library when there are none
+ */
+static void memory_free(const StackAllocator* allocator, void* ptr, size_t size) {
+    if (allocator) {
+        allocator->deallocate(allocator->context, ptr, size);
+    } else {
+        free(ptr);
+    }
+}
+
+/**
+ * @brief Decides whether an array needs a placement-controlled mapping
+ */
+static bool wants_mapping(const StackOptions* options, size_t bytes) {
+    return options->numa_node != STACK_NUMA_NODE_ANY ||
+           options->huge_pages == STACK_HUGE_PAGES_ALWAYS ||
+           (options->huge_pages == STACK_HUGE_PAGES_AUTO && bytes >= STACK_HUGE_PAGE_SIZE);
+}
+
+/**
+ * @brief Maps element memory with huge page and NUMA hints applied
+ * @return Mapped array, or NULL if mapping is unavailable or failed
+ */
+static int* map_elements(const StackOptions* options, size_t bytes, size_t* mapped_bytes) {
+#if defined(__linux__)
+    bool huge = options->huge_pages == STACK_HUGE_PAGES_ALWAYS ||
+                (options->huge_pages == STACK_HUGE_PAGES_AUTO && bytes >= STACK_HUGE_PAGE_SIZE);
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t align = huge ? STACK_HUGE_PAGE_SIZE : page;
+    size_t length = round_up(bytes, align);
+    
+    /* Over-map so the array can start on a huge page boundary */
+    size_t slack = huge ? align : 0;
+    unsigned char* raw = mmap(NULL, length + slack, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        return NULL;
+    }
+    
+    unsigned char* start = (unsigned char*)round_up((size_t)raw, align);
+    if (start > raw) {
+        munmap(raw, (size_t)(start - raw));
+    }
+    if (raw + length + slack > start + length) {
+        munmap(start + length, (size_t)(raw + length + slack - (start + length)));
+    }
+    
+#if defined(MADV_HUGEPAGE)
+    if (huge) {
+        madvise(start, length, MADV_HUGEPAGE);  /* Advisory; ignore failure */
+    }
+#endif
+    
+#if defined(SYS_mbind)
+    if (options->numa_node != STACK_NUMA_NODE_ANY) {
+        unsigned long nodemask[(MAX_NUMA_NODE + 1) / (8 * sizeof(unsigned long))] = {0};
+        size_t bits = 8 * sizeof(unsigned long);
+        nodemask[(size_t)options->numa_node / bits] |= 1UL << ((size_t)options->numa_node % bits);
+        if (syscall(SYS_mbind, start, length, NUMA_POLICY_PREFERRED, nodemask,
+                    (unsigned long)(MAX_NUMA_NODE + 1), 0UL) != 0) {
+            munmap(start, length);
+            return NULL;
+        }
+    }
+#endif
+    
+    *mapped_bytes = length;
+    return (int*)(void*)start;
+#else
+    (void)options;
+    (void)bytes;
+    (void)mapped_bytes;
+    return NULL;
+#endif
+}
+
+/**
+ * @brief Allocates an element array honouring the placement options
+ */
+static int* allocate_elements(const StackOptions* options, const StackAllocator* allocator,
+                              size_t capacity, StorageKind* storage, size_t* mapped_bytes) {
+    size_t bytes = capacity * sizeof(int);
+    
+    /* Custom allocators own placement, so only the C library path maps */
+    if (!allocator && wants_mapping(options, bytes)) {
+        int* mapped = map_elements(options, bytes, mapped_bytes);
+        if (mapped) {
+            *storage = STORAGE_MAPPED;
+            return mapped;
+        }
+#if defined(__linux__) && defined(SYS_mbind)
+        /* An explicit node that could not be bound is an error */
+        if (options->numa_node != STACK_NUMA_NODE_ANY) {
+            return NULL;
+        }
+#endif
+    }
+    
+    *storage = STORAGE_HEAP;
+    return memory_allocate(allocator, bytes, element_alignment(options));
+}
+
+/**
+ * @brief Securely clears and frees the element array
+ */
+static void release_elements(Stack* stack) {
+    if (stack->elements) {
+        memset(stack->elements, 0, stack->storage_capacity * sizeof(int));
+#if defined(__linux__)
+        if (stack->storage == STORAGE_MAPPED) {
+            munmap(stack->elements, stack->mapped_bytes);
+        }
+#endif
+        if (stack->storage == STORAGE_HEAP) {
+            memory_free(stack->allocator, stack->elements, stack->storage_capacity * sizeof(int));
+        }
+        stack->elements = NULL;
+    }
+}
+
+/**
+ * @brief Moves a stack that has filled its inline storage to a full-capacity array
+ * @return STACK_SUCCESS, STACK_ERROR_OVERFLOW if the stack is at capacity, or
+ *         STACK_ERROR_MEMORY_ALLOCATION
+ */
+static StackResult spill_inline_elements(Stack* stack) {
+    if (stack->size >= stack->capacity) {
+        return STACK_ERROR_OVERFLOW;
+    }
+    
+    StorageKind storage;
+    size_t mapped_bytes = 0;
+    int* elements = allocate_elements(&stack->options, stack->allocator, stack->capacity,
+                                      &storage, &mapped_bytes);
+    if (!elements) {
+        return STACK_ERROR_MEMORY_ALLOCATION;
+    }
+    
+    /* Move live elements and zero the rest, as at creation */
+    memcpy(elements, stack->elements, stack->size * sizeof(int));
+    memset(elements + stack->size, 0, (stack->capacity - stack->size) * sizeof(int));
+    
+    /* The inline array is wiped as it is left behind */
+    release_elements(stack);
+    stack->elements = elements;
+    stack->storage = storage;
+    stack->mapped_bytes = mapped_bytes;
+    stack->storage_capacity = stack->capacity;
+    
+    return STACK_SUCCESS;
+}
+
+void stack_options_init(StackOptions* options) {
+    if (options) {
+        options->alignment = 0;
+        options->pad_header = false;
+        options->huge_pages = STACK_HUGE_PAGES_NEVER;
+        options->numa_node = STACK_NUMA_NODE_ANY;
     }
 }
 
 Stack* stack_create(size_t capacity) {
+    return stack_create_with_options(capacity, NULL);
+}
+
+Stack* stack_create_with_options(size_t capacity, const StackOptions* options) {
+    return stack_create_with_allocator(capacity, options, NULL);
+}
+
+Stack* stack_create_with_allocator(size_t capacity, const StackOptions* options,
+                                   const StackAllocator* allocator) {
+    StackOptions defaults;
+    if (!options) {
+        stack_options_init(&defaults);
+        options = &defaults;
+    }
+    
     /* Validate input parameters */
-    if (!is_valid_capacity(capacity)) {
+    if (!is_valid_capacity(capacity) || !is_valid_options(options)) {
+        return NULL;
+    }
+    if (allocator && (!allocator->allocate || !allocator->deallocate)) {
         return NULL;
     }
     
-    /* Allocate memory for stack structure */
-    Stack* stack = malloc(sizeof(Stack));
+    /* Allocate memory for stack structure, on its own cache lines if asked */
+    size_t header_alignment = options->pad_header ? STACK_CACHE_LINE_SIZE : alignof(Stack);
+    Stack* stack = memory_allocate(allocator, header_size(options), header_alignment);
     if (!stack) {
         return NULL;
     }
     
-    /* Allocate memory for stack elements */
-    stack->elements = malloc(capacity * sizeof(int));
-    if (!stack->elements) {
-        free(stack);
-        return NULL;
+    stack->options = *options;
+    stack->mapped_bytes = 0;
+    stack->allocator = NULL;
+    if (allocator) {
+        stack->allocator_hooks = *allocator;
+        stack->allocator = &stack->allocator_hooks;
+    }
+    
+    /*
+     * The first elements live in the header unless placement matters; the
+     * full array is allocated only when a push outgrows them.
+     */
+#if STACK_INLINE_CAPACITY > 0
+    if (options->alignment <= alignof(int) && !wants_mapping(options, capacity * sizeof(int))) {
+        stack->elements = stack->inline_elements;
+        stack->storage = STORAGE_INLINE;
+        stack->storage_capacity = capacity < STACK_INLINE_CAPACITY ? capacity : STACK_INLINE_CAPACITY;
+    } else
+#endif
+    {
+        /* Allocate memory for stack elements */
+        stack->elements = allocate_elements(options, stack->allocator, capacity,
+                                            &stack->storage, &stack->mapped_bytes);
+        if (!stack->elements) {
+            memory_free(allocator, stack, header_size(options));
+            return NULL;
+        }
+        stack->storage_capacity = capacity;
     }
     
     /* Initialize stack properties */
     stack->capacity = capacity;
     stack->size = 0;
     stack->top_index = 0;
+    stack->wipe_policy = STACK_WIPE_ALWAYS;
+    
+#ifdef DEBUG
+    /* Allocate mark validation stamps */
+    stack->push_stamps = memory_allocate(allocator, capacity * sizeof(size_t), alignof(size_t));
+    if (!stack->push_stamps) {
+        release_elements(stack);
+        memory_free(allocator, stack, header_size(options));
+        return NULL;
+    }
+    memset(stack->push_stamps, 0, capacity * sizeof(size_t));
+    stack->stamp_capacity = capacity;
+    stack->stamp_clock = 0;
+#endif
     
     /* Initialize memory for security */
     initialize_stack_memory(stack);
@@ -73,14 +419,18 @@ Stack* stack_create(size_t capacity) {
 void stack_destroy(Stack* stack) {
     if (stack) {
         /* Clear sensitive data before freeing */
-        if (stack->elements) {
-            memset(stack->elements, 0, stack->capacity * sizeof(int));
-            free(stack->elements);
-        }
+        release_elements(stack);
+        
+#ifdef DEBUG
+        memory_free(stack->allocator, stack->push_stamps, stack->stamp_capacity * sizeof(size_t));
+#endif
         
-        /* Clear stack structure */
+        /* Clear stack structure, keeping what is needed to free it */
+        StackAllocator hooks = stack->allocator_hooks;
+        const StackAllocator* allocator = stack->allocator ? &hooks : NULL;
+        size_t bytes = header_size(&stack->options);
         memset(stack, 0, sizeof(Stack));
-        free(stack);
+        memory_free(allocator, stack, bytes);
     }
 }
 
@@ -90,12 +440,19 @@ StackResult stack_push(Stack* stack, int value) {
         return STACK_ERROR_NULL_POINTER;
     }
     
-    if (stack_is_full(stack)) {
-        return STACK_ERROR_OVERFLOW;
+    /* Past the current array: full, or outgrowing inline storage */
+    if (stack->size >= stack->storage_capacity) {
+        StackResult result = spill_inline_elements(stack);
+        if (result != STACK_SUCCESS) {
+            return result;
+        }
     }
     
     /* Add element to stack */
     stack->elements[stack->size] = value;
+#ifdef DEBUG
+    stack->push_stamps[stack->size] = ++stack->stamp_clock;
+#endif
     stack->size++;
     stack->top_index = stack->size - 1;
     
@@ -117,7 +474,9 @@ StackResult stack_pop(Stack* stack, int* value) {
     *value = stack->elements[stack->size];
     
     /* Clear the popped element for security */
-    stack->elements[stack->size] = 0;
+    if (stack->wipe_policy == STACK_WIPE_ALWAYS) {
+        stack->elements[stack->size] = 0;
+    }
     
     /* Update top index */
     if (stack->size > 0) {
@@ -159,14 +518,122 @@ size_t stack_capacity(const Stack* stack) {
     return stack ? stack->capacity : 0;
 }
 
+const int* stack_data(const Stack* stack) {
+    return stack ? stack->elements : NULL;
+}
+
+void stack_iterator_init(StackIterator* iterator, const Stack* stack, StackOrder order) {
+    if (!iterator) {
+        return;
+    }
+    
+    iterator->data = stack ? stack->elements : NULL;
+    iterator->remaining = stack ? stack->size : 0;
+    iterator->next = order == STACK_ORDER_TOP_DOWN ? iterator->remaining - 1 : 0;
+    iterator->order = order;
+}
+
+bool stack_iterator_next(StackIterator* iterator, int* value) {
+    if (!iterator || !value || iterator->remaining == 0) {
+        return false;
+    }
+    
+    *value = iterator->data[iterator->next];
+    iterator->remaining--;
+    if (iterator->order == STACK_ORDER_TOP_DOWN) {
+        iterator->next--;
+    } else {
+        iterator->next++;
+    }
+    return true;
+}
+
+StackResult stack_reserve(Stack* stack, size_t capacity) {
+    /* Validate input parameters */
+    if (!stack) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+    
+    if (capacity <= stack->capacity) {
+        return STACK_SUCCESS;
+    }
+    
+    if (!is_valid_capacity(capacity)) {
+        return STACK_ERROR_INVALID_CAPACITY;
+    }
+    
+#ifdef DEBUG
+    /* Stamps grow first; spare stamp slots are harmless if elements fail */
+    if (capacity > stack->stamp_capacity) {
+        size_t* stamps = memory_reallocate(stack->allocator, stack->push_stamps,
+                                           stack->stamp_capacity * sizeof(size_t),
+                                           capacity * sizeof(size_t), alignof(size_t));
+        if (!stamps) {
+            return STACK_ERROR_MEMORY_ALLOCATION;
+        }
+        memset(stamps + stack->stamp_capacity, 0, (capacity - stack->stamp_capacity) * sizeof(size_t));
+        stack->push_stamps = stamps;
+        stack->stamp_capacity = capacity;
+    }
+#endif
+    
+#if STACK_INLINE_CAPACITY > 0
+    /* Inline storage stays until a push outgrows it; the heap array is sized then */
+    if (stack->storage == STORAGE_INLINE) {
+        size_t slots = capacity < STACK_INLINE_CAPACITY ? capacity : STACK_INLINE_CAPACITY;
+        memset(stack->elements + stack->storage_capacity, 0, (slots - stack->storage_capacity) * sizeof(int));
+        stack->storage_capacity = slots;
+        stack->capacity = capacity;
+        return STACK_SUCCESS;
+    }
+#endif
+    
+    /* Without wiping, heap storage can grow in place */
+    if (stack->wipe_policy == STACK_WIPE_NEVER && stack->storage == STORAGE_HEAP) {
+        int* grown = memory_reallocate(stack->allocator, stack->elements,
+                                       stack->capacity * sizeof(int), capacity * sizeof(int),
+                                       element_alignment(&stack->options));
+        if (!grown) {
+            return STACK_ERROR_MEMORY_ALLOCATION;
+        }
+        memset(grown + stack->capacity, 0, (capacity - stack->capacity) * sizeof(int));
+        stack->elements = grown;
+        stack->capacity = capacity;
+        stack->storage_capacity = capacity;
+        return STACK_SUCCESS;
+    }
+    
+    StorageKind storage;
+    size_t mapped_bytes = 0;
+    int* elements = allocate_elements(&stack->options, stack->allocator, capacity,
+                                      &storage, &mapped_bytes);
+    if (!elements) {
+        return STACK_ERROR_MEMORY_ALLOCATION;
+    }
+    
+    /* Move live elements and zero the rest, as at creation */
+    memcpy(elements, stack->elements, stack->size * sizeof(int));
+    memset(elements + stack->size, 0, (capacity - stack->size) * sizeof(int));
+    
+    /* The old array is wiped before it is released */
+    release_elements(stack);
+    stack->elements = elements;
+    stack->storage = storage;
+    stack->mapped_bytes = mapped_bytes;
+    stack->capacity = capacity;
+    stack->storage_capacity = capacity;
+    
+    return STACK_SUCCESS;
+}
+
 StackResult stack_clear(Stack* stack) {
     if (!stack) {
         return STACK_ERROR_NULL_POINTER;
     }
     
     /* Clear all elements securely */
-    if (stack->elements) {
-        memset(stack->elements, 0, stack->capacity * sizeof(int));
+    if (stack->elements && stack->wipe_policy == STACK_WIPE_ALWAYS) {
+        memset(stack->elements, 0, stack->storage_capacity * sizeof(int));
     }
     
     /* Reset stack state */
@@ -176,6 +643,59 @@ StackResult stack_clear(Stack* stack) {
     return STACK_SUCCESS;
 }
 
+StackResult stack_set_wipe_policy(Stack* stack, StackWipePolicy policy) {
+    if (!stack) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+    
+    stack->wipe_policy = policy;
+    
+    return STACK_SUCCESS;
+}
+
+StackMark stack_mark(const Stack* stack) {
+    StackMark mark = { 0, 0 };
+    
+    if (stack) {
+        mark.size = stack->size;
+#ifdef DEBUG
+        mark.stamp = stack->stamp_clock;
+#endif
+    }
+    
+    return mark;
+}
+
+StackResult stack_rewind(Stack* stack, StackMark mark) {
+    /* Validate input parameters */
+    if (!stack) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+    
+    /* A mark above the current top was already discarded */
+    if (mark.size > stack->size) {
+        return STACK_ERROR_INVALID_MARK;
+    }
+    
+#ifdef DEBUG
+    /* The slot under the mark must still hold the value pushed before it */
+    if (mark.size > 0 && stack->push_stamps[mark.size - 1] > mark.stamp) {
+        return STACK_ERROR_INVALID_MARK;
+    }
+#endif
+    
+    /* Only the discarded slots are touched, and only if policy demands */
+    if (stack->wipe_policy == STACK_WIPE_ALWAYS) {
+        memset(stack->elements + mark.size, 0,
+               (stack->size - mark.size) * sizeof(int));
+    }
+    
+    stack->size = mark.size;
+    stack->top_index = mark.size > 0 ? mark.size - 1 : 0;
+    
+    return STACK_SUCCESS;
+}
+
 const char* stack_error_string(StackResult result) {
     switch (result) {
         case STACK_SUCCESS:
@@ -190,6 +710,18 @@ const char* stack_error_string(StackResult result) {
             return "Stack underflow - cannot pop from empty stack";
         case STACK_ERROR_INVALID_CAPACITY:
             return "Invalid capacity specified";
+        case STACK_ERROR_INVALID_MARK:
+            return "Checkpoint mark is no longer valid for this stack";
+        case STACK_ERROR_UNSUPPORTED:
+            return "Operation not enabled for this stack";
+        case STACK_ERROR_CONTENDED:
+            return "Operation lost a race with another thread; retry";
+        case STACK_ERROR_TIMEOUT:
+            return "Timed out waiting for the stack";
+        case STACK_ERROR_IO:
+            return "Spill file I/O failed";
+        case STACK_ERROR_INVALID_INDEX:
+            return "Stack index out of range";
         default:
             return "Unknown error";
     }
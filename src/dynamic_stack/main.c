@@ -13,6 +13,7 @@
 #include <stdbool.h>
 #include <limits.h>
 #include "dynamic_stack.h"
+#include "stack_vm.h"
 
 /* Constants for demonstration */
 #define DEMO_STACK_CAPACITY 10
@@ -72,13 +73,42 @@ static void demonstrate_basic_operations(Stack* stack) {
     }
 }
 
+/**
+ * @brief Compiles an expression and pushes its result(s) onto the stack
+ * @param stack Pointer to the stack
+ * @param source Expression text
+ * @param syntax Syntax of the expression
+ */
+static void evaluate_expression(Stack* stack, const char* source, StackVmSyntax syntax) {
+    size_t length = strcspn(source, "\n");
+    StackVmProgram* program;
+    size_t error_offset;
+    
+    StackVmResult result = stack_vm_compile(source, length, syntax, &program, &error_offset);
+    if (result != STACK_VM_SUCCESS) {
+        printf("Error at column %zu: %s\n", error_offset + 1, stack_vm_error_string(result));
+        return;
+    }
+    
+    result = stack_vm_run(program, NULL, 0, stack);
+    if (result == STACK_VM_SUCCESS) {
+        int value;
+        stack_peek(stack, &value);
+        printf("Result %d pushed (%zu bytecode instructions). Stack size: %zu\n",
+               value, stack_vm_instruction_count(program), stack_size(stack));
+    } else {
+        printf("Error: %s\n", stack_vm_error_string(result));
+    }
+    stack_vm_destroy(program);
+}
+
 /**
  * @brief Interactive stack operations
  * @param stack Pointer to the stack
  */
 static void interactive_operations(Stack* stack) {
     printf("\n=== Interactive Stack Operations ===\n");
-    printf("Commands: push <value>, pop, peek, size, clear, quit\n");
+    printf("Commands: push <value>, pop, peek, show, size, clear, eval <expression>, rpn <program>, quit\n");
     
     char command[INPUT_BUFFER_SIZE];
     int value;
@@ -119,6 +149,16 @@ static void interactive_operations(Stack* stack) {
                 printf("Error: %s\n", stack_error_string(result));
             }
         }
+        else if (strncmp(command, "show", 4) == 0) {
+            /* Read the elements in place; nothing is popped */
+            StackIterator iterator;
+            stack_iterator_init(&iterator, stack, STACK_ORDER_TOP_DOWN);
+            printf("Top ->");
+            while (stack_iterator_next(&iterator, &value)) {
+                printf(" %d", value);
+            }
+            printf(" (%zu elements)\n", stack_size(stack));
+        }
         else if (strncmp(command, "size", 4) == 0) {
             printf("Stack size: %zu/%zu\n", stack_size(stack), stack_capacity(stack));
         }
@@ -130,11 +170,17 @@ static void interactive_operations(Stack* stack) {
                 printf("Error: %s\n", stack_error_string(result));
             }
         }
+        else if (strncmp(command, "eval", 4) == 0) {
+            evaluate_expression(stack, command + 4, STACK_VM_SYNTAX_INFIX);
+        }
+        else if (strncmp(command, "rpn", 3) == 0) {
+            evaluate_expression(stack, command + 3, STACK_VM_SYNTAX_RPN);
+        }
         else if (strncmp(command, "quit", 4) == 0) {
             break;
         }
         else {
-            printf("Unknown command. Available: push, pop, peek, size, clear, quit\n");
+            printf("Unknown command. Available: push, pop, peek, show, size, clear, eval, rpn, quit\n");
         }
     }
 }
@@ -0,0 +1,287 @@
+/**
+ * @file minmax_stack.c
+ * @brief Aggregate-Tracking Stack Implementation
+ * @author Jaden Mardini
+ *
+ * Each tracked extremum keeps a small record stack of element positions.
+ * A position is recorded only when a push strictly improves the current
+ * extremum, and is dropped when that element is popped, so the top record
+ * always names the current minimum (or maximum). Record arrays start small
+ * and grow geometrically, never exceeding the stack capacity.
+ */
+
+#include "minmax_stack.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Initial number of slots in each extremum record */
+#define RECORD_INITIAL_CAPACITY 16
+
+/* Positions of successive extrema, bottom to top */
+typedef struct {
+    uint32_t* positions;    /* Element indices of recorded extrema */
+    size_t count;           /* Number of recorded extrema */
+    size_t capacity;        /* Allocated slots */
+} ExtremumRecord;
+
+/* Stack structure definition (opaque to users) */
+struct MinMaxStack {
+    int* elements;          /* Array to store stack elements */
+    size_t capacity;        /* Maximum number of elements */
+    size_t size;            /* Current number of elements */
+    unsigned track_flags;   /* MINMAX_STACK_TRACK_* flags */
+    ExtremumRecord min_record;
+    ExtremumRecord max_record;
+    long long sum;          /* Running sum of elements */
+};
+
+/* Static function prototypes */
+static bool is_valid_capacity(size_t capacity);
+static bool record_reserve(ExtremumRecord* record, size_t limit);
+static void record_release(ExtremumRecord* record);
+
+/**
+ * @brief Validates if capacity is within acceptable range
+ */
+static bool is_valid_capacity(size_t capacity) {
+    return capacity >= STACK_MIN_CAPACITY && capacity <= STACK_MAX_CAPACITY;
+}
+
+/**
+ * @brief Ensures room for one more record entry
+ */
+static bool record_reserve(ExtremumRecord* record, size_t limit) {
+    if (record->count < record->capacity) {
+        return true;
+    }
+
+    size_t new_capacity = record->capacity ? record->capacity * 2 : RECORD_INITIAL_CAPACITY;
+    if (new_capacity > limit) {
+        new_capacity = limit;
+    }
+
+    uint32_t* positions = realloc(record->positions, new_capacity * sizeof(uint32_t));
+    if (!positions) {
+        return false;
+    }
+
+    record->positions = positions;
+    record->capacity = new_capacity;
+    return true;
+}
+
+/**
+ * @brief Frees a record's storage
+ */
+static void record_release(ExtremumRecord* record) {
+    free(record->positions);
+    record->positions = NULL;
+    record->count = 0;
+    record->capacity = 0;
+}
+
+MinMaxStack* minmax_stack_create(size_t capacity, unsigned track_flags) {
+    /* Validate input parameters */
+    if (!is_valid_capacity(capacity)) {
+        return NULL;
+    }
+
+    MinMaxStack* stack = calloc(1, sizeof(MinMaxStack));
+    if (!stack) {
+        return NULL;
+    }
+
+    /* Zeroed for security, like the plain Stack */
+    stack->elements = calloc(capacity, sizeof(int));
+    if (!stack->elements) {
+        free(stack);
+        return NULL;
+    }
+
+    stack->capacity = capacity;
+    stack->track_flags = track_flags & MINMAX_STACK_TRACK_ALL;
+
+    return stack;
+}
+
+void minmax_stack_destroy(MinMaxStack* stack) {
+    if (stack) {
+        /* Clear sensitive data before freeing */
+        if (stack->elements) {
+            memset(stack->elements, 0, stack->capacity * sizeof(int));
+            free(stack->elements);
+        }
+
+        record_release(&stack->min_record);
+        record_release(&stack->max_record);
+
+        memset(stack, 0, sizeof(MinMaxStack));
+        free(stack);
+    }
+}
+
+StackResult minmax_stack_push(MinMaxStack* stack, int value) {
+    /* Validate input parameters */
+    if (!stack) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (stack->size >= stack->capacity) {
+        return STACK_ERROR_OVERFLOW;
+    }
+
+    /* Decide on record updates first so a failed allocation changes nothing */
+    bool new_min = (stack->track_flags & MINMAX_STACK_TRACK_MIN) &&
+                   (stack->min_record.count == 0 ||
+                    value < stack->elements[stack->min_record.positions[stack->min_record.count - 1]]);
+    bool new_max = (stack->track_flags & MINMAX_STACK_TRACK_MAX) &&
+                   (stack->max_record.count == 0 ||
+                    value > stack->elements[stack->max_record.positions[stack->max_record.count - 1]]);
+
+    if ((new_min && !record_reserve(&stack->min_record, stack->capacity)) ||
+        (new_max && !record_reserve(&stack->max_record, stack->capacity))) {
+        return STACK_ERROR_MEMORY_ALLOCATION;
+    }
+
+    if (new_min) {
+        stack->min_record.positions[stack->min_record.count++] = (uint32_t)stack->size;
+    }
+    if (new_max) {
+        stack->max_record.positions[stack->max_record.count++] = (uint32_t)stack->size;
+    }
+
+    stack->sum += value;
+    stack->elements[stack->size++] = value;
+
+    return STACK_SUCCESS;
+}
+
+StackResult minmax_stack_pop(MinMaxStack* stack, int* value) {
+    /* Validate input parameters */
+    if (!stack || !value) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (stack->size == 0) {
+        return STACK_ERROR_UNDERFLOW;
+    }
+
+    stack->size--;
+    *value = stack->elements[stack->size];
+
+    /* Drop extrema that were introduced by this element */
+    if (stack->min_record.count > 0 &&
+        stack->min_record.positions[stack->min_record.count - 1] == stack->size) {
+        stack->min_record.count--;
+    }
+    if (stack->max_record.count > 0 &&
+        stack->max_record.positions[stack->max_record.count - 1] == stack->size) {
+        stack->max_record.count--;
+    }
+
+    stack->sum -= *value;
+
+    /* Clear the popped element for security */
+    stack->elements[stack->size] = 0;
+
+    return STACK_SUCCESS;
+}
+
+StackResult minmax_stack_peek(const MinMaxStack* stack, int* value) {
+    /* Validate input parameters */
+    if (!stack || !value) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (stack->size == 0) {
+        return STACK_ERROR_UNDERFLOW;
+    }
+
+    *value = stack->elements[stack->size - 1];
+
+    return STACK_SUCCESS;
+}
+
+StackResult minmax_stack_min(const MinMaxStack* stack, int* value) {
+    if (!stack || !value) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (!(stack->track_flags & MINMAX_STACK_TRACK_MIN)) {
+        return STACK_ERROR_UNSUPPORTED;
+    }
+
+    if (stack->size == 0) {
+        return STACK_ERROR_UNDERFLOW;
+    }
+
+    *value = stack->elements[stack->min_record.positions[stack->min_record.count - 1]];
+
+    return STACK_SUCCESS;
+}
+
+StackResult minmax_stack_max(const MinMaxStack* stack, int* value) {
+    if (!stack || !value) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (!(stack->track_flags & MINMAX_STACK_TRACK_MAX)) {
+        return STACK_ERROR_UNSUPPORTED;
+    }
+
+    if (stack->size == 0) {
+        return STACK_ERROR_UNDERFLOW;
+    }
+
+    *value = stack->elements[stack->max_record.positions[stack->max_record.count - 1]];
+
+    return STACK_SUCCESS;
+}
+
+StackResult minmax_stack_sum(const MinMaxStack* stack, long long* sum) {
+    if (!stack || !sum) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (!(stack->track_flags & MINMAX_STACK_TRACK_SUM)) {
+        return STACK_ERROR_UNSUPPORTED;
+    }
+
+    *sum = stack->sum;
+
+    return STACK_SUCCESS;
+}
+
+bool minmax_stack_is_empty(const MinMaxStack* stack) {
+    return !stack || stack->size == 0;
+}
+
+bool minmax_stack_is_full(const MinMaxStack* stack) {
+    return stack && stack->size >= stack->capacity;
+}
+
+size_t minmax_stack_size(const MinMaxStack* stack) {
+    return stack ? stack->size : 0;
+}
+
+size_t minmax_stack_capacity(const MinMaxStack* stack) {
+    return stack ? stack->capacity : 0;
+}
+
+StackResult minmax_stack_clear(MinMaxStack* stack) {
+    if (!stack) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    /* Clear all elements securely */
+    memset(stack->elements, 0, stack->capacity * sizeof(int));
+
+    /* Records keep their allocation for reuse */
+    stack->min_record.count = 0;
+    stack->max_record.count = 0;
+    stack->size = 0;
+    stack->sum = 0;
+
+    return STACK_SUCCESS;
+}
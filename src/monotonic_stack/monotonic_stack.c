@@ -0,0 +1,343 @@
+/**
+ * @file monotonic_stack.c
+ * @brief Monotonic-Stack Algorithm Kernels Implementation
+ * @author Jaden Mardini
+ *
+ * The kernels keep their stack of indices in a plain array owned by the
+ * workspace and hold the stack depth in a local variable, so the inner
+ * loops compile down to a compare, a load and a store per step with no
+ * function calls, bounds re-checks or slot wiping. The workspace is sized
+ * once per call to the input length, which bounds the stack depth.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "monotonic_stack.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+/* Workspace structure definition (opaque to users) */
+struct MonotonicWorkspace {
+    size_t* indices;        /* Index stack storage */
+    size_t capacity;        /* Allocated index slots */
+};
+
+/* Shared state for batch worker threads */
+typedef struct {
+    MonotonicJob* jobs;
+    size_t job_count;
+    atomic_size_t next_job;
+} BatchState;
+
+/* Static function prototypes */
+static bool workspace_reserve(MonotonicWorkspace* workspace, size_t capacity);
+static size_t* acquire_indices(MonotonicWorkspace* workspace, MonotonicWorkspace* fallback, size_t count);
+static void release_indices(MonotonicWorkspace* fallback);
+static StackResult run_job(MonotonicWorkspace* workspace, MonotonicJob* job);
+static void* batch_worker(void* arg);
+
+/**
+ * @brief Grows a workspace to hold at least capacity indices
+ */
+static bool workspace_reserve(MonotonicWorkspace* workspace, size_t capacity) {
+    if (capacity <= workspace->capacity) {
+        return true;
+    }
+
+    size_t* indices = realloc(workspace->indices, capacity * sizeof(size_t));
+    if (!indices) {
+        return false;
+    }
+
+    workspace->indices = indices;
+    workspace->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Returns index storage for count elements, using a temporary
+ *        workspace when the caller supplied none
+ */
+static size_t* acquire_indices(MonotonicWorkspace* workspace, MonotonicWorkspace* fallback, size_t count) {
+    MonotonicWorkspace* target = workspace ? workspace : fallback;
+    /* One extra slot lets the rectangle kernel flush with a sentinel */
+    if (!workspace_reserve(target, count + 1)) {
+        return NULL;
+    }
+    return target->indices;
+}
+
+/**
+ * @brief Frees a temporary workspace's storage
+ */
+static void release_indices(MonotonicWorkspace* fallback) {
+    free(fallback->indices);
+}
+
+/*
+ * Kernel bodies. Each is expanded for one comparison so the compiler emits
+ * a branch-lean loop per variant rather than testing a mode flag per step.
+ */
+
+/* Resolves pending indices when a value beating them arrives */
+#define NEXT_KERNEL(values, count, out, stack, BEATS) do { \
+    size_t depth = 0; \
+    for (size_t i = 0; i < (count); i++) { \
+        int current = (values)[i]; \
+        while (depth > 0 && BEATS(current, (values)[(stack)[depth - 1]])) { \
+            (out)[(stack)[--depth]] = i; \
+        } \
+        (stack)[depth++] = i; \
+    } \
+    while (depth > 0) { \
+        (out)[(stack)[--depth]] = MONOTONIC_NONE; \
+    } \
+} while (0)
+
+/* Discards candidates that cannot beat the current value, then reports the top */
+#define PREVIOUS_KERNEL(values, count, out, stack, BEATS) do { \
+    size_t depth = 0; \
+    for (size_t i = 0; i < (count); i++) { \
+        int current = (values)[i]; \
+        while (depth > 0 && !BEATS((values)[(stack)[depth - 1]], current)) { \
+            depth--; \
+        } \
+        (out)[i] = depth > 0 ? (stack)[depth - 1] : MONOTONIC_NONE; \
+        (stack)[depth++] = i; \
+    } \
+} while (0)
+
+#define GREATER(a, b) ((a) > (b))
+#define SMALLER(a, b) ((a) < (b))
+
+MonotonicWorkspace* monotonic_workspace_create(size_t initial_capacity) {
+    MonotonicWorkspace* workspace = malloc(sizeof(MonotonicWorkspace));
+    if (!workspace) {
+        return NULL;
+    }
+
+    workspace->indices = NULL;
+    workspace->capacity = 0;
+
+    if (!workspace_reserve(workspace, initial_capacity)) {
+        free(workspace);
+        return NULL;
+    }
+
+    return workspace;
+}
+
+void monotonic_workspace_destroy(MonotonicWorkspace* workspace) {
+    if (workspace) {
+        free(workspace->indices);
+        free(workspace);
+    }
+}
+
+StackResult monotonic_next_greater(MonotonicWorkspace* workspace, const int* values,
+                                   size_t count, size_t* indices) {
+    if (!values || !indices) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    MonotonicWorkspace fallback = { NULL, 0 };
+    size_t* stack = acquire_indices(workspace, &fallback, count);
+    if (!stack) {
+        return STACK_ERROR_MEMORY_ALLOCATION;
+    }
+
+    NEXT_KERNEL(values, count, indices, stack, GREATER);
+
+    release_indices(&fallback);
+    return STACK_SUCCESS;
+}
+
+StackResult monotonic_next_smaller(MonotonicWorkspace* workspace, const int* values,
+                                   size_t count, size_t* indices) {
+    if (!values || !indices) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    MonotonicWorkspace fallback = { NULL, 0 };
+    size_t* stack = acquire_indices(workspace, &fallback, count);
+    if (!stack) {
+        return STACK_ERROR_MEMORY_ALLOCATION;
+    }
+
+    NEXT_KERNEL(values, count, indices, stack, SMALLER);
+
+    release_indices(&fallback);
+    return STACK_SUCCESS;
+}
+
+StackResult monotonic_previous_greater(MonotonicWorkspace* workspace, const int* values,
+                                       size_t count, size_t* indices) {
+    if (!values || !indices) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    MonotonicWorkspace fallback = { NULL, 0 };
+    size_t* stack = acquire_indices(workspace, &fallback, count);
+    if (!stack) {
+        return STACK_ERROR_MEMORY_ALLOCATION;
+    }
+
+    PREVIOUS_KERNEL(values, count, indices, stack, GREATER);
+
+    release_indices(&fallback);
+    return STACK_SUCCESS;
+}
+
+StackResult monotonic_previous_smaller(MonotonicWorkspace* workspace, const int* values,
+                                       size_t count, size_t* indices) {
+    if (!values || !indices) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    MonotonicWorkspace fallback = { NULL, 0 };
+    size_t* stack = acquire_indices(workspace, &fallback, count);
+    if (!stack) {
+        return STACK_ERROR_MEMORY_ALLOCATION;
+    }
+
+    PREVIOUS_KERNEL(values, count, indices, stack, SMALLER);
+
+    release_indices(&fallback);
+    return STACK_SUCCESS;
+}
+
+StackResult monotonic_stock_span(MonotonicWorkspace* workspace, const int* prices,
+                                 size_t count, size_t* spans) {
+    /* Span is the distance back to the previous strictly greater price */
+    StackResult result = monotonic_previous_greater(workspace, prices, count, spans);
+    if (result != STACK_SUCCESS) {
+        return result;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        spans[i] = spans[i] == MONOTONIC_NONE ? i + 1 : i - spans[i];
+    }
+
+    return STACK_SUCCESS;
+}
+
+StackResult monotonic_largest_rectangle(MonotonicWorkspace* workspace, const int* heights,
+                                        size_t count, long long* area) {
+    if (!heights || !area) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    MonotonicWorkspace fallback = { NULL, 0 };
+    size_t* stack = acquire_indices(workspace, &fallback, count);
+    if (!stack) {
+        return STACK_ERROR_MEMORY_ALLOCATION;
+    }
+
+    long long best = 0;
+    size_t depth = 0;
+
+    /* Position count acts as a zero-height sentinel that flushes the stack */
+    for (size_t i = 0; i <= count; i++) {
+        int current = i < count ? heights[i] : 0;
+        while (depth > 0 && heights[stack[depth - 1]] >= current) {
+            long long height = heights[stack[--depth]];
+            size_t left = depth > 0 ? stack[depth - 1] + 1 : 0;
+            long long candidate = height * (long long)(i - left);
+            if (candidate > best) {
+                best = candidate;
+            }
+        }
+        stack[depth++] = i;
+    }
+
+    *area = best;
+
+    release_indices(&fallback);
+    return STACK_SUCCESS;
+}
+
+/**
+ * @brief Dispatches a single batch job to its kernel
+ */
+static StackResult run_job(MonotonicWorkspace* workspace, MonotonicJob* job) {
+    switch (job->kernel) {
+        case MONOTONIC_NEXT_GREATER:
+            return monotonic_next_greater(workspace, job->values, job->count, job->indices);
+        case MONOTONIC_NEXT_SMALLER:
+            return monotonic_next_smaller(workspace, job->values, job->count, job->indices);
+        case MONOTONIC_PREVIOUS_GREATER:
+            return monotonic_previous_greater(workspace, job->values, job->count, job->indices);
+        case MONOTONIC_PREVIOUS_SMALLER:
+            return monotonic_previous_smaller(workspace, job->values, job->count, job->indices);
+        case MONOTONIC_STOCK_SPAN:
+            return monotonic_stock_span(workspace, job->values, job->count, job->indices);
+        case MONOTONIC_LARGEST_RECTANGLE:
+            return monotonic_largest_rectangle(workspace, job->values, job->count, &job->area);
+        default:
+            return STACK_ERROR_UNSUPPORTED;
+    }
+}
+
+/**
+ * @brief Worker loop: claims jobs until none remain, reusing one workspace
+ */
+static void* batch_worker(void* arg) {
+    BatchState* state = arg;
+    MonotonicWorkspace workspace = { NULL, 0 };
+
+    for (;;) {
+        size_t index = atomic_fetch_add_explicit(&state->next_job, 1, memory_order_relaxed);
+        if (index >= state->job_count) {
+            break;
+        }
+        state->jobs[index].result = run_job(&workspace, &state->jobs[index]);
+    }
+
+    free(workspace.indices);
+    return NULL;
+}
+
+StackResult monotonic_run_batch(MonotonicJob* jobs, size_t job_count, size_t thread_count) {
+    if (!jobs && job_count > 0) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    BatchState state;
+    state.jobs = jobs;
+    state.job_count = job_count;
+    atomic_init(&state.next_job, 0);
+
+    if (thread_count > job_count) {
+        thread_count = job_count;
+    }
+
+    /* Extra threads beyond the caller; the caller always works too */
+    size_t spawned = 0;
+    pthread_t* threads = NULL;
+    if (thread_count > 1) {
+        threads = malloc((thread_count - 1) * sizeof(pthread_t));
+        if (threads) {
+            while (spawned < thread_count - 1 &&
+                   pthread_create(&threads[spawned], NULL, batch_worker, &state) == 0) {
+                spawned++;
+            }
+        }
+    }
+
+    batch_worker(&state);
+
+    for (size_t i = 0; i < spawned; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+
+    for (size_t i = 0; i < job_count; i++) {
+        if (jobs[i].result != STACK_SUCCESS) {
+            return jobs[i].result;
+        }
+    }
+
+    return STACK_SUCCESS;
+}
@@ -0,0 +1,288 @@
+/**
+ * @file multi_stack.c
+ * @brief Multiple Stacks in One Buffer Implementation
+ * @author Jaden Mardini
+ *
+ * The handle, the per-stack Bounds entries and the element buffer are
+ * laid out back to back in one zeroed allocation.
+ *
+ * Stack i occupies slots base up to top of its Bounds entry and may grow
+ * up to the base of entry i + 1; a final entry holds the capacity as its
+ * base. With two stacks, stack 0 grows up from the start of the buffer
+ * and stack 1 grows down from the end: its base and top both name its
+ * lowest used slot, so stack 0 grows towards it through the same check,
+ * and neither stack ever has to move.
+ *
+ * Otherwise, when a push finds no room, the free slots of the whole
+ * buffer are dealt out again (Garwick's reallocation): a tenth is shared
+ * evenly and the rest in proportion to how much each stack has grown
+ * since the previous reallocation, so the stacks that are filling up
+ * receive most of the room and reallocations become rarer. Stacks that
+ * move down are shifted in ascending order and stacks that move up in
+ * descending order, so no stack overwrites another before it moves.
+ * Popped slots and the free slots left behind by a move are zeroed.
+ */
+
+#include "multi_stack.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Keeps the reallocation out of line so the push fast path stays small */
+#if defined(__GNUC__)
+#define MULTI_STACK_COLD __attribute__((noinline, cold))
+#else
+#define MULTI_STACK_COLD
+#endif
+
+/* Slots owned by one stack */
+typedef struct {
+    size_t base;            /* First slot */
+    size_t top;             /* One past the top element */
+    size_t settled;         /* Size at the last reallocation */
+    size_t next_base;       /* Scratch space for computing a reallocation */
+} Bounds;
+
+/* Container structure definition (opaque to users) */
+struct MultiStack {
+    size_t stack_count;     /* Number of stacks */
+    size_t capacity;        /* Total slots in data */
+    size_t down_index;      /* Stack growing down from the end, or SIZE_MAX if none */
+    Bounds* bounds;         /* stack_count + 1 entries */
+    int* data;              /* Element buffer shared by all stacks */
+};
+
+/* Static function prototypes */
+static bool is_valid_capacity(size_t capacity);
+static inline size_t size_of(const MultiStack* stacks, size_t index);
+static MULTI_STACK_COLD bool reallocate(MultiStack* stacks, size_t index);
+
+/**
+ * @brief Validates if capacity is within acceptable range
+ */
+static bool is_valid_capacity(size_t capacity) {
+    return capacity >= STACK_MIN_CAPACITY && capacity <= STACK_MAX_CAPACITY;
+}
+
+/**
+ * @brief Returns the number of elements on a stack
+ */
+static inline size_t size_of(const MultiStack* stacks, size_t index) {
+    if (index == stacks->down_index) {
+        return stacks->capacity - stacks->bounds[index].top;
+    }
+    return stacks->bounds[index].top - stacks->bounds[index].base;
+}
+
+/**
+ * @brief Redistributes free slots so the given stack gains room
+ * @return true if the stack has room for a push, false if the buffer is full
+ */
+static bool reallocate(MultiStack* stacks, size_t index) {
+    size_t count = stacks->stack_count;
+    Bounds* bounds = stacks->bounds;
+    size_t used = 0;
+    uint64_t total_growth = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        size_t size = bounds[i].top - bounds[i].base;
+        used += size;
+        total_growth += size > bounds[i].settled ? size - bounds[i].settled : 0;
+    }
+    total_growth++;     /* The push that found no room */
+
+    size_t free_slots = stacks->capacity - used;
+    if (free_slots == 0) {
+        return false;
+    }
+
+    /* A tenth shared evenly, the rest by growth; rounding leftovers go to index */
+    size_t even_share = free_slots / 10 / count;
+    size_t by_growth = free_slots - even_share * count;
+    size_t leftover = by_growth;
+    size_t position = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t size = bounds[i].top - bounds[i].base;
+        uint64_t growth = (size > bounds[i].settled ? size - bounds[i].settled : 0) + (i == index);
+        size_t share = (size_t)(growth * by_growth / total_growth);
+        leftover -= share;
+        bounds[i].next_base = position;
+        position += size + even_share + share;
+    }
+    for (size_t i = index + 1; i < count; i++) {
+        bounds[i].next_base += leftover;
+    }
+
+    /* Shift stacks down in ascending order, then up in descending order */
+    for (size_t i = 1; i < count; i++) {
+        if (bounds[i].next_base < bounds[i].base) {
+            memmove(stacks->data + bounds[i].next_base, stacks->data + bounds[i].base,
+                    (bounds[i].top - bounds[i].base) * sizeof(int));
+        }
+    }
+    for (size_t i = count; i-- > 1;) {
+        if (bounds[i].next_base > bounds[i].base) {
+            memmove(stacks->data + bounds[i].next_base, stacks->data + bounds[i].base,
+                    (bounds[i].top - bounds[i].base) * sizeof(int));
+        }
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        size_t size = bounds[i].top - bounds[i].base;
+        size_t end = i + 1 < count ? bounds[i + 1].next_base : stacks->capacity;
+        bounds[i].base = bounds[i].next_base;
+        bounds[i].top = bounds[i].base + size;
+        bounds[i].settled = size;
+        memset(stacks->data + bounds[i].top, 0, (end - bounds[i].top) * sizeof(int));
+    }
+    return true;
+}
+
+MultiStack* multi_stack_create(size_t stack_count, size_t capacity) {
+    if (stack_count == 0 || stack_count > MULTI_STACK_MAX_STACKS || !is_valid_capacity(capacity)) {
+        return NULL;
+    }
+
+    /* Bounds and elements follow the handle in the same block */
+    MultiStack* stacks = calloc(1, sizeof(MultiStack) + (stack_count + 1) * sizeof(Bounds) + capacity * sizeof(int));
+    if (!stacks) {
+        return NULL;
+    }
+
+    stacks->stack_count = stack_count;
+    stacks->capacity = capacity;
+    stacks->bounds = (Bounds*)(void*)(stacks + 1);
+    stacks->data = (int*)(void*)(stacks->bounds + stack_count + 1);
+
+    if (stack_count == 2) {
+        stacks->down_index = 1;
+        stacks->bounds[1].base = capacity;
+        stacks->bounds[1].top = capacity;
+    } else {
+        /* Start with equal regions */
+        stacks->down_index = SIZE_MAX;
+        for (size_t i = 0; i < stack_count; i++) {
+            stacks->bounds[i].base = (size_t)((uint64_t)i * capacity / stack_count);
+            stacks->bounds[i].top = stacks->bounds[i].base;
+        }
+    }
+    stacks->bounds[stack_count].base = capacity;
+    return stacks;
+}
+
+void multi_stack_destroy(MultiStack* stacks) {
+    free(stacks);
+}
+
+StackResult multi_stack_push(MultiStack* stacks, size_t index, int value) {
+    /* Validate input parameters */
+    if (!stacks) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+    if (index >= stacks->stack_count) {
+        return STACK_ERROR_INVALID_INDEX;
+    }
+
+    Bounds* bounds = &stacks->bounds[index];
+    if (index == stacks->down_index) {
+        if (bounds->top == bounds[-1].top) {
+            return STACK_ERROR_OVERFLOW;
+        }
+        bounds->base = --bounds->top;
+        stacks->data[bounds->top] = value;
+        return STACK_SUCCESS;
+    }
+
+    if (bounds->top == bounds[1].base &&
+        (stacks->stack_count <= 2 || !reallocate(stacks, index))) {
+        return STACK_ERROR_OVERFLOW;
+    }
+    stacks->data[bounds->top++] = value;
+    return STACK_SUCCESS;
+}
+
+StackResult multi_stack_pop(MultiStack* stacks, size_t index, int* value) {
+    /* Validate input parameters */
+    if (!stacks || !value) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+    if (index >= stacks->stack_count) {
+        return STACK_ERROR_INVALID_INDEX;
+    }
+
+    Bounds* bounds = &stacks->bounds[index];
+    size_t slot;
+    if (index == stacks->down_index) {
+        if (bounds->top == stacks->capacity) {
+            return STACK_ERROR_UNDERFLOW;
+        }
+        slot = bounds->top++;
+        bounds->base = bounds->top;
+    } else {
+        if (bounds->top == bounds->base) {
+            return STACK_ERROR_UNDERFLOW;
+        }
+        slot = --bounds->top;
+    }
+
+    *value = stacks->data[slot];
+    stacks->data[slot] = 0;
+    return STACK_SUCCESS;
+}
+
+StackResult multi_stack_peek(const MultiStack* stacks, size_t index, int* value) {
+    /* Validate input parameters */
+    if (!stacks || !value) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+    if (index >= stacks->stack_count) {
+        return STACK_ERROR_INVALID_INDEX;
+    }
+    if (size_of(stacks, index) == 0) {
+        return STACK_ERROR_UNDERFLOW;
+    }
+
+    const Bounds* bounds = &stacks->bounds[index];
+    *value = stacks->data[index == stacks->down_index ? bounds->top : bounds->top - 1];
+    return STACK_SUCCESS;
+}
+
+StackResult multi_stack_clear(MultiStack* stacks, size_t index) {
+    /* Validate input parameters */
+    if (!stacks) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+    if (index >= stacks->stack_count) {
+        return STACK_ERROR_INVALID_INDEX;
+    }
+
+    Bounds* bounds = &stacks->bounds[index];
+    if (index == stacks->down_index) {
+        memset(stacks->data + bounds->top, 0, size_of(stacks, index) * sizeof(int));
+        bounds->base = stacks->capacity;
+        bounds->top = stacks->capacity;
+    } else {
+        memset(stacks->data + bounds->base, 0, size_of(stacks, index) * sizeof(int));
+        bounds->top = bounds->base;
+    }
+    return STACK_SUCCESS;
+}
+
+size_t multi_stack_size(const MultiStack* stacks, size_t index) {
+    if (!stacks || index >= stacks->stack_count) {
+        return 0;
+    }
+    return size_of(stacks, index);
+}
+
+bool multi_stack_is_empty(const MultiStack* stacks, size_t index) {
+    return multi_stack_size(stacks, index) == 0;
+}
+
+size_t multi_stack_count(const MultiStack* stacks) {
+    return stacks ? stacks->stack_count : 0;
+}
+
+size_t multi_stack_capacity(const MultiStack* stacks) {
+    return stacks ? stacks->capacity : 0;
+}
@@ -0,0 +1,222 @@
+/**
+ * @file palindrome.c
+ * @brief Palindrome and Mirror-Equality Detection Implementation
+ * @author Jaden Mardini
+ *
+ * A front cursor and a back cursor walk towards each other. While at least
+ * 16 bytes remain between them, the 16 bytes at the front are compared in
+ * one SSE2 compare with the 16 bytes before the back cursor, byte-reversed
+ * in registers, so no reversed copy is ever written. When the remaining
+ * span is shorter than two blocks the final compare overlaps the previous
+ * one, which still checks every mirrored pair. Case folding is applied to
+ * both blocks before the compare. With skipping enabled, a block pair that
+ * contains a skipped byte is resolved with scalar steps, since skipped
+ * bytes shift the pairing.
+ */
+
+#include "palindrome.h"
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* Bytes compared per SIMD step */
+#define BLOCK_SIZE 16
+
+/* Strings ahead of the current one to prefetch in batch checks */
+#define BATCH_PREFETCH_DISTANCE 4
+
+/* Static function prototypes */
+static bool is_skipped(unsigned char c, unsigned flags);
+static unsigned char fold_byte(unsigned char c, unsigned flags);
+static bool scalar_steps(const unsigned char* data, size_t* front, size_t* back,
+                         unsigned flags, size_t steps);
+
+/**
+ * @brief Tests whether a byte is ignored under the flags
+ */
+static inline bool is_skipped(unsigned char c, unsigned flags) {
+    bool space = c == ' ' || (c >= '\t' && c <= '\r');
+    bool punctuation = (c >= '!' && c <= '/') || (c >= ':' && c <= '@') ||
+                       (c >= '[' && c <= '`') || (c >= '{' && c <= '~');
+    return ((flags & PALINDROME_SKIP_WHITESPACE) && space) ||
+           ((flags & PALINDROME_SKIP_PUNCTUATION) && punctuation);
+}
+
+/**
+ * @brief Lower-cases ASCII letters when folding is enabled
+ */
+static inline unsigned char fold_byte(unsigned char c, unsigned flags) {
+    if ((flags & PALINDROME_FOLD_CASE) && c >= 'A' && c <= 'Z') {
+        return (unsigned char)(c | 0x20);
+    }
+    return c;
+}
+
+/**
+ * @brief Advances both cursors by up to steps matched pairs
+ * @return false on the first mismatch, true otherwise
+ *
+ * When the cursors meet, front is set equal to back.
+ */
+static bool scalar_steps(const unsigned char* data, size_t* front, size_t* back,
+                         unsigned flags, size_t steps) {
+    size_t f = *front;
+    size_t b = *back;
+    bool skipping = (flags & (PALINDROME_SKIP_PUNCTUATION | PALINDROME_SKIP_WHITESPACE)) != 0;
+
+    for (; steps > 0; steps--) {
+        if (skipping) {
+            while (f < b && is_skipped(data[f], flags)) {
+                f++;
+            }
+            while (b > f && is_skipped(data[b - 1], flags)) {
+                b--;
+            }
+        }
+        if (b - f < 2) {
+            f = b;
+            break;
+        }
+        if (fold_byte(data[f], flags) != fold_byte(data[b - 1], flags)) {
+            return false;
+        }
+        f++;
+        b--;
+    }
+
+    *front = f;
+    *back = b;
+    return true;
+}
+
+#if defined(__SSE2__)
+/**
+ * @brief Reverses the 16 bytes of a vector using SSE2 shuffles
+ */
+static inline __m128i reverse_bytes(__m128i v) {
+    v = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+/**
+ * @brief Marks bytes within [low, high]; bytes of 0x80 and above never match
+ */
+static inline __m128i in_range(__m128i v, char low, char high) {
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8((char)(low - 1))),
+                         _mm_cmplt_epi8(v, _mm_set1_epi8((char)(high + 1))));
+}
+
+/**
+ * @brief Lower-cases the ASCII letters in a vector
+ */
+static inline __m128i fold_block(__m128i v) {
+    return _mm_or_si128(v, _mm_and_si128(in_range(v, 'A', 'Z'), _mm_set1_epi8(0x20)));
+}
+
+/**
+ * @brief Marks the bytes of a vector that the flags skip
+ */
+static inline __m128i skip_block(__m128i v, unsigned flags) {
+    __m128i skipped = _mm_setzero_si128();
+    if (flags & PALINDROME_SKIP_WHITESPACE) {
+        skipped = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), in_range(v, '\t', '\r'));
+    }
+    if (flags & PALINDROME_SKIP_PUNCTUATION) {
+        skipped = _mm_or_si128(skipped, _mm_or_si128(
+            _mm_or_si128(in_range(v, '!', '/'), in_range(v, ':', '@')),
+            _mm_or_si128(in_range(v, '[', '`'), in_range(v, '{', '~'))));
+    }
+    return skipped;
+}
+#endif
+
+bool palindrome_check(const char* data, size_t length, unsigned flags) {
+    if (!data) {
+        return false;
+    }
+
+    const unsigned char* bytes = (const unsigned char*)data;
+    size_t front = 0;
+    size_t back = length;
+
+#if defined(__SSE2__)
+    bool fold = (flags & PALINDROME_FOLD_CASE) != 0;
+    bool skipping = (flags & (PALINDROME_SKIP_PUNCTUATION | PALINDROME_SKIP_WHITESPACE)) != 0;
+
+    while (back - front >= BLOCK_SIZE) {
+        __m128i head = _mm_loadu_si128((const __m128i*)(const void*)(bytes + front));
+        __m128i tail = _mm_loadu_si128((const __m128i*)(const void*)(bytes + back - BLOCK_SIZE));
+
+        /* Skipped bytes shift the pairing, so resolve this stretch pair by pair */
+        if (skipping && _mm_movemask_epi8(_mm_or_si128(skip_block(head, flags),
+                                                       skip_block(tail, flags))) != 0) {
+            if (!scalar_steps(bytes, &front, &back, flags, BLOCK_SIZE)) {
+                return false;
+            }
+            continue;
+        }
+
+        if (fold) {
+            head = fold_block(head);
+            tail = fold_block(tail);
+        }
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(head, reverse_bytes(tail))) != 0xFFFF) {
+            return false;
+        }
+
+        /* Fewer than two blocks apart: the overlapping compare covered every pair */
+        if (back - front < 2 * BLOCK_SIZE) {
+            return true;
+        }
+        front += BLOCK_SIZE;
+        back -= BLOCK_SIZE;
+    }
+#endif
+
+    return scalar_steps(bytes, &front, &back, flags, (size_t)-1);
+}
+
+PalindromeResult palindrome_check_batch(const char* const* strings, const size_t* lengths,
+                                        size_t count, unsigned flags, uint64_t* bitmap) {
+    /* Validate input parameters */
+    if (count > 0 && (!strings || !bitmap)) {
+        return PALINDROME_ERROR_NULL_POINTER;
+    }
+
+    uint64_t word = 0;
+    for (size_t i = 0; i < count; i++) {
+#if defined(__GNUC__)
+        if (i + BATCH_PREFETCH_DISTANCE < count && strings[i + BATCH_PREFETCH_DISTANCE]) {
+            __builtin_prefetch(strings[i + BATCH_PREFETCH_DISTANCE]);
+        }
+#endif
+        const char* string = strings[i];
+        if (string) {
+            size_t length = lengths ? lengths[i] : strlen(string);
+            word |= (uint64_t)palindrome_check(string, length, flags) << (i % PALINDROME_BITMAP_WORD_BITS);
+        }
+
+        /* Store each bitmap word once it is complete */
+        if (i % PALINDROME_BITMAP_WORD_BITS == PALINDROME_BITMAP_WORD_BITS - 1 || i + 1 == count) {
+            bitmap[i / PALINDROME_BITMAP_WORD_BITS] = word;
+            word = 0;
+        }
+    }
+
+    return PALINDROME_SUCCESS;
+}
+
+const char* palindrome_error_string(PalindromeResult result) {
+    switch (result) {
+        case PALINDROME_SUCCESS:
+            return "Success";
+        case PALINDROME_ERROR_NULL_POINTER:
+            return "Null pointer provided";
+        default:
+            return "Unknown error";
+    }
+}
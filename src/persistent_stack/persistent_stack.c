@@ -0,0 +1,250 @@
+/**
+ * @file persistent_stack.c
+ * @brief Persistent Stack Implementation
+ * @author Jaden Mardini
+ *
+ * Versions are singly linked lists of reference-counted nodes. A push
+ * allocates one node whose tail is the previous top, so all versions
+ * share structure and cloning only bumps a reference count. Nodes come
+ * from a chunked pool with an intrusive free list to keep allocation off
+ * the general-purpose heap.
+ */
+
+#include "persistent_stack.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Node structure definition (opaque to users) */
+struct PersistentStackNode {
+    PersistentStackNode* next;  /* Tail version; also free-list link */
+    size_t ref_count;           /* Versions and nodes referencing this node */
+    int value;                  /* Stored element */
+};
+
+/* Chunk of nodes carved up by the pool */
+typedef struct PoolChunk {
+    struct PoolChunk* next;
+    PersistentStackNode nodes[PERSISTENT_STACK_POOL_CHUNK_NODES];
+} PoolChunk;
+
+/* Pool structure definition (opaque to users) */
+struct PersistentStackPool {
+    PoolChunk* chunks;              /* All chunks owned by the pool */
+    PersistentStackNode* free_list; /* Recycled nodes */
+    size_t live_nodes;              /* Nodes currently referenced */
+};
+
+/* Static function prototypes */
+static PersistentStackNode* pool_allocate_node(PersistentStackPool* pool);
+static void pool_free_node(PersistentStackPool* pool, PersistentStackNode* node);
+static bool pool_add_chunk(PersistentStackPool* pool);
+static void release_chain(PersistentStackPool* pool, PersistentStackNode* node);
+
+/**
+ * @brief Adds a chunk of nodes to the pool's free list
+ */
+static bool pool_add_chunk(PersistentStackPool* pool) {
+    PoolChunk* chunk = malloc(sizeof(PoolChunk));
+    if (!chunk) {
+        return false;
+    }
+
+    chunk->next = pool->chunks;
+    pool->chunks = chunk;
+
+    /* Thread the new nodes onto the free list in address order */
+    for (size_t i = PERSISTENT_STACK_POOL_CHUNK_NODES; i > 0; i--) {
+        PersistentStackNode* node = &chunk->nodes[i - 1];
+        node->next = pool->free_list;
+        pool->free_list = node;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Takes a node from the pool, growing it if necessary
+ */
+static PersistentStackNode* pool_allocate_node(PersistentStackPool* pool) {
+    if (!pool->free_list && !pool_add_chunk(pool)) {
+        return NULL;
+    }
+
+    PersistentStackNode* node = pool->free_list;
+    pool->free_list = node->next;
+    pool->live_nodes++;
+    return node;
+}
+
+/**
+ * @brief Returns a node to the pool, clearing its value for security
+ */
+static void pool_free_node(PersistentStackPool* pool, PersistentStackNode* node) {
+    node->value = 0;
+    node->ref_count = 0;
+    node->next = pool->free_list;
+    pool->free_list = node;
+    pool->live_nodes--;
+}
+
+/**
+ * @brief Drops one reference to a node and reclaims the unshared prefix
+ *
+ * Iterative so that releasing a long unshared chain cannot overflow the
+ * call stack.
+ */
+static void release_chain(PersistentStackPool* pool, PersistentStackNode* node) {
+    while (node && --node->ref_count == 0) {
+        PersistentStackNode* next = node->next;
+        pool_free_node(pool, node);
+        node = next;
+    }
+}
+
+PersistentStackPool* persistent_stack_pool_create(void) {
+    PersistentStackPool* pool = malloc(sizeof(PersistentStackPool));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->chunks = NULL;
+    pool->free_list = NULL;
+    pool->live_nodes = 0;
+
+    return pool;
+}
+
+void persistent_stack_pool_destroy(PersistentStackPool* pool) {
+    if (pool) {
+        PoolChunk* chunk = pool->chunks;
+        while (chunk) {
+            PoolChunk* next = chunk->next;
+            /* Clear sensitive data before freeing */
+            memset(chunk, 0, sizeof(PoolChunk));
+            free(chunk);
+            chunk = next;
+        }
+
+        memset(pool, 0, sizeof(PersistentStackPool));
+        free(pool);
+    }
+}
+
+size_t persistent_stack_pool_live_nodes(const PersistentStackPool* pool) {
+    return pool ? pool->live_nodes : 0;
+}
+
+StackResult persistent_stack_init(PersistentStack* stack, PersistentStackPool* pool) {
+    if (!stack || !pool) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    stack->pool = pool;
+    stack->top = NULL;
+    stack->size = 0;
+
+    return STACK_SUCCESS;
+}
+
+StackResult persistent_stack_push(PersistentStack* stack, int value) {
+    /* Validate input parameters */
+    if (!stack || !stack->pool) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    PersistentStackNode* node = pool_allocate_node(stack->pool);
+    if (!node) {
+        return STACK_ERROR_MEMORY_ALLOCATION;
+    }
+
+    /* The handle's reference to the old top moves into the new node */
+    node->value = value;
+    node->next = stack->top;
+    node->ref_count = 1;
+
+    stack->top = node;
+    stack->size++;
+
+    return STACK_SUCCESS;
+}
+
+StackResult persistent_stack_pop(PersistentStack* stack, int* value) {
+    /* Validate input parameters */
+    if (!stack || !value || !stack->pool) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (!stack->top) {
+        return STACK_ERROR_UNDERFLOW;
+    }
+
+    PersistentStackNode* old_top = stack->top;
+    PersistentStackNode* next = old_top->next;
+    *value = old_top->value;
+
+    if (old_top->ref_count == 1) {
+        /* Sole owner: the node's reference to its tail passes to the handle */
+        pool_free_node(stack->pool, old_top);
+    } else {
+        /* Shared: leave the node to its other owners and take a tail reference */
+        old_top->ref_count--;
+        if (next) {
+            next->ref_count++;
+        }
+    }
+
+    stack->top = next;
+    stack->size--;
+
+    return STACK_SUCCESS;
+}
+
+StackResult persistent_stack_peek(const PersistentStack* stack, int* value) {
+    /* Validate input parameters */
+    if (!stack || !value) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (!stack->top) {
+        return STACK_ERROR_UNDERFLOW;
+    }
+
+    *value = stack->top->value;
+
+    return STACK_SUCCESS;
+}
+
+StackResult persistent_stack_clone(const PersistentStack* source, PersistentStack* clone) {
+    /* Validate input parameters */
+    if (!source || !clone || !source->pool) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (source->top) {
+        source->top->ref_count++;
+    }
+
+    *clone = *source;
+
+    return STACK_SUCCESS;
+}
+
+StackResult persistent_stack_snapshot(const PersistentStack* stack, PersistentStack* snapshot) {
+    return persistent_stack_clone(stack, snapshot);
+}
+
+void persistent_stack_release(PersistentStack* stack) {
+    if (stack && stack->pool) {
+        release_chain(stack->pool, stack->top);
+        stack->top = NULL;
+        stack->size = 0;
+    }
+}
+
+bool persistent_stack_is_empty(const PersistentStack* stack) {
+    return !stack || stack->size == 0;
+}
+
+size_t persistent_stack_size(const PersistentStack* stack) {
+    return stack ? stack->size : 0;
+}
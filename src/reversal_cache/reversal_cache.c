@@ -0,0 +1,391 @@
+/**
+ * @file reversal_cache.c
+ * @brief Memoizing Reversal Cache Implementation
+ * @author Jaden Mardini
+ *
+ * Each entry is one allocation holding the key followed by its reversal,
+ * so a hit is a hash probe, one memcmp() and one memcpy(). Inputs are
+ * hashed eight bytes at a time with a multiply-xorshift mix; the high
+ * bits pick the shard and the low bits the bucket, so the two choices
+ * are independent. Shards sit on their own cache lines and each has its
+ * own mutex, chained hash table and CLOCK ring: a hit sets the entry's
+ * reference bit, and eviction advances the hand around the ring, giving
+ * referenced entries a second chance and removing the first unreferenced
+ * one. A miss reverses outside the lock and only locks again to insert,
+ * so a slow miss never delays hits on the same shard.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "reversal_cache.h"
+#include "reversed_view.h"
+#include <pthread.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Keeps shards on separate cache lines */
+#define SHARD_CACHE_LINE_SIZE 64
+
+/* Buckets in a new shard table; the table doubles when entries outnumber buckets */
+#define INITIAL_BUCKETS 64
+
+/* Multiplier of the input hash */
+#define HASH_MULTIPLIER 0x9E3779B97F4A7C15ull
+
+/* One cached reversal */
+typedef struct Entry {
+    struct Entry* chain;        /* Next entry in the same bucket */
+    struct Entry* ring_next;    /* CLOCK ring neighbours */
+    struct Entry* ring_prev;
+    uint64_t hash;
+    size_t length;
+    bool referenced;            /* CLOCK reference bit, set on each hit */
+    char data[];                /* Key, then its reversal and a NUL */
+} Entry;
+
+/* One independently locked shard */
+typedef struct {
+    alignas(SHARD_CACHE_LINE_SIZE) pthread_mutex_t lock;
+    Entry** buckets;
+    size_t bucket_count;        /* Power of two */
+    size_t entries;
+    size_t bytes;
+    size_t budget;
+    Entry* hand;                /* CLOCK hand; NULL when the shard is empty */
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+} Shard;
+
+/* Cache structure definition (opaque to users) */
+struct ReversalCache {
+    Shard* shards;
+    size_t shard_count;
+};
+
+/* Static function prototypes */
+static uint64_t hash_input(const char* input, size_t length);
+static size_t entry_cost(size_t length);
+static Entry* shard_find(const Shard* shard, uint64_t hash, const char* input, size_t length);
+static void shard_unlink(Shard* shard, Entry* entry);
+static void shard_evict_one(Shard* shard);
+static void shard_grow(Shard* shard);
+static void shard_insert(Shard* shard, Entry* entry);
+static void shard_release(Shard* shard);
+
+/**
+ * @brief Hashes an input eight bytes at a time
+ */
+static uint64_t hash_input(const char* input, size_t length) {
+    uint64_t hash = length * HASH_MULTIPLIER;
+    size_t i = 0;
+
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        memcpy(&word, input + i, sizeof(word));
+        hash = (hash ^ word) * HASH_MULTIPLIER;
+        hash ^= hash >> 29;
+    }
+    if (i < length) {
+        uint64_t word = 0;
+        memcpy(&word, input + i, length - i);
+        hash = (hash ^ word) * HASH_MULTIPLIER;
+        hash ^= hash >> 29;
+    }
+
+    hash *= HASH_MULTIPLIER;
+    return hash ^ (hash >> 32);
+}
+
+/**
+ * @brief Returns the bytes an entry of the given length is charged
+ */
+static size_t entry_cost(size_t length) {
+    return sizeof(Entry) + 2 * length + 1;
+}
+
+/**
+ * @brief Looks up an input in a locked shard
+ */
+static Entry* shard_find(const Shard* shard, uint64_t hash, const char* input, size_t length) {
+    Entry* entry = shard->buckets[hash & (shard->bucket_count - 1)];
+    while (entry) {
+        if (entry->hash == hash && entry->length == length && memcmp(entry->data, input, length) == 0) {
+            return entry;
+        }
+        entry = entry->chain;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Removes an entry from its bucket and the CLOCK ring without freeing it
+ */
+static void shard_unlink(Shard* shard, Entry* entry) {
+    Entry** link = &shard->buckets[entry->hash & (shard->bucket_count - 1)];
+    while (*link != entry) {
+        link = &(*link)->chain;
+    }
+    *link = entry->chain;
+
+    if (entry->ring_next == entry) {
+        shard->hand = NULL;
+    } else {
+        entry->ring_prev->ring_next = entry->ring_next;
+        entry->ring_next->ring_prev = entry->ring_prev;
+        if (shard->hand == entry) {
+            shard->hand = entry->ring_next;
+        }
+    }
+
+    shard->entries--;
+    shard->bytes -= entry_cost(entry->length);
+}
+
+/**
+ * @brief Evicts the first unreferenced entry at or after the hand
+ */
+static void shard_evict_one(Shard* shard) {
+    while (shard->hand->referenced) {
+        shard->hand->referenced = false;
+        shard->hand = shard->hand->ring_next;
+    }
+
+    Entry* victim = shard->hand;
+    shard_unlink(shard, victim);
+    free(victim);
+    shard->evictions++;
+}
+
+/**
+ * @brief Doubles the bucket table; keeps the old table if allocation fails
+ */
+static void shard_grow(Shard* shard) {
+    size_t bucket_count = shard->bucket_count * 2;
+    Entry** buckets = calloc(bucket_count, sizeof(Entry*));
+    if (!buckets) {
+        return;
+    }
+
+    for (size_t b = 0; b < shard->bucket_count; b++) {
+        Entry* entry = shard->buckets[b];
+        while (entry) {
+            Entry* next = entry->chain;
+            Entry** head = &buckets[entry->hash & (bucket_count - 1)];
+            entry->chain = *head;
+            *head = entry;
+            entry = next;
+        }
+    }
+
+    free(shard->buckets);
+    shard->buckets = buckets;
+    shard->bucket_count = bucket_count;
+}
+
+/**
+ * @brief Adds an entry to a locked shard just behind the hand, evicting to fit the budget
+ */
+static void shard_insert(Shard* shard, Entry* entry) {
+    size_t cost = entry_cost(entry->length);
+    while (shard->hand && shard->bytes + cost > shard->budget) {
+        shard_evict_one(shard);
+    }
+
+    if (shard->entries >= shard->bucket_count) {
+        shard_grow(shard);
+    }
+    Entry** head = &shard->buckets[entry->hash & (shard->bucket_count - 1)];
+    entry->chain = *head;
+    *head = entry;
+
+    /* Behind the hand is the last position the hand will reach */
+    if (shard->hand) {
+        entry->ring_next = shard->hand;
+        entry->ring_prev = shard->hand->ring_prev;
+        shard->hand->ring_prev->ring_next = entry;
+        shard->hand->ring_prev = entry;
+    } else {
+        entry->ring_next = entry;
+        entry->ring_prev = entry;
+        shard->hand = entry;
+    }
+
+    shard->entries++;
+    shard->bytes += cost;
+}
+
+/**
+ * @brief Frees every entry of a shard
+ */
+static void shard_release(Shard* shard) {
+    for (size_t b = 0; b < shard->bucket_count; b++) {
+        Entry* entry = shard->buckets[b];
+        while (entry) {
+            Entry* next = entry->chain;
+            free(entry);
+            entry = next;
+        }
+        shard->buckets[b] = NULL;
+    }
+    shard->entries = 0;
+    shard->bytes = 0;
+    shard->hand = NULL;
+}
+
+ReversalCache* reversal_cache_create(size_t byte_budget, size_t shard_count) {
+    if (shard_count == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        shard_count = online > 0 ? (size_t)online : 1;
+    }
+
+    ReversalCache* cache = malloc(sizeof(ReversalCache));
+    if (!cache) {
+        return NULL;
+    }
+
+    cache->shards = aligned_alloc(SHARD_CACHE_LINE_SIZE, shard_count * sizeof(Shard));
+    if (!cache->shards) {
+        free(cache);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < shard_count; i++) {
+        Shard* shard = &cache->shards[i];
+        shard->buckets = calloc(INITIAL_BUCKETS, sizeof(Entry*));
+        if (!shard->buckets || pthread_mutex_init(&shard->lock, NULL) != 0) {
+            free(shard->buckets);
+            cache->shard_count = i;
+            reversal_cache_destroy(cache);
+            return NULL;
+        }
+        shard->bucket_count = INITIAL_BUCKETS;
+        shard->entries = 0;
+        shard->bytes = 0;
+        shard->budget = byte_budget / shard_count;
+        shard->hand = NULL;
+        shard->hits = 0;
+        shard->misses = 0;
+        shard->evictions = 0;
+    }
+
+    cache->shard_count = shard_count;
+    return cache;
+}
+
+void reversal_cache_destroy(ReversalCache* cache) {
+    if (cache) {
+        for (size_t i = 0; i < cache->shard_count; i++) {
+            shard_release(&cache->shards[i]);
+            free(cache->shards[i].buckets);
+            pthread_mutex_destroy(&cache->shards[i].lock);
+        }
+        free(cache->shards);
+        free(cache);
+    }
+}
+
+ReversalCacheResult reversal_cache_reverse(ReversalCache* cache, const char* input, size_t length,
+                                           char* output, size_t output_size) {
+    /* Validate input parameters */
+    if (!cache || !input || !output) {
+        return REVERSAL_CACHE_ERROR_NULL_POINTER;
+    }
+
+    if (output_size <= length) {
+        return REVERSAL_CACHE_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    uint64_t hash = hash_input(input, length);
+    Shard* shard = &cache->shards[(hash >> 48) % cache->shard_count];
+
+    pthread_mutex_lock(&shard->lock);
+    Entry* entry = shard_find(shard, hash, input, length);
+    if (entry) {
+        entry->referenced = true;
+        shard->hits++;
+        memcpy(output, entry->data + length, length + 1);
+        pthread_mutex_unlock(&shard->lock);
+        return REVERSAL_CACHE_SUCCESS;
+    }
+    shard->misses++;
+    pthread_mutex_unlock(&shard->lock);
+
+    reversed_view_copy(reversed_view_make(input, length), output, output_size);
+
+    if (entry_cost(length) > shard->budget) {
+        return REVERSAL_CACHE_SUCCESS;
+    }
+    entry = malloc(entry_cost(length));
+    if (!entry) {
+        return REVERSAL_CACHE_SUCCESS;
+    }
+    entry->hash = hash;
+    entry->length = length;
+    entry->referenced = false;
+    memcpy(entry->data, input, length);
+    memcpy(entry->data + length, output, length + 1);
+
+    /* Another thread may have cached the same input meanwhile */
+    pthread_mutex_lock(&shard->lock);
+    if (shard_find(shard, hash, input, length)) {
+        pthread_mutex_unlock(&shard->lock);
+        free(entry);
+        return REVERSAL_CACHE_SUCCESS;
+    }
+    shard_insert(shard, entry);
+    pthread_mutex_unlock(&shard->lock);
+    return REVERSAL_CACHE_SUCCESS;
+}
+
+void reversal_cache_stats(ReversalCache* cache, ReversalCacheStats* stats) {
+    if (!stats) {
+        return;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    if (!cache) {
+        return;
+    }
+
+    for (size_t i = 0; i < cache->shard_count; i++) {
+        Shard* shard = &cache->shards[i];
+        pthread_mutex_lock(&shard->lock);
+        stats->hits += shard->hits;
+        stats->misses += shard->misses;
+        stats->evictions += shard->evictions;
+        stats->entries += shard->entries;
+        stats->bytes += shard->bytes;
+        pthread_mutex_unlock(&shard->lock);
+    }
+}
+
+void reversal_cache_clear(ReversalCache* cache) {
+    if (cache) {
+        for (size_t i = 0; i < cache->shard_count; i++) {
+            Shard* shard = &cache->shards[i];
+            pthread_mutex_lock(&shard->lock);
+            shard_release(shard);
+            shard->hits = 0;
+            shard->misses = 0;
+            shard->evictions = 0;
+            pthread_mutex_unlock(&shard->lock);
+        }
+    }
+}
+
+const char* reversal_cache_error_string(ReversalCacheResult result) {
+    switch (result) {
+        case REVERSAL_CACHE_SUCCESS:
+            return "Success";
+        case REVERSAL_CACHE_ERROR_NULL_POINTER:
+            return "Null pointer provided";
+        case REVERSAL_CACHE_ERROR_BUFFER_TOO_SMALL:
+            return "Output buffer too small";
+        default:
+            return "Unknown error";
+    }
+}
@@ -0,0 +1,630 @@
+/**
+ * @file reversal_server.c
+ * @brief Local Reversal Service Implementation
+ * @author Jaden Mardini
+ *
+ * Every worker owns an epoll instance holding the shared listening socket,
+ * a shared stop eventfd and the connections it accepted. The listening
+ * socket is registered with EPOLLEXCLUSIVE, so a new connection wakes one
+ * worker rather than all of them, and whichever worker accepts it serves
+ * it for its whole life without locks. Unix domain sockets have no
+ * SO_REUSEPORT load balancing, and this gives the same effect: one queue
+ * of incoming connections spread over per-core event loops.
+ *
+ * A connection has a single buffer. Received bytes are appended, every
+ * complete frame is reversed in place, and because a response has the
+ * same length prefix as its request the reversed frames already form the
+ * response stream and are written straight from the buffer: a whole
+ * pipeline of requests goes out in one send() without copying. If the
+ * socket cannot take it all, the connection stops reading and waits for
+ * EPOLLOUT, so a client that does not read its responses cannot make the
+ * server buffer without bound.
+ */
+
+#define _GNU_SOURCE
+
+#include "reversal_server.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__linux__)
+
+/* Older headers lack the flag; without it every worker wakes per connection */
+#ifndef EPOLLEXCLUSIVE
+#define EPOLLEXCLUSIVE 0
+#endif
+
+/* Initial receive buffer per connection; grows to fit the largest frame */
+#define INITIAL_BUFFER_SIZE 16384
+
+/* Events taken from epoll per wakeup */
+#define MAX_EVENTS 64
+
+/* Reads per readiness event before other connections get a turn */
+#define READS_PER_EVENT 16
+
+/* One client connection, owned by a single worker */
+typedef struct Connection {
+    int fd;
+    unsigned char* buffer;
+    size_t capacity;
+    size_t length;              /* Bytes received */
+    size_t processed;           /* Bytes of complete frames, reversed in place */
+    size_t sent;                /* Bytes of processed frames written back */
+    bool writing;               /* Waiting for EPOLLOUT instead of EPOLLIN */
+    struct Connection* prev;
+    struct Connection* next;
+} Connection;
+
+/* One event loop thread */
+typedef struct {
+    ReversalServer* server;
+    pthread_t thread;
+    int epoll_fd;
+    Connection* connections;    /* Open connections, for shutdown */
+} Worker;
+
+/* Server structure definition (opaque to users) */
+struct ReversalServer {
+    int listen_fd;
+    int stop_fd;
+    size_t max_request;
+    Worker* workers;
+    size_t worker_count;
+    size_t started;             /* Workers whose thread is running */
+    atomic_uint_fast64_t requests;
+    char socket_path[sizeof(((struct sockaddr_un*)0)->sun_path)];
+};
+
+/* Static function prototypes */
+static void reverse_in_place(unsigned char* data, size_t length);
+static size_t frame_length(const unsigned char* header);
+static void connection_open(Worker* worker, int fd);
+static void connection_close(Worker* worker, Connection* connection);
+static bool connection_reserve(Connection* connection);
+static bool process_frames(ReversalServer* server, Connection* connection);
+static int flush(Worker* worker, Connection* connection);
+static void handle_readable(Worker* worker, Connection* connection);
+static void accept_connections(Worker* worker);
+static void* worker_main(void* argument);
+static bool remove_stale_socket(const struct sockaddr_un* address);
+static void server_destroy(ReversalServer* server);
+
+#if defined(__SSE2__)
+/**
+ * @brief Reverses the 16 bytes of a vector using SSE2 shuffles
+ */
+static inline __m128i reverse_bytes(__m128i v) {
+    v = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+#endif
+
+/**
+ * @brief Reverses a buffer in place, swapping 16-byte blocks from both ends
+ */
+static void reverse_in_place(unsigned char* data, size_t length) {
+    size_t low = 0;
+    size_t high = length;
+
+#if defined(__SSE2__)
+    while (high - low >= 32) {
+        __m128i front = _mm_loadu_si128((const __m128i*)(const void*)(data + low));
+        __m128i back = _mm_loadu_si128((const __m128i*)(const void*)(data + high - 16));
+        _mm_storeu_si128((__m128i*)(void*)(data + low), reverse_bytes(back));
+        _mm_storeu_si128((__m128i*)(void*)(data + high - 16), reverse_bytes(front));
+        low += 16;
+        high -= 16;
+    }
+#endif
+
+    while (high - low >= 2) {
+        unsigned char c = data[low];
+        data[low++] = data[--high];
+        data[high] = c;
+    }
+}
+
+/**
+ * @brief Decodes a big-endian length prefix
+ */
+static size_t frame_length(const unsigned char* header) {
+    return ((size_t)header[0] << 24) | ((size_t)header[1] << 16) | ((size_t)header[2] << 8) | header[3];
+}
+
+/**
+ * @brief Registers an accepted socket with a worker; closes it on failure
+ */
+static void connection_open(Worker* worker, int fd) {
+    Connection* connection = calloc(1, sizeof(Connection));
+    unsigned char* buffer = malloc(INITIAL_BUFFER_SIZE);
+    if (!connection || !buffer) {
+        free(connection);
+        free(buffer);
+        close(fd);
+        return;
+    }
+
+    connection->fd = fd;
+    connection->buffer = buffer;
+    connection->capacity = INITIAL_BUFFER_SIZE;
+
+    struct epoll_event event = { .events = EPOLLIN, .data.ptr = connection };
+    if (epoll_ctl(worker->epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+        free(buffer);
+        free(connection);
+        close(fd);
+        return;
+    }
+
+    connection->next = worker->connections;
+    if (worker->connections) {
+        worker->connections->prev = connection;
+    }
+    worker->connections = connection;
+}
+
+/**
+ * @brief Closes a connection and frees its state
+ *
+ * Only called while handling the connection's own event, so no other
+ * event in the current batch can refer to it.
+ */
+static void connection_close(Worker* worker, Connection* connection) {
+    if (connection->prev) {
+        connection->prev->next = connection->next;
+    } else {
+        worker->connections = connection->next;
+    }
+    if (connection->next) {
+        connection->next->prev = connection->prev;
+    }
+
+    close(connection->fd);      /* Also removes it from the epoll set */
+    free(connection->buffer);
+    free(connection);
+}
+
+/**
+ * @brief Makes room to receive more bytes of the partial frame at the buffer start
+ *
+ * Called only after every complete frame was sent and the buffer was
+ * compacted, so a full buffer always means the frame is larger than it.
+ */
+static bool connection_reserve(Connection* connection) {
+    if (connection->length < connection->capacity) {
+        return true;
+    }
+
+    size_t needed = REVERSAL_SERVER_HEADER_SIZE + frame_length(connection->buffer);
+    size_t capacity = connection->capacity * 2;
+    if (capacity < needed) {
+        capacity = needed;
+    }
+
+    unsigned char* buffer = realloc(connection->buffer, capacity);
+    if (!buffer) {
+        return false;
+    }
+    connection->buffer = buffer;
+    connection->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Reverses every complete frame received so far
+ * @return false if a frame exceeds the request limit
+ */
+static bool process_frames(ReversalServer* server, Connection* connection) {
+    uint_fast64_t answered = 0;
+
+    while (connection->length - connection->processed >= REVERSAL_SERVER_HEADER_SIZE) {
+        unsigned char* frame = connection->buffer + connection->processed;
+        size_t body = frame_length(frame);
+        if (body > server->max_request) {
+            return false;
+        }
+        if (connection->length - connection->processed - REVERSAL_SERVER_HEADER_SIZE < body) {
+            break;
+        }
+
+        reverse_in_place(frame + REVERSAL_SERVER_HEADER_SIZE, body);
+        connection->processed += REVERSAL_SERVER_HEADER_SIZE + body;
+        answered++;
+    }
+
+    if (answered > 0) {
+        atomic_fetch_add_explicit(&server->requests, answered, memory_order_relaxed);
+    }
+    return true;
+}
+
+/**
+ * @brief Sends processed frames, switching between read and write interest as needed
+ * @return 1 when everything was sent, 0 if the socket is full, -1 on error
+ */
+static int flush(Worker* worker, Connection* connection) {
+    while (connection->sent < connection->processed) {
+        ssize_t written = send(connection->fd, connection->buffer + connection->sent,
+                               connection->processed - connection->sent, MSG_NOSIGNAL);
+        if (written > 0) {
+            connection->sent += (size_t)written;
+        } else if (written < 0 && errno == EINTR) {
+            continue;
+        } else if (written < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            if (!connection->writing) {
+                struct epoll_event event = { .events = EPOLLOUT, .data.ptr = connection };
+                epoll_ctl(worker->epoll_fd, EPOLL_CTL_MOD, connection->fd, &event);
+                connection->writing = true;
+            }
+            return 0;
+        } else {
+            return -1;
+        }
+    }
+
+    /* Move the partial frame, if any, to the front */
+    memmove(connection->buffer, connection->buffer + connection->processed,
+            connection->length - connection->processed);
+    connection->length -= connection->processed;
+    connection->processed = 0;
+    connection->sent = 0;
+
+    if (connection->writing) {
+        struct epoll_event event = { .events = EPOLLIN, .data.ptr = connection };
+        epoll_ctl(worker->epoll_fd, EPOLL_CTL_MOD, connection->fd, &event);
+        connection->writing = false;
+    }
+    return 1;
+}
+
+/**
+ * @brief Reads, answers and writes back pipelined requests
+ */
+static void handle_readable(Worker* worker, Connection* connection) {
+    for (int reads = 0; reads < READS_PER_EVENT; reads++) {
+        if (!connection_reserve(connection)) {
+            connection_close(worker, connection);
+            return;
+        }
+
+        ssize_t received = read(connection->fd, connection->buffer + connection->length,
+                                connection->capacity - connection->length);
+        if (received > 0) {
+            connection->length += (size_t)received;
+            if (!process_frames(worker->server, connection)) {
+                connection_close(worker, connection);
+                return;
+            }
+            int status = flush(worker, connection);
+            if (status < 0) {
+                connection_close(worker, connection);
+                return;
+            }
+            if (status == 0) {
+                return;
+            }
+        } else if (received < 0 && errno == EINTR) {
+            continue;
+        } else if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return;
+        } else {
+            /* Peer closed, or a hard error */
+            connection_close(worker, connection);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Accepts every pending connection
+ */
+static void accept_connections(Worker* worker) {
+    for (;;) {
+        int fd = accept4(worker->server->listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            return;     /* EAGAIN, or out of descriptors until some close */
+        }
+        connection_open(worker, fd);
+    }
+}
+
+/**
+ * @brief Event loop of one worker thread
+ */
+static void* worker_main(void* argument) {
+    Worker* worker = argument;
+    ReversalServer* server = worker->server;
+    struct epoll_event events[MAX_EVENTS];
+    bool running = true;
+
+    while (running) {
+        int count = epoll_wait(worker->epoll_fd, events, MAX_EVENTS, -1);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        for (int i = 0; i < count; i++) {
+            void* tag = events[i].data.ptr;
+            if (tag == &server->stop_fd) {
+                running = false;
+            } else if (tag == &server->listen_fd) {
+                accept_connections(worker);
+            } else {
+                Connection* connection = tag;
+                if (connection->writing) {
+                    if (flush(worker, connection) < 0) {
+                        connection_close(worker, connection);
+                    }
+                } else {
+                    handle_readable(worker, connection);
+                }
+            }
+        }
+    }
+
+    while (worker->connections) {
+        connection_close(worker, worker->connections);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Clears the way for bind() at address
+ * @return true if nothing is there or a stale socket was removed, false if
+ *         the path is not a socket or another server is listening on it
+ */
+static bool remove_stale_socket(const struct sockaddr_un* address) {
+    struct stat status;
+    if (lstat(address->sun_path, &status) != 0) {
+        return errno == ENOENT;
+    }
+    if (!S_ISSOCK(status.st_mode)) {
+        return false;
+    }
+
+    /* A socket nobody accepts on is left over from a server that died */
+    int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (probe < 0) {
+        return false;
+    }
+    bool stale = connect(probe, (const struct sockaddr*)address, sizeof(*address)) != 0 &&
+                 errno == ECONNREFUSED;
+    close(probe);
+    return stale && unlink(address->sun_path) == 0;
+}
+
+/**
+ * @brief Joins running workers and releases everything a server holds
+ */
+static void server_destroy(ReversalServer* server) {
+    if (server->started > 0) {
+        uint64_t signal = 1;
+        ssize_t written = write(server->stop_fd, &signal, sizeof(signal));
+        (void)written;
+        for (size_t i = 0; i < server->started; i++) {
+            pthread_join(server->workers[i].thread, NULL);
+        }
+    }
+
+    for (size_t i = 0; i < server->worker_count; i++) {
+        if (server->workers[i].epoll_fd >= 0) {
+            close(server->workers[i].epoll_fd);
+        }
+    }
+    if (server->stop_fd >= 0) {
+        close(server->stop_fd);
+    }
+    if (server->listen_fd >= 0) {
+        close(server->listen_fd);
+        unlink(server->socket_path);
+    }
+
+    free(server->workers);
+    free(server);
+}
+
+ReversalServerResult reversal_server_start(const ReversalServerOptions* options, ReversalServer** server) {
+    /* Validate input parameters */
+    if (!options || !server || !options->socket_path) {
+        return REVERSAL_SERVER_ERROR_NULL_POINTER;
+    }
+
+    if (options->socket_path[0] == '\0' ||
+        strlen(options->socket_path) >= sizeof(((struct sockaddr_un*)0)->sun_path) ||
+        options->max_request == 0 || options->max_request > UINT32_MAX) {
+        return REVERSAL_SERVER_ERROR_INVALID_OPTIONS;
+    }
+
+    size_t thread_count = options->thread_count;
+    if (thread_count == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        thread_count = online > 0 ? (size_t)online : 1;
+    }
+
+    ReversalServer* created = calloc(1, sizeof(ReversalServer));
+    if (!created) {
+        return REVERSAL_SERVER_ERROR_MEMORY_ALLOCATION;
+    }
+    created->listen_fd = -1;
+    created->stop_fd = -1;
+    created->max_request = options->max_request;
+    atomic_init(&created->requests, 0);
+    strcpy(created->socket_path, options->socket_path);
+
+    created->workers = calloc(thread_count, sizeof(Worker));
+    if (!created->workers) {
+        free(created);
+        return REVERSAL_SERVER_ERROR_MEMORY_ALLOCATION;
+    }
+    created->worker_count = thread_count;
+    for (size_t i = 0; i < thread_count; i++) {
+        created->workers[i].epoll_fd = -1;
+    }
+
+    /* Listening socket */
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, options->socket_path);
+
+    created->listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (created->listen_fd < 0) {
+        server_destroy(created);
+        return REVERSAL_SERVER_ERROR_SOCKET;
+    }
+    if (!remove_stale_socket(&address)) {
+        close(created->listen_fd);
+        created->listen_fd = -1;    /* Not ours to unlink */
+        server_destroy(created);
+        return REVERSAL_SERVER_ERROR_SOCKET;
+    }
+    if (bind(created->listen_fd, (const struct sockaddr*)&address, sizeof(address)) != 0 ||
+        listen(created->listen_fd, SOMAXCONN) != 0) {
+        close(created->listen_fd);
+        created->listen_fd = -1;    /* Not ours to unlink */
+        server_destroy(created);
+        return REVERSAL_SERVER_ERROR_SOCKET;
+    }
+
+    created->stop_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (created->stop_fd < 0) {
+        server_destroy(created);
+        return REVERSAL_SERVER_ERROR_SOCKET;
+    }
+
+    /* Workers */
+    for (size_t i = 0; i < thread_count; i++) {
+        Worker* worker = &created->workers[i];
+        worker->server = created;
+        worker->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+
+        struct epoll_event listen_event = { .events = EPOLLIN | EPOLLEXCLUSIVE, .data.ptr = &created->listen_fd };
+        struct epoll_event stop_event = { .events = EPOLLIN, .data.ptr = &created->stop_fd };
+        if (worker->epoll_fd < 0 ||
+            epoll_ctl(worker->epoll_fd, EPOLL_CTL_ADD, created->listen_fd, &listen_event) != 0 ||
+            epoll_ctl(worker->epoll_fd, EPOLL_CTL_ADD, created->stop_fd, &stop_event) != 0) {
+            server_destroy(created);
+            return REVERSAL_SERVER_ERROR_SOCKET;
+        }
+
+        if (pthread_create(&worker->thread, NULL, worker_main, worker) != 0) {
+            server_destroy(created);
+            return REVERSAL_SERVER_ERROR_THREAD;
+        }
+        created->started++;
+    }
+
+    *server = created;
+    return REVERSAL_SERVER_SUCCESS;
+}
+
+void reversal_server_stop(ReversalServer* server) {
+    if (server) {
+        server_destroy(server);
+    }
+}
+
+ReversalServerResult reversal_server_serve(const ReversalServerOptions* options) {
+    /* Block the shutdown signals so workers inherit the mask and sigwait() sees them */
+    sigset_t signals;
+    sigset_t previous;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, &previous);
+
+    ReversalServer* server = NULL;
+    ReversalServerResult result = reversal_server_start(options, &server);
+    if (result == REVERSAL_SERVER_SUCCESS) {
+        int received;
+        sigwait(&signals, &received);
+        reversal_server_stop(server);
+    }
+
+    pthread_sigmask(SIG_SETMASK, &previous, NULL);
+    return result;
+}
+
+uint64_t reversal_server_request_count(const ReversalServer* server) {
+    return server ? (uint64_t)atomic_load_explicit(&server->requests, memory_order_relaxed) : 0;
+}
+
+#else /* !__linux__ */
+
+ReversalServerResult reversal_server_start(const ReversalServerOptions* options, ReversalServer** server) {
+    (void)options;
+    (void)server;
+    return REVERSAL_SERVER_ERROR_UNSUPPORTED;
+}
+
+void reversal_server_stop(ReversalServer* server) {
+    (void)server;
+}
+
+ReversalServerResult reversal_server_serve(const ReversalServerOptions* options) {
+    (void)options;
+    return REVERSAL_SERVER_ERROR_UNSUPPORTED;
+}
+
+uint64_t reversal_server_request_count(const ReversalServer* server) {
+    (void)server;
+    return 0;
+}
+
+#endif /* __linux__ */
+
+void reversal_server_options_init(ReversalServerOptions* options) {
+    if (options) {
+        options->socket_path = NULL;
+        options->thread_count = 0;
+        options->max_request = REVERSAL_SERVER_DEFAULT_MAX_REQUEST;
+    }
+}
+
+const char* reversal_server_error_string(ReversalServerResult result) {
+    switch (result) {
+        case REVERSAL_SERVER_SUCCESS:
+            return "Success";
+        case REVERSAL_SERVER_ERROR_NULL_POINTER:
+            return "Null pointer provided";
+        case REVERSAL_SERVER_ERROR_INVALID_OPTIONS:
+            return "Invalid server options";
+        case REVERSAL_SERVER_ERROR_SOCKET:
+            return "Socket setup failed";
+        case REVERSAL_SERVER_ERROR_MEMORY_ALLOCATION:
+            return "Memory allocation failed";
+        case REVERSAL_SERVER_ERROR_THREAD:
+            return "Thread creation failed";
+        case REVERSAL_SERVER_ERROR_UNSUPPORTED:
+            return "Not supported on this platform";
+        default:
+            return "Unknown error";
+    }
+}
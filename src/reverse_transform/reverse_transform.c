@@ -0,0 +1,219 @@
+/**
+ * @file reverse_transform.c
+ * @brief Fused Reverse-and-Transform Implementation
+ * @author Jaden Mardini
+ *
+ * The input is consumed 16 bytes at a time from its end. Each block is
+ * byte-reversed in registers with SSE2 shuffles, transformed in registers
+ * (case change and replacement are compare-and-blend), and stored to the
+ * next 16 bytes of output. Filtering stores the whole block and, only when
+ * it holds a rejected byte, compacts the kept bytes over it, which is
+ * cheap because rejected bytes are rare in text. Table mapping has no
+ * SSE2 gather, so it runs as an unrolled scalar loop that still makes one
+ * pass. Fewer than 16 leftover bytes at the start of the input are done
+ * byte by byte.
+ */
+
+#include "reverse_transform.h"
+#include <stdbool.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* Bytes processed per SIMD step */
+#define BLOCK_SIZE 16
+
+/* Static function prototypes */
+static bool is_accepted(unsigned char c);
+static bool transform_byte(unsigned char c, const ReverseTransform* transform, unsigned char* out);
+static size_t reverse_map(const unsigned char* input, size_t length, unsigned char* output,
+                          const unsigned char* map);
+
+/**
+ * @brief Tests whether the character stack accepts a byte (printable ASCII or tab)
+ */
+static inline bool is_accepted(unsigned char c) {
+    return (c >= 0x20 && c <= 0x7E) || c == '\t';
+}
+
+/**
+ * @brief Transforms one byte
+ * @return false if the byte is dropped
+ */
+static inline bool transform_byte(unsigned char c, const ReverseTransform* transform, unsigned char* out) {
+    switch (transform->kind) {
+        case REVERSE_TRANSFORM_UPPER:
+            *out = (c >= 'a' && c <= 'z') ? (unsigned char)(c ^ 0x20) : c;
+            return true;
+        case REVERSE_TRANSFORM_LOWER:
+            *out = (c >= 'A' && c <= 'Z') ? (unsigned char)(c ^ 0x20) : c;
+            return true;
+        case REVERSE_TRANSFORM_FILTER:
+            *out = c;
+            return is_accepted(c);
+        case REVERSE_TRANSFORM_REPLACE:
+            *out = is_accepted(c) ? c : (unsigned char)transform->replacement;
+            return true;
+        case REVERSE_TRANSFORM_MAP:
+            *out = transform->map[c];
+            return true;
+        default:
+            *out = c;
+            return true;
+    }
+}
+
+/**
+ * @brief Reverses through a lookup table, four bytes per iteration
+ */
+static size_t reverse_map(const unsigned char* input, size_t length, unsigned char* output,
+                          const unsigned char* map) {
+    size_t out = 0;
+    size_t back = length;
+
+    while (back >= 4) {
+        output[out] = map[input[back - 1]];
+        output[out + 1] = map[input[back - 2]];
+        output[out + 2] = map[input[back - 3]];
+        output[out + 3] = map[input[back - 4]];
+        out += 4;
+        back -= 4;
+    }
+    while (back > 0) {
+        output[out++] = map[input[--back]];
+    }
+
+    return out;
+}
+
+#if defined(__SSE2__)
+/**
+ * @brief Reverses the 16 bytes of a vector using SSE2 shuffles
+ */
+static inline __m128i reverse_bytes(__m128i v) {
+    v = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+/**
+ * @brief Marks bytes within [low, high]; bytes of 0x80 and above never match
+ */
+static inline __m128i in_range(__m128i v, char low, char high) {
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8((char)(low - 1))),
+                         _mm_cmplt_epi8(v, _mm_set1_epi8((char)(high + 1))));
+}
+
+/**
+ * @brief Marks the bytes of a vector that the character stack accepts
+ */
+static inline __m128i accepted_block(__m128i v) {
+    return _mm_or_si128(in_range(v, 0x20, 0x7E), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+}
+#endif
+
+ReverseTransformResult reverse_transform(const char* input, size_t length, char* output, size_t output_size,
+                                         const ReverseTransform* transform, size_t* output_length) {
+    /* Validate input parameters */
+    if (!input || !output) {
+        return REVERSE_TRANSFORM_ERROR_NULL_POINTER;
+    }
+
+    ReverseTransform plain = { REVERSE_TRANSFORM_NONE, 0, NULL };
+    if (!transform) {
+        transform = &plain;
+    }
+    if (transform->kind > REVERSE_TRANSFORM_MAP ||
+        (transform->kind == REVERSE_TRANSFORM_MAP && !transform->map)) {
+        return REVERSE_TRANSFORM_ERROR_INVALID_TRANSFORM;
+    }
+
+    if (output_size <= length) {
+        return REVERSE_TRANSFORM_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    const unsigned char* source = (const unsigned char*)input;
+    unsigned char* target = (unsigned char*)output;
+    ReverseTransformKind kind = transform->kind;
+    size_t out = 0;
+    size_t back = length;
+
+    if (kind == REVERSE_TRANSFORM_MAP) {
+        out = reverse_map(source, length, target, transform->map);
+        back = 0;
+    }
+
+#if defined(__SSE2__)
+    __m128i replacement = _mm_set1_epi8(transform->replacement);
+    __m128i case_bit = _mm_set1_epi8(0x20);
+
+    while (back >= BLOCK_SIZE) {
+        back -= BLOCK_SIZE;
+        __m128i v = reverse_bytes(_mm_loadu_si128((const __m128i*)(const void*)(source + back)));
+
+        switch (kind) {
+            case REVERSE_TRANSFORM_UPPER:
+                v = _mm_xor_si128(v, _mm_and_si128(in_range(v, 'a', 'z'), case_bit));
+                break;
+            case REVERSE_TRANSFORM_LOWER:
+                v = _mm_xor_si128(v, _mm_and_si128(in_range(v, 'A', 'Z'), case_bit));
+                break;
+            case REVERSE_TRANSFORM_REPLACE: {
+                __m128i keep = accepted_block(v);
+                v = _mm_or_si128(_mm_and_si128(keep, v), _mm_andnot_si128(keep, replacement));
+                break;
+            }
+            default:
+                break;
+        }
+
+        /* Room is guaranteed: out never exceeds the bytes consumed so far */
+        _mm_storeu_si128((__m128i*)(void*)(target + out), v);
+
+        if (kind == REVERSE_TRANSFORM_FILTER) {
+            unsigned keep = (unsigned)_mm_movemask_epi8(accepted_block(v));
+            if (keep != 0xFFFF) {
+                /* Compact kept bytes forward over the stored block */
+                size_t block = out;
+                while (keep) {
+                    target[out++] = target[block + (size_t)__builtin_ctz(keep)];
+                    keep &= keep - 1;
+                }
+                continue;
+            }
+        }
+        out += BLOCK_SIZE;
+    }
+#endif
+
+    while (back > 0) {
+        unsigned char c;
+        if (transform_byte(source[--back], transform, &c)) {
+            target[out++] = c;
+        }
+    }
+
+    target[out] = '\0';
+    if (output_length) {
+        *output_length = out;
+    }
+    return REVERSE_TRANSFORM_SUCCESS;
+}
+
+const char* reverse_transform_error_string(ReverseTransformResult result) {
+    switch (result) {
+        case REVERSE_TRANSFORM_SUCCESS:
+            return "Success";
+        case REVERSE_TRANSFORM_ERROR_NULL_POINTER:
+            return "Null pointer provided";
+        case REVERSE_TRANSFORM_ERROR_INVALID_TRANSFORM:
+            return "Invalid transform";
+        case REVERSE_TRANSFORM_ERROR_BUFFER_TOO_SMALL:
+            return "Output buffer too small";
+        default:
+            return "Unknown error";
+    }
+}
@@ -0,0 +1,199 @@
+/**
+ * @file reversed_view.c
+ * @brief Lazy Reversed String View Implementation
+ * @author Jaden Mardini
+ *
+ * All block operations share one kernel that reverses a span of the
+ * viewed buffer into scratch memory 16 bytes at a time with SSE2 shuffles.
+ * Comparison and output run that kernel over successive blocks and hand
+ * each block to memcmp() or write(), so the cost per byte is one load and
+ * one store into a buffer that is already cached. Hashing needs no
+ * scratch at all, since FNV-1a consumes one byte at a time and can read
+ * the buffer backwards directly.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "reversed_view.h"
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* Bytes reversed per SIMD step */
+#define SIMD_WIDTH 16
+
+/* Scratch size for reversed_view_write_fd, large enough to amortize each write() */
+#define WRITE_CHUNK_SIZE 16384
+
+/* 64-bit FNV-1a parameters */
+#define FNV_OFFSET_BASIS 14695981039346656037ull
+#define FNV_PRIME 1099511628211ull
+
+/* Static function prototypes */
+static void reverse_span(const unsigned char* source, size_t length, unsigned char* output);
+
+#if defined(__SSE2__)
+/**
+ * @brief Reverses the 16 bytes of a vector using SSE2 shuffles
+ */
+static inline __m128i reverse_bytes(__m128i v) {
+    v = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+#endif
+
+/**
+ * @brief Writes source[0..length) to output in reverse order
+ */
+static void reverse_span(const unsigned char* source, size_t length, unsigned char* output) {
+    size_t out = 0;
+    size_t back = length;
+
+#if defined(__SSE2__)
+    while (back >= SIMD_WIDTH) {
+        back -= SIMD_WIDTH;
+        __m128i v = _mm_loadu_si128((const __m128i*)(const void*)(source + back));
+        _mm_storeu_si128((__m128i*)(void*)(output + out), reverse_bytes(v));
+        out += SIMD_WIDTH;
+    }
+#endif
+
+    while (back > 0) {
+        output[out++] = source[--back];
+    }
+}
+
+ReversedView reversed_view_make(const char* data, size_t length) {
+    ReversedView view = { data, data ? length : 0 };
+    return view;
+}
+
+char reversed_view_at(ReversedView view, size_t index) {
+    return view.data[view.length - 1 - index];
+}
+
+void reversed_view_iterator_init(ReversedViewIterator* iterator, ReversedView view) {
+    if (iterator) {
+        iterator->view = view;
+        iterator->remaining = view.length;
+    }
+}
+
+size_t reversed_view_next_block(ReversedViewIterator* iterator, const char** block) {
+    /* Validate input parameters */
+    if (!iterator || !block || iterator->remaining == 0) {
+        return 0;
+    }
+
+    size_t length = iterator->remaining < REVERSED_VIEW_BLOCK_SIZE ? iterator->remaining
+                                                                   : REVERSED_VIEW_BLOCK_SIZE;
+    iterator->remaining -= length;
+    reverse_span((const unsigned char*)iterator->view.data + iterator->remaining, length,
+                 (unsigned char*)iterator->block);
+
+    *block = iterator->block;
+    return length;
+}
+
+uint64_t reversed_view_hash(ReversedView view) {
+    const unsigned char* data = (const unsigned char*)view.data;
+    uint64_t hash = FNV_OFFSET_BASIS;
+
+    for (size_t i = view.length; i > 0; i--) {
+        hash = (hash ^ data[i - 1]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+int reversed_view_compare(ReversedView view, const char* other, size_t other_length) {
+    size_t common = view.length < other_length ? view.length : other_length;
+
+    if (common > 0) {
+        /* Only the first common bytes of the view are ever reversed */
+        ReversedViewIterator iterator;
+        reversed_view_iterator_init(&iterator, reversed_view_make(view.data + (view.length - common), common));
+
+        const char* block;
+        size_t offset = 0;
+        size_t length;
+        while ((length = reversed_view_next_block(&iterator, &block)) > 0) {
+            int order = memcmp(block, other + offset, length);
+            if (order != 0) {
+                return order;
+            }
+            offset += length;
+        }
+    }
+
+    return (view.length > other_length) - (view.length < other_length);
+}
+
+bool reversed_view_equals(ReversedView view, const char* other, size_t other_length) {
+    return view.length == other_length && reversed_view_compare(view, other, other_length) == 0;
+}
+
+ReversedViewResult reversed_view_copy(ReversedView view, char* output, size_t output_size) {
+    /* Validate input parameters */
+    if (!output || (!view.data && view.length > 0)) {
+        return REVERSED_VIEW_ERROR_NULL_POINTER;
+    }
+
+    if (output_size <= view.length) {
+        return REVERSED_VIEW_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    reverse_span((const unsigned char*)view.data, view.length, (unsigned char*)output);
+    output[view.length] = '\0';
+    return REVERSED_VIEW_SUCCESS;
+}
+
+ReversedViewResult reversed_view_write_fd(ReversedView view, int fd) {
+    /* Validate input parameters */
+    if (!view.data && view.length > 0) {
+        return REVERSED_VIEW_ERROR_NULL_POINTER;
+    }
+
+    unsigned char chunk[WRITE_CHUNK_SIZE];
+    size_t remaining = view.length;
+
+    while (remaining > 0) {
+        size_t length = remaining < WRITE_CHUNK_SIZE ? remaining : WRITE_CHUNK_SIZE;
+        remaining -= length;
+        reverse_span((const unsigned char*)view.data + remaining, length, chunk);
+
+        size_t written = 0;
+        while (written < length) {
+            ssize_t result = write(fd, chunk + written, length - written);
+            if (result < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return REVERSED_VIEW_ERROR_IO;
+            }
+            written += (size_t)result;
+        }
+    }
+
+    return REVERSED_VIEW_SUCCESS;
+}
+
+const char* reversed_view_error_string(ReversedViewResult result) {
+    switch (result) {
+        case REVERSED_VIEW_SUCCESS:
+            return "Success";
+        case REVERSED_VIEW_ERROR_NULL_POINTER:
+            return "Null pointer provided";
+        case REVERSED_VIEW_ERROR_BUFFER_TOO_SMALL:
+            return "Output buffer too small";
+        case REVERSED_VIEW_ERROR_IO:
+            return "Write failed";
+        default:
+            return "Unknown error";
+    }
+}
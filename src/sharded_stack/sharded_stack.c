@@ -0,0 +1,284 @@
+/**
+ * @file sharded_stack.c
+ * @brief Sharded Stack Pool Implementation
+ * @author Jaden Mardini
+ *
+ * Each shard is a Stack guarded by a test-and-test-and-set spinlock on its
+ * own cache line. The Stack's header and element array are created on
+ * cache lines of their own too, so a thread working on its own shard pays
+ * one uncontended atomic exchange per operation and shares no cache lines
+ * with other threads. A thread blocks on at most one lock at a time: a
+ * steal holds the thief's own shard and only try-locks the victim,
+ * skipping it if busy, which rules out lock-order deadlock. Stealing moves
+ * half of the victim's items, up to SHARDED_STACK_STEAL_BATCH, so an
+ * emptied shard is refilled for many pops at once.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "sharded_stack.h"
+#include <sched.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/* Keeps shards on separate cache lines */
+#define SHARD_CACHE_LINE_SIZE 64
+
+/* Spins on a held lock before yielding the CPU */
+#define LOCK_SPINS_BEFORE_YIELD 64
+
+/* Full passes over busy victims before a pop gives up */
+#define STEAL_PASSES 4
+
+/* One shard */
+typedef struct {
+    alignas(SHARD_CACHE_LINE_SIZE) atomic_bool locked;
+    atomic_size_t count;        /* Shard size, published for size_approx */
+    Stack* stack;
+} Shard;
+
+/* Sharded stack structure definition (opaque to users) */
+struct ShardedStack {
+    Shard* shards;
+    size_t shard_count;
+    atomic_size_t steals;
+};
+
+/* Round-robin thread numbering, shared by all sharded stacks */
+static atomic_size_t next_thread_ordinal = 0;
+static _Thread_local size_t thread_ordinal = 0;    /* 0 until assigned, then ordinal + 1 */
+
+/* Static function prototypes */
+static void shard_lock(Shard* shard);
+static bool shard_try_lock(Shard* shard);
+static void shard_unlock(Shard* shard);
+static size_t home_shard(const ShardedStack* stack);
+static bool steal_into(ShardedStack* stack, Shard* home, Shard* victim, int* value);
+
+/**
+ * @brief Acquires a shard lock, spinning on a plain load and then yielding
+ */
+static void shard_lock(Shard* shard) {
+    unsigned spins = 0;
+    while (atomic_exchange_explicit(&shard->locked, true, memory_order_acquire)) {
+        while (atomic_load_explicit(&shard->locked, memory_order_relaxed)) {
+            if (++spins >= LOCK_SPINS_BEFORE_YIELD) {
+                sched_yield();
+                spins = 0;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Acquires a shard lock only if it is free
+ */
+static bool shard_try_lock(Shard* shard) {
+    return !atomic_load_explicit(&shard->locked, memory_order_relaxed) &&
+           !atomic_exchange_explicit(&shard->locked, true, memory_order_acquire);
+}
+
+/**
+ * @brief Releases a shard lock
+ */
+static void shard_unlock(Shard* shard) {
+    atomic_store_explicit(&shard->locked, false, memory_order_release);
+}
+
+/**
+ * @brief Returns the calling thread's shard index
+ */
+static size_t home_shard(const ShardedStack* stack) {
+    if (thread_ordinal == 0) {
+        thread_ordinal = atomic_fetch_add_explicit(&next_thread_ordinal, 1, memory_order_relaxed) + 1;
+    }
+    return (thread_ordinal - 1) % stack->shard_count;
+}
+
+/**
+ * @brief Moves half of victim's items (at most a batch) into home, then pops one
+ * @return true if a value was obtained
+ *
+ * Called with home locked; victim is only try-locked.
+ */
+static bool steal_into(ShardedStack* stack, Shard* home, Shard* victim, int* value) {
+    size_t available = stack_size(victim->stack);
+    size_t room = stack_capacity(home->stack) - stack_size(home->stack);
+    size_t take = (available + 1) / 2;
+    if (take > SHARDED_STACK_STEAL_BATCH) {
+        take = SHARDED_STACK_STEAL_BATCH;
+    }
+    if (take > room + 1) {
+        take = room + 1;    /* One item is returned directly */
+    }
+    if (take == 0) {
+        return false;
+    }
+
+    /* Keep the victim's newest item for the caller and move the rest */
+    stack_pop(victim->stack, value);
+    for (size_t i = 1; i < take; i++) {
+        int moved;
+        stack_pop(victim->stack, &moved);
+        stack_push(home->stack, moved);
+    }
+
+    atomic_store_explicit(&victim->count, stack_size(victim->stack), memory_order_relaxed);
+    atomic_store_explicit(&home->count, stack_size(home->stack), memory_order_relaxed);
+    atomic_fetch_add_explicit(&stack->steals, 1, memory_order_relaxed);
+    return true;
+}
+
+ShardedStack* sharded_stack_create(size_t shard_count, size_t shard_capacity) {
+    if (shard_count == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        shard_count = online > 0 ? (size_t)online : 1;
+    }
+
+    ShardedStack* stack = malloc(sizeof(ShardedStack));
+    if (!stack) {
+        return NULL;
+    }
+
+    stack->shards = aligned_alloc(SHARD_CACHE_LINE_SIZE, shard_count * sizeof(Shard));
+    if (!stack->shards) {
+        free(stack);
+        return NULL;
+    }
+
+    stack->shard_count = shard_count;
+    atomic_init(&stack->steals, 0);
+
+    /* Shard headers and element arrays each get whole cache lines of their own */
+    StackOptions options;
+    stack_options_init(&options);
+    options.pad_header = true;
+    options.alignment = STACK_CACHE_LINE_SIZE;
+
+    for (size_t i = 0; i < shard_count; i++) {
+        Shard* shard = &stack->shards[i];
+        atomic_init(&shard->locked, false);
+        atomic_init(&shard->count, 0);
+        shard->stack = stack_create_with_options(shard_capacity, &options);
+        if (!shard->stack) {
+            stack->shard_count = i;
+            sharded_stack_destroy(stack);
+            return NULL;
+        }
+        /* Popped slots are recycled, so skip wiping them */
+        stack_set_wipe_policy(shard->stack, STACK_WIPE_NEVER);
+    }
+
+    return stack;
+}
+
+void sharded_stack_destroy(ShardedStack* stack) {
+    if (stack) {
+        for (size_t i = 0; i < stack->shard_count; i++) {
+            stack_destroy(stack->shards[i].stack);
+        }
+        free(stack->shards);
+        free(stack);
+    }
+}
+
+StackResult sharded_stack_push(ShardedStack* stack, int value) {
+    /* Validate input parameters */
+    if (!stack) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    size_t home = home_shard(stack);
+    for (size_t i = 0; i < stack->shard_count; i++) {
+        Shard* shard = &stack->shards[(home + i) % stack->shard_count];
+        shard_lock(shard);
+        StackResult result = stack_push(shard->stack, value);
+        if (result == STACK_SUCCESS) {
+            atomic_store_explicit(&shard->count, stack_size(shard->stack), memory_order_relaxed);
+        }
+        shard_unlock(shard);
+
+        if (result == STACK_SUCCESS) {
+            return STACK_SUCCESS;
+        }
+    }
+
+    return STACK_ERROR_OVERFLOW;
+}
+
+StackResult sharded_stack_pop(ShardedStack* stack, int* value) {
+    /* Validate input parameters */
+    if (!stack || !value) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    size_t index = home_shard(stack);
+    Shard* home = &stack->shards[index];
+
+    shard_lock(home);
+    if (stack_pop(home->stack, value) == STACK_SUCCESS) {
+        atomic_store_explicit(&home->count, stack_size(home->stack), memory_order_relaxed);
+        shard_unlock(home);
+        return STACK_SUCCESS;
+    }
+
+    /* Own shard empty: steal, retrying while some victims were busy */
+    for (int pass = 0; pass < STEAL_PASSES; pass++) {
+        bool busy = false;
+        for (size_t i = 1; i < stack->shard_count; i++) {
+            Shard* victim = &stack->shards[(index + i) % stack->shard_count];
+            if (atomic_load_explicit(&victim->count, memory_order_relaxed) == 0) {
+                continue;
+            }
+            if (!shard_try_lock(victim)) {
+                busy = true;
+                continue;
+            }
+            bool stolen = steal_into(stack, home, victim, value);
+            shard_unlock(victim);
+            if (stolen) {
+                shard_unlock(home);
+                return STACK_SUCCESS;
+            }
+        }
+        if (!busy) {
+            break;
+        }
+
+        /* Let busy victims' owners finish without holding our shard */
+        shard_unlock(home);
+        sched_yield();
+        shard_lock(home);
+        if (stack_pop(home->stack, value) == STACK_SUCCESS) {
+            atomic_store_explicit(&home->count, stack_size(home->stack), memory_order_relaxed);
+            shard_unlock(home);
+            return STACK_SUCCESS;
+        }
+    }
+
+    shard_unlock(home);
+    return STACK_ERROR_UNDERFLOW;
+}
+
+size_t sharded_stack_size_approx(const ShardedStack* stack) {
+    if (!stack) {
+        return 0;
+    }
+
+    size_t total = 0;
+    for (size_t i = 0; i < stack->shard_count; i++) {
+        total += atomic_load_explicit(&stack->shards[i].count, memory_order_relaxed);
+    }
+    return total;
+}
+
+size_t sharded_stack_shard_count(const ShardedStack* stack) {
+    return stack ? stack->shard_count : 0;
+}
+
+size_t sharded_stack_steal_count(const ShardedStack* stack) {
+    return stack ? atomic_load_explicit(&stack->steals, memory_order_relaxed) : 0;
+}
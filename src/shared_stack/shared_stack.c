@@ -0,0 +1,281 @@
+/**
+ * @file shared_stack.c
+ * @brief Shared-Memory Cross-Process Stack Implementation
+ * @author Jaden Mardini
+ *
+ * The region holds a header and an array of slots. Two Treiber lists
+ * thread through the slots: the stack itself and a free list. A link is a
+ * slot index plus one, so 0 ends a list, and each list head is a 64-bit
+ * word whose upper half is a tag bumped by every successful update, which
+ * stops a head that was popped and pushed back meanwhile from passing a
+ * stale compare-and-swap. A push takes a slot from the free list, fills
+ * it and links it on top; a pop unlinks the top slot, reads it and
+ * returns it to the free list. Every step is a single atomic update, so
+ * a process killed between the two halves of an operation leaves both
+ * lists intact and only strands the slot it held.
+ *
+ * The creator publishes the magic number last, with release ordering, so
+ * a process attaching while the region is still being set up is refused
+ * instead of seeing half-initialized lists.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "shared_stack.h"
+#include <fcntl.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Identifies an initialized region: "SHSTACK1" */
+#define SHARED_STACK_MAGIC 0x5348535441434B31ull
+
+/* Keeps the two list heads and the counter on separate cache lines */
+#define SHARED_CACHE_LINE_SIZE 64
+
+/* Link value that ends a list */
+#define NO_LINK 0u
+
+/* Processes only share atomics that are lock-free, and therefore address-free */
+#if ATOMIC_LLONG_LOCK_FREE != 2 || ATOMIC_INT_LOCK_FREE != 2
+#error "shared_stack requires lock-free 32- and 64-bit atomics"
+#endif
+
+/* One value slot */
+typedef struct {
+    atomic_uint_least32_t next; /* Link to the slot below, or NO_LINK */
+    int value;
+} Slot;
+
+/* Layout at the start of the shared memory object */
+typedef struct {
+    atomic_uint_least64_t magic;
+    uint64_t capacity;
+    alignas(SHARED_CACHE_LINE_SIZE) atomic_uint_least64_t top;
+    alignas(SHARED_CACHE_LINE_SIZE) atomic_uint_least64_t free_list;
+    alignas(SHARED_CACHE_LINE_SIZE) atomic_int_least64_t size;
+} Region;
+
+/* Per-process handle (opaque to users) */
+struct SharedStack {
+    Region* region;
+    Slot* slots;
+    size_t mapped_size;
+};
+
+/* Static function prototypes */
+static bool region_size(size_t capacity, size_t* size);
+static SharedStack* make_handle(Region* region, size_t mapped_size);
+static void list_push(atomic_uint_least64_t* head, Slot* slots, uint32_t link);
+static uint32_t list_pop(atomic_uint_least64_t* head, Slot* slots);
+
+/**
+ * @brief Computes the bytes a stack of the given capacity maps
+ */
+static bool region_size(size_t capacity, size_t* size) {
+    if (capacity > (SIZE_MAX - sizeof(Region)) / sizeof(Slot)) {
+        return false;
+    }
+    *size = sizeof(Region) + capacity * sizeof(Slot);
+    return true;
+}
+
+/**
+ * @brief Wraps a mapped region in a process-local handle; unmaps it on failure
+ */
+static SharedStack* make_handle(Region* region, size_t mapped_size) {
+    SharedStack* stack = malloc(sizeof(SharedStack));
+    if (!stack) {
+        munmap(region, mapped_size);
+        return NULL;
+    }
+
+    stack->region = region;
+    stack->slots = (Slot*)(void*)(region + 1);
+    stack->mapped_size = mapped_size;
+    return stack;
+}
+
+/**
+ * @brief Links a slot the caller owns onto a list
+ */
+static void list_push(atomic_uint_least64_t* head, Slot* slots, uint32_t link) {
+    uint64_t old = atomic_load_explicit(head, memory_order_relaxed);
+    uint64_t new;
+
+    do {
+        atomic_store_explicit(&slots[link - 1].next, (uint32_t)old, memory_order_relaxed);
+        new = (((old >> 32) + 1) << 32) | link;
+    } while (!atomic_compare_exchange_weak_explicit(head, &old, new, memory_order_release, memory_order_relaxed));
+}
+
+/**
+ * @brief Unlinks the first slot of a list and hands it to the caller
+ * @return Link of the slot, or NO_LINK if the list was empty
+ */
+static uint32_t list_pop(atomic_uint_least64_t* head, Slot* slots) {
+    uint64_t old = atomic_load_explicit(head, memory_order_acquire);
+
+    for (;;) {
+        uint32_t link = (uint32_t)old;
+        if (link == NO_LINK) {
+            return NO_LINK;
+        }
+
+        /* The slot may be taken meanwhile; the tag then fails the exchange */
+        uint32_t next = atomic_load_explicit(&slots[link - 1].next, memory_order_relaxed);
+        uint64_t new = (((old >> 32) + 1) << 32) | next;
+        if (atomic_compare_exchange_weak_explicit(head, &old, new, memory_order_acquire, memory_order_acquire)) {
+            return link;
+        }
+    }
+}
+
+SharedStack* shared_stack_create(const char* name, size_t capacity) {
+    size_t size;
+    if (!name || capacity == 0 || capacity > SHARED_STACK_MAX_CAPACITY || !region_size(capacity, &size)) {
+        return NULL;
+    }
+
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    Region* region = MAP_FAILED;
+    if (ftruncate(fd, (off_t)size) == 0) {
+        region = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (region == MAP_FAILED) {
+        shm_unlink(name);
+        return NULL;
+    }
+
+    /* Every slot starts on the free list, slot 0 first */
+    Slot* slots = (Slot*)(void*)(region + 1);
+    for (size_t i = 0; i < capacity; i++) {
+        atomic_init(&slots[i].next, i + 1 < capacity ? (uint32_t)(i + 2) : NO_LINK);
+        slots[i].value = 0;
+    }
+    region->capacity = capacity;
+    atomic_init(&region->top, NO_LINK);
+    atomic_init(&region->free_list, 1);
+    atomic_init(&region->size, 0);
+    atomic_store_explicit(&region->magic, SHARED_STACK_MAGIC, memory_order_release);
+
+    SharedStack* stack = make_handle(region, size);
+    if (!stack) {
+        shm_unlink(name);
+    }
+    return stack;
+}
+
+SharedStack* shared_stack_attach(const char* name) {
+    if (!name) {
+        return NULL;
+    }
+
+    int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    struct stat info;
+    Region* region = MAP_FAILED;
+    size_t mapped_size = 0;
+    if (fstat(fd, &info) == 0 && (size_t)info.st_size >= sizeof(Region)) {
+        mapped_size = (size_t)info.st_size;
+        region = mmap(NULL, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (region == MAP_FAILED) {
+        return NULL;
+    }
+
+    /* Refuse regions that are not, or not yet, a complete shared stack */
+    size_t needed;
+    if (atomic_load_explicit(&region->magic, memory_order_acquire) != SHARED_STACK_MAGIC ||
+        region->capacity == 0 || region->capacity > SHARED_STACK_MAX_CAPACITY ||
+        !region_size((size_t)region->capacity, &needed) || needed > mapped_size) {
+        munmap(region, mapped_size);
+        return NULL;
+    }
+
+    return make_handle(region, mapped_size);
+}
+
+void shared_stack_detach(SharedStack* stack) {
+    if (stack) {
+        munmap(stack->region, stack->mapped_size);
+        free(stack);
+    }
+}
+
+StackResult shared_stack_unlink(const char* name) {
+    /* Validate input parameters */
+    if (!name) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    return shm_unlink(name) == 0 ? STACK_SUCCESS : STACK_ERROR_IO;
+}
+
+StackResult shared_stack_push(SharedStack* stack, int value) {
+    /* Validate input parameters */
+    if (!stack) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    uint32_t link = list_pop(&stack->region->free_list, stack->slots);
+    if (link == NO_LINK) {
+        return STACK_ERROR_OVERFLOW;
+    }
+
+    stack->slots[link - 1].value = value;
+    list_push(&stack->region->top, stack->slots, link);
+    atomic_fetch_add_explicit(&stack->region->size, 1, memory_order_relaxed);
+    return STACK_SUCCESS;
+}
+
+StackResult shared_stack_pop(SharedStack* stack, int* value) {
+    /* Validate input parameters */
+    if (!stack || !value) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    uint32_t link = list_pop(&stack->region->top, stack->slots);
+    if (link == NO_LINK) {
+        return STACK_ERROR_UNDERFLOW;
+    }
+
+    *value = stack->slots[link - 1].value;
+    list_push(&stack->region->free_list, stack->slots, link);
+    atomic_fetch_sub_explicit(&stack->region->size, 1, memory_order_relaxed);
+    return STACK_SUCCESS;
+}
+
+size_t shared_stack_size(const SharedStack* stack) {
+    if (!stack) {
+        return 0;
+    }
+
+    /* A pop can be counted before the push it undid, so clamp */
+    int_least64_t size = atomic_load_explicit(&stack->region->size, memory_order_relaxed);
+    if (size < 0) {
+        return 0;
+    }
+    return (uint64_t)size > stack->region->capacity ? (size_t)stack->region->capacity : (size_t)size;
+}
+
+size_t shared_stack_capacity(const SharedStack* stack) {
+    return stack ? (size_t)stack->region->capacity : 0;
+}
+
+bool shared_stack_is_empty(const SharedStack* stack) {
+    return !stack || (uint32_t)atomic_load_explicit(&stack->region->top, memory_order_relaxed) == NO_LINK;
+}
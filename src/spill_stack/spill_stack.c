@@ -0,0 +1,554 @@
+/**
+ * @file spill_stack.c
+ * @brief Spill-to-Disk Stack Implementation
+ * @author Jaden Mardini
+ *
+ * Segment i of the stack always occupies byte range i * SEGMENT_BYTES of
+ * the spill file, so spilling the bottom resident segment appends right
+ * after the previous spill and the file is written strictly sequentially
+ * while the stack grows. Segments below first_resident exist only on
+ * disk; the rest are in memory, the top one partially filled. Spills
+ * happen in the pushing thread, because the segment must leave memory to
+ * honour the budget anyway. Reads are split off: once pops bring the
+ * resident segments down to half the limit, a reader thread loads the
+ * segment just below them into a spare buffer, which a later pop crossing
+ * a segment boundary adopts. A pop only waits if it reaches that segment
+ * before the read finishes.
+ *
+ * Keeping the top segment non-empty whenever the stack is not empty means
+ * peek never needs the segment below, and the gap between the spill limit
+ * and the prefetch mark keeps a push/pop sequence that hovers around one
+ * boundary from bouncing a segment to disk and back.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "spill_stack.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+/* Bytes in one segment, the unit of every spill file transfer */
+#define SEGMENT_BYTES ((size_t)SPILL_STACK_SEGMENT_VALUES * sizeof(int))
+
+/* State of the single outstanding prefetch */
+typedef enum {
+    PREFETCH_IDLE = 0,
+    PREFETCH_PENDING,           /* Requested, the reader thread owns the buffer */
+    PREFETCH_DONE               /* Read finished, successfully or not */
+} PrefetchState;
+
+/* Spill stack structure definition (opaque to users) */
+struct SpillStack {
+    int* top;                   /* segments[segment_count - 1] */
+    size_t top_count;           /* Values in the top segment; 0 only when empty */
+    size_t size;
+    int** segments;             /* Bottom first; NULL for spilled segments */
+    size_t segment_capacity;
+    size_t segment_count;
+    size_t first_resident;      /* Segments below this index are only on disk */
+    size_t resident_limit;
+    int* spare;                 /* One free segment kept to avoid allocator churn */
+    char* directory;
+    int fd;                     /* Spill file, or -1 before the first spill */
+
+    /* Prefetch, shared with the reader thread under lock */
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    pthread_t reader;
+    bool reader_running;
+    bool stopping;
+    PrefetchState prefetch_state;
+    size_t prefetch_index;
+    int* prefetch_buffer;
+    bool prefetch_ok;
+
+    uint64_t bytes_written;
+    uint64_t bytes_read;
+    uint64_t prefetch_hits;
+    uint64_t prefetch_misses;
+};
+
+/* Static function prototypes */
+static int* segment_acquire(SpillStack* stack);
+static void segment_release(SpillStack* stack, int* segment);
+static bool transfer_segment(int fd, int* segment, size_t index, bool write_out);
+static void* reader_main(void* argument);
+static bool open_spill_file(SpillStack* stack);
+static int* prefetch_take(SpillStack* stack, bool wait, bool* ok);
+static void prefetch_collect(SpillStack* stack);
+static void prefetch_start(SpillStack* stack);
+static StackResult spill_bottom(SpillStack* stack);
+static StackResult load_below(SpillStack* stack);
+static StackResult push_segment(SpillStack* stack, int value);
+static StackResult pop_segment(SpillStack* stack, int* value);
+
+/**
+ * @brief Returns the spare segment or allocates one
+ */
+static int* segment_acquire(SpillStack* stack) {
+    int* segment = stack->spare;
+    if (segment) {
+        stack->spare = NULL;
+        return segment;
+    }
+    return malloc(SEGMENT_BYTES);
+}
+
+/**
+ * @brief Keeps a segment as the spare, or frees it if there already is one
+ */
+static void segment_release(SpillStack* stack, int* segment) {
+    if (!stack->spare) {
+        stack->spare = segment;
+    } else {
+        free(segment);
+    }
+}
+
+/**
+ * @brief Writes a segment to, or reads it from, its slot in the spill file
+ */
+static bool transfer_segment(int fd, int* segment, size_t index, bool write_out) {
+    char* bytes = (char*)segment;
+    off_t offset = (off_t)index * (off_t)SEGMENT_BYTES;
+    size_t done = 0;
+
+    while (done < SEGMENT_BYTES) {
+        ssize_t n = write_out ? pwrite(fd, bytes + done, SEGMENT_BYTES - done, offset + (off_t)done)
+                              : pread(fd, bytes + done, SEGMENT_BYTES - done, offset + (off_t)done);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        done += (size_t)n;
+    }
+    return true;
+}
+
+/**
+ * @brief Reader thread: performs one requested segment read at a time
+ */
+static void* reader_main(void* argument) {
+    SpillStack* stack = argument;
+
+    pthread_mutex_lock(&stack->lock);
+    for (;;) {
+        while (!stack->stopping && stack->prefetch_state != PREFETCH_PENDING) {
+            pthread_cond_wait(&stack->changed, &stack->lock);
+        }
+        if (stack->stopping) {
+            break;
+        }
+
+        int* buffer = stack->prefetch_buffer;
+        size_t index = stack->prefetch_index;
+        pthread_mutex_unlock(&stack->lock);
+
+        bool ok = transfer_segment(stack->fd, buffer, index, false);
+
+        pthread_mutex_lock(&stack->lock);
+        stack->prefetch_ok = ok;
+        stack->prefetch_state = PREFETCH_DONE;
+        pthread_cond_broadcast(&stack->changed);
+    }
+    pthread_mutex_unlock(&stack->lock);
+    return NULL;
+}
+
+/**
+ * @brief Creates the unlinked spill file and starts the reader thread
+ */
+static bool open_spill_file(SpillStack* stack) {
+    size_t length = strlen(stack->directory) + sizeof("/spill-stack-XXXXXX");
+    char* path = malloc(length);
+    if (!path) {
+        return false;
+    }
+    snprintf(path, length, "%s/spill-stack-XXXXXX", stack->directory);
+
+    int fd = mkstemp(path);
+    if (fd >= 0) {
+        unlink(path);
+    }
+    free(path);
+    if (fd < 0) {
+        return false;
+    }
+
+    stack->fd = fd;
+    if (pthread_create(&stack->reader, NULL, reader_main, stack) != 0) {
+        close(fd);
+        stack->fd = -1;
+        return false;
+    }
+    stack->reader_running = true;
+    return true;
+}
+
+/**
+ * @brief Takes the result of an outstanding prefetch, if any
+ * @param wait Wait for a pending read instead of leaving it running
+ * @param ok Set to whether the read succeeded
+ * @return The prefetch buffer, or NULL if there was nothing to take
+ */
+static int* prefetch_take(SpillStack* stack, bool wait, bool* ok) {
+    int* buffer = NULL;
+
+    pthread_mutex_lock(&stack->lock);
+    if (wait) {
+        while (stack->prefetch_state == PREFETCH_PENDING) {
+            pthread_cond_wait(&stack->changed, &stack->lock);
+        }
+    }
+    if (stack->prefetch_state == PREFETCH_DONE) {
+        buffer = stack->prefetch_buffer;
+        *ok = stack->prefetch_ok;
+        stack->prefetch_buffer = NULL;
+        stack->prefetch_state = PREFETCH_IDLE;
+    }
+    pthread_mutex_unlock(&stack->lock);
+    return buffer;
+}
+
+/**
+ * @brief Adopts a finished prefetch as the new bottom resident segment
+ */
+static void prefetch_collect(SpillStack* stack) {
+    if (!stack->reader_running) {
+        return;
+    }
+
+    bool ok = false;
+    int* buffer = prefetch_take(stack, false, &ok);
+    if (!buffer) {
+        return;
+    }
+
+    if (ok) {
+        stack->first_resident--;
+        stack->segments[stack->first_resident] = buffer;
+        stack->bytes_read += SEGMENT_BYTES;
+        stack->prefetch_hits++;
+    } else {
+        segment_release(stack, buffer);     /* load_below() retries synchronously */
+    }
+}
+
+/**
+ * @brief Asks the reader for the segment below the resident ones once few remain
+ */
+static void prefetch_start(SpillStack* stack) {
+    if (stack->first_resident == 0 ||
+        stack->segment_count - stack->first_resident > stack->resident_limit / 2) {
+        return;
+    }
+
+    pthread_mutex_lock(&stack->lock);
+    if (stack->prefetch_state == PREFETCH_IDLE) {
+        int* buffer = segment_acquire(stack);
+        if (buffer) {
+            stack->prefetch_buffer = buffer;
+            stack->prefetch_index = stack->first_resident - 1;
+            stack->prefetch_state = PREFETCH_PENDING;
+            pthread_cond_broadcast(&stack->changed);
+        }
+    }
+    pthread_mutex_unlock(&stack->lock);
+}
+
+/**
+ * @brief Writes the bottom resident segment to the spill file and frees it
+ */
+static StackResult spill_bottom(SpillStack* stack) {
+    /* A segment read back now would only push the stack over budget */
+    bool ok = false;
+    int* prefetched = prefetch_take(stack, true, &ok);
+    if (prefetched) {
+        segment_release(stack, prefetched);
+    }
+
+    if (stack->fd < 0 && !open_spill_file(stack)) {
+        return STACK_ERROR_IO;
+    }
+
+    int* segment = stack->segments[stack->first_resident];
+    if (!transfer_segment(stack->fd, segment, stack->first_resident, true)) {
+        return STACK_ERROR_IO;
+    }
+
+    stack->segments[stack->first_resident] = NULL;
+    stack->first_resident++;
+    stack->bytes_written += SEGMENT_BYTES;
+    segment_release(stack, segment);
+    return STACK_SUCCESS;
+}
+
+/**
+ * @brief Makes the spilled segment just below the resident ones resident
+ */
+static StackResult load_below(SpillStack* stack) {
+    size_t index = stack->first_resident - 1;
+
+    /* Use the prefetch, waiting for it if it is still running */
+    bool ok = false;
+    bool hit = true;
+    int* buffer = prefetch_take(stack, false, &ok);
+    if (!buffer) {
+        hit = false;
+        buffer = prefetch_take(stack, true, &ok);
+    }
+    if (buffer && !ok) {
+        segment_release(stack, buffer);
+        buffer = NULL;
+    }
+
+    if (!buffer) {
+        hit = false;
+        buffer = segment_acquire(stack);
+        if (!buffer) {
+            return STACK_ERROR_MEMORY_ALLOCATION;
+        }
+        if (!transfer_segment(stack->fd, buffer, index, false)) {
+            segment_release(stack, buffer);
+            return STACK_ERROR_IO;
+        }
+    }
+
+    stack->segments[index] = buffer;
+    stack->first_resident = index;
+    stack->bytes_read += SEGMENT_BYTES;
+    if (hit) {
+        stack->prefetch_hits++;
+    } else {
+        stack->prefetch_misses++;
+    }
+    return STACK_SUCCESS;
+}
+
+/**
+ * @brief Push slow path: starts a new top segment, spilling first if over budget
+ */
+static StackResult push_segment(SpillStack* stack, int value) {
+    if (stack->segment_count - stack->first_resident >= stack->resident_limit) {
+        StackResult result = spill_bottom(stack);
+        if (result != STACK_SUCCESS) {
+            return result;
+        }
+    }
+
+    if (stack->segment_count == stack->segment_capacity) {
+        size_t capacity = stack->segment_capacity * 2;
+        int** segments = realloc(stack->segments, capacity * sizeof(int*));
+        if (!segments) {
+            return STACK_ERROR_MEMORY_ALLOCATION;
+        }
+        stack->segments = segments;
+        stack->segment_capacity = capacity;
+    }
+
+    int* segment = segment_acquire(stack);
+    if (!segment) {
+        return STACK_ERROR_MEMORY_ALLOCATION;
+    }
+
+    stack->segments[stack->segment_count++] = segment;
+    stack->top = segment;
+    stack->top[0] = value;
+    stack->top_count = 1;
+    stack->size++;
+    return STACK_SUCCESS;
+}
+
+/**
+ * @brief Pop slow path: removes the last value of the top segment
+ */
+static StackResult pop_segment(SpillStack* stack, int* value) {
+    if (stack->size == 0) {
+        return STACK_ERROR_UNDERFLOW;
+    }
+
+    if (stack->segment_count == 1) {
+        *value = stack->top[--stack->top_count];
+        stack->size--;
+        return STACK_SUCCESS;
+    }
+
+    /* The segment below becomes the top, so it must be in memory first */
+    size_t below = stack->segment_count - 2;
+    if (!stack->segments[below]) {
+        StackResult result = load_below(stack);
+        if (result != STACK_SUCCESS) {
+            return result;
+        }
+    }
+
+    *value = stack->top[0];
+    stack->size--;
+    segment_release(stack, stack->top);
+    stack->segment_count--;
+    stack->segments[stack->segment_count] = NULL;
+    stack->top = stack->segments[below];
+    stack->top_count = SPILL_STACK_SEGMENT_VALUES;
+
+    prefetch_collect(stack);
+    prefetch_start(stack);
+    return STACK_SUCCESS;
+}
+
+SpillStack* spill_stack_create(size_t memory_budget, const char* directory) {
+    if (!directory) {
+        directory = getenv("TMPDIR");
+        if (!directory || directory[0] == '\0') {
+            directory = "/tmp";
+        }
+    }
+
+    SpillStack* stack = calloc(1, sizeof(SpillStack));
+    if (!stack) {
+        return NULL;
+    }
+
+    size_t length = strlen(directory) + 1;
+    stack->directory = malloc(length);
+    stack->segment_capacity = 16;
+    stack->segments = calloc(stack->segment_capacity, sizeof(int*));
+    int* bottom = malloc(SEGMENT_BYTES);
+    if (!stack->directory || !stack->segments || !bottom) {
+        free(stack->directory);
+        free(stack->segments);
+        free(bottom);
+        free(stack);
+        return NULL;
+    }
+    memcpy(stack->directory, directory, length);
+
+    if (pthread_mutex_init(&stack->lock, NULL) != 0) {
+        free(stack->directory);
+        free(stack->segments);
+        free(bottom);
+        free(stack);
+        return NULL;
+    }
+    if (pthread_cond_init(&stack->changed, NULL) != 0) {
+        pthread_mutex_destroy(&stack->lock);
+        free(stack->directory);
+        free(stack->segments);
+        free(bottom);
+        free(stack);
+        return NULL;
+    }
+
+    /* The budget also covers the spare and the prefetch buffer */
+    size_t budget_segments = memory_budget / SEGMENT_BYTES;
+    if (budget_segments < SPILL_STACK_MIN_SEGMENTS) {
+        budget_segments = SPILL_STACK_MIN_SEGMENTS;
+    }
+    stack->resident_limit = budget_segments - 2;
+
+    stack->segments[0] = bottom;
+    stack->segment_count = 1;
+    stack->top = bottom;
+    stack->fd = -1;
+    return stack;
+}
+
+void spill_stack_destroy(SpillStack* stack) {
+    if (stack) {
+        if (stack->reader_running) {
+            pthread_mutex_lock(&stack->lock);
+            stack->stopping = true;
+            pthread_cond_broadcast(&stack->changed);
+            pthread_mutex_unlock(&stack->lock);
+            pthread_join(stack->reader, NULL);
+        }
+        if (stack->fd >= 0) {
+            close(stack->fd);
+        }
+
+        for (size_t i = stack->first_resident; i < stack->segment_count; i++) {
+            free(stack->segments[i]);
+        }
+        free(stack->prefetch_buffer);
+        free(stack->spare);
+        free(stack->segments);
+        free(stack->directory);
+        pthread_cond_destroy(&stack->changed);
+        pthread_mutex_destroy(&stack->lock);
+        free(stack);
+    }
+}
+
+StackResult spill_stack_push(SpillStack* stack, int value) {
+    /* Validate input parameters */
+    if (!stack) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (stack->top_count < SPILL_STACK_SEGMENT_VALUES) {
+        stack->top[stack->top_count++] = value;
+        stack->size++;
+        return STACK_SUCCESS;
+    }
+    return push_segment(stack, value);
+}
+
+StackResult spill_stack_pop(SpillStack* stack, int* value) {
+    /* Validate input parameters */
+    if (!stack || !value) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (stack->top_count > 1) {
+        *value = stack->top[--stack->top_count];
+        stack->size--;
+        return STACK_SUCCESS;
+    }
+    return pop_segment(stack, value);
+}
+
+StackResult spill_stack_peek(const SpillStack* stack, int* value) {
+    /* Validate input parameters */
+    if (!stack || !value) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (stack->size == 0) {
+        return STACK_ERROR_UNDERFLOW;
+    }
+
+    *value = stack->top[stack->top_count - 1];
+    return STACK_SUCCESS;
+}
+
+bool spill_stack_is_empty(const SpillStack* stack) {
+    return !stack || stack->size == 0;
+}
+
+size_t spill_stack_size(const SpillStack* stack) {
+    return stack ? stack->size : 0;
+}
+
+void spill_stack_stats(const SpillStack* stack, SpillStackStats* stats) {
+    if (!stats) {
+        return;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    if (!stack) {
+        return;
+    }
+
+    stats->resident_segments = stack->segment_count - stack->first_resident;
+    stats->spilled_segments = stack->first_resident;
+    stats->bytes_written = stack->bytes_written;
+    stats->bytes_read = stack->bytes_read;
+    stats->prefetch_hits = stack->prefetch_hits;
+    stats->prefetch_misses = stack->prefetch_misses;
+}
@@ -0,0 +1,139 @@
+/**
+ * @file stack_scan.c
+ * @brief Read-Only Bulk Operations Implementation
+ * @author Jaden Mardini
+ *
+ * Every operation works on the span returned by stack_data(). With SSE2,
+ * four elements are compared, counted, summed or reordered per
+ * instruction: searches test sixteen elements per iteration and only
+ * look at single elements inside the block that matched, counts subtract
+ * the all-ones comparison masks from a vector of counters, sums widen
+ * each element to 64 bits with its sign so they cannot overflow, and
+ * top-down copies reverse four elements with one shuffle. A scalar loop
+ * handles the remainder and builds without SSE2.
+ */
+
+#include "stack_scan.h"
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* Elements tested per iteration of the vectorized search */
+#define FIND_BLOCK 16
+
+bool stack_find(const Stack* stack, int value, size_t* depth) {
+    const int* data = stack_data(stack);
+    size_t size = stack_size(stack);
+    size_t i = size;
+
+#if defined(__SSE2__)
+    /* Search down from the top, one block at a time */
+    __m128i needle = _mm_set1_epi32(value);
+    while (i >= FIND_BLOCK) {
+        const int* block = data + i - FIND_BLOCK;
+        __m128i a = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(const void*)block), needle);
+        __m128i b = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(const void*)(block + 4)), needle);
+        __m128i c = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(const void*)(block + 8)), needle);
+        __m128i d = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(const void*)(block + 12)), needle);
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))) != 0) {
+            break;      /* The scalar loop below finds the exact position */
+        }
+        i -= FIND_BLOCK;
+    }
+#endif
+
+    while (i > 0) {
+        i--;
+        if (data[i] == value) {
+            if (depth) {
+                *depth = size - 1 - i;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t stack_count(const Stack* stack, int value) {
+    const int* data = stack_data(stack);
+    size_t size = stack_size(stack);
+    size_t count = 0;
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    /* A lane counts at most size / 4 matches, far below INT32_MAX for any valid capacity */
+    __m128i needle = _mm_set1_epi32(value);
+    __m128i counters = _mm_setzero_si128();
+    for (; i + 4 <= size; i += 4) {
+        __m128i matches = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(const void*)(data + i)), needle);
+        counters = _mm_sub_epi32(counters, matches);
+    }
+    int lanes[4];
+    _mm_storeu_si128((__m128i*)(void*)lanes, counters);
+    count = (size_t)lanes[0] + (size_t)lanes[1] + (size_t)lanes[2] + (size_t)lanes[3];
+#endif
+
+    for (; i < size; i++) {
+        count += data[i] == value;
+    }
+    return count;
+}
+
+int64_t stack_sum(const Stack* stack) {
+    const int* data = stack_data(stack);
+    size_t size = stack_size(stack);
+    int64_t sum = 0;
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    /* Interleaving each element with its sign word widens it to 64 bits */
+    __m128i low_sums = _mm_setzero_si128();
+    __m128i high_sums = _mm_setzero_si128();
+    for (; i + 4 <= size; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(const void*)(data + i));
+        __m128i sign = _mm_srai_epi32(v, 31);
+        low_sums = _mm_add_epi64(low_sums, _mm_unpacklo_epi32(v, sign));
+        high_sums = _mm_add_epi64(high_sums, _mm_unpackhi_epi32(v, sign));
+    }
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i*)(void*)lanes, _mm_add_epi64(low_sums, high_sums));
+    sum = lanes[0] + lanes[1];
+#endif
+
+    for (; i < size; i++) {
+        sum += data[i];
+    }
+    return sum;
+}
+
+size_t stack_copy_out(const Stack* stack, int* output, size_t max_count, StackOrder order) {
+    if (!output) {
+        return 0;
+    }
+
+    const int* data = stack_data(stack);
+    size_t size = stack_size(stack);
+    size_t count = size < max_count ? size : max_count;
+
+    if (order == STACK_ORDER_BOTTOM_UP) {
+        if (count > 0) {
+            memcpy(output, data, count * sizeof(int));
+        }
+        return count;
+    }
+
+    /* Top down: output[j] is the element at depth j */
+    size_t j = 0;
+#if defined(__SSE2__)
+    for (; j + 4 <= count; j += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(const void*)(data + size - j - 4));
+        _mm_storeu_si128((__m128i*)(void*)(output + j), _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3)));
+    }
+#endif
+    for (; j < count; j++) {
+        output[j] = data[size - 1 - j];
+    }
+    return count;
+}
@@ -0,0 +1,819 @@
+/**
+ * @file stack_vm.c
+ * @brief Bytecode Stack Virtual Machine Implementation
+ * @author Jaden Mardini
+ *
+ * Bytecode is one opcode byte followed by its operand bytes, if any:
+ * PUSH_BYTE takes a signed byte, PUSH a native-endian int and LOAD an
+ * input index. The compiler tracks the operand stack depth of every
+ * instruction, so a compiled program can never underflow or exceed its
+ * recorded maximum depth and the interpreter needs no per-instruction
+ * bounds checks. Operations on two pushed constants are folded into one
+ * push as they are emitted.
+ *
+ * The interpreter keeps the top of the operand stack in a local variable
+ * and the rest in an array on the C stack. With GCC-compatible compilers
+ * each instruction ends by jumping straight to the next one's handler
+ * through a label table (threaded code), which gives every handler its own
+ * indirect branch for the predictor; elsewhere, or when built with
+ * -DSTACK_VM_SWITCH_DISPATCH, a switch loop is used.
+ */
+
+#include "stack_vm.h"
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) && !defined(STACK_VM_SWITCH_DISPATCH)
+#define STACK_VM_THREADED 1
+#else
+#define STACK_VM_THREADED 0
+#endif
+
+/* Initial bytecode buffer size */
+#define INITIAL_CODE_CAPACITY 64
+
+/* Instruction set */
+typedef enum {
+    OP_HALT = 0,
+    OP_PUSH_BYTE,   /* Operand: int8_t */
+    OP_PUSH,        /* Operand: int */
+    OP_LOAD,        /* Operand: uint8_t input index */
+    OP_ADD,
+    OP_SUB,
+    OP_MUL,
+    OP_DIV,
+    OP_MOD,
+    OP_MIN,
+    OP_MAX,
+    OP_NEG,
+    OP_DUP,
+    OP_SWAP,
+    OP_DROP,
+    OP_COUNT
+} Opcode;
+
+/* Program structure definition (opaque to users) */
+struct StackVmProgram {
+    size_t input_count;         /* Highest $N read plus one */
+    size_t max_depth;           /* Deepest operand stack reached */
+    size_t final_depth;         /* Values left when the program halts */
+    size_t instruction_count;   /* Instructions before OP_HALT */
+    size_t code_size;           /* Bytes of code including OP_HALT */
+    uint8_t code[];
+};
+
+/* Bytecode under construction */
+typedef struct {
+    uint8_t* code;
+    size_t length;
+    size_t capacity;
+    size_t depth;
+    size_t max_depth;
+    size_t input_count;
+    size_t instruction_count;
+    size_t constant_count;      /* Trailing push instructions available for folding (at most 2) */
+    size_t constant_offsets[2]; /* Code offsets of those pushes, oldest first */
+    int constants[2];
+    StackVmResult error;
+} Emitter;
+
+/* Operator stack markers for infix compilation; opcodes are the other entries */
+#define MARK_PAREN (-1)
+
+/* Static function prototypes */
+static void emit_bytes(Emitter* emitter, const void* bytes, size_t count);
+static void adjust_depth(Emitter* emitter, size_t pops, size_t pushes);
+static void emit_constant(Emitter* emitter, int value);
+static void emit_load(Emitter* emitter, size_t index);
+static void emit_operation(Emitter* emitter, Opcode opcode);
+static bool fold(Opcode opcode, int a, int b, int* result);
+static bool parse_integer(const char* source, size_t end, size_t* position, int* value);
+static bool parse_input(const char* source, size_t end, size_t* position, size_t* index);
+static bool is_space(char c);
+static int precedence(int opcode);
+static bool push_operator(Stack* operators, int opcode);
+static StackVmResult compile_rpn(Emitter* emitter, const char* source, size_t length, size_t* error_offset);
+static StackVmResult compile_infix(Emitter* emitter, const char* source, size_t length, size_t* error_offset);
+static StackVmResult execute(const StackVmProgram* program, const int* inputs, int* operands, int* top_value);
+
+/**
+ * @brief Appends raw bytes to the code buffer, growing it as needed
+ */
+static void emit_bytes(Emitter* emitter, const void* bytes, size_t count) {
+    if (emitter->error != STACK_VM_SUCCESS) {
+        return;
+    }
+
+    if (emitter->length + count > emitter->capacity) {
+        size_t capacity = emitter->capacity ? emitter->capacity * 2 : INITIAL_CODE_CAPACITY;
+        uint8_t* code = realloc(emitter->code, capacity);
+        if (!code) {
+            emitter->error = STACK_VM_ERROR_MEMORY_ALLOCATION;
+            return;
+        }
+        emitter->code = code;
+        emitter->capacity = capacity;
+    }
+
+    memcpy(emitter->code + emitter->length, bytes, count);
+    emitter->length += count;
+}
+
+/**
+ * @brief Records a depth change, failing if the program gets too deep
+ */
+static void adjust_depth(Emitter* emitter, size_t pops, size_t pushes) {
+    if (emitter->depth < pops) {
+        emitter->error = STACK_VM_ERROR_UNDERFLOW;
+        return;
+    }
+
+    emitter->depth = emitter->depth - pops + pushes;
+    if (emitter->depth > STACK_VM_MAX_DEPTH) {
+        emitter->error = STACK_VM_ERROR_TOO_DEEP;
+    } else if (emitter->depth > emitter->max_depth) {
+        emitter->max_depth = emitter->depth;
+    }
+}
+
+/**
+ * @brief Emits the shortest push of a constant and remembers it for folding
+ */
+static void emit_constant(Emitter* emitter, int value) {
+    size_t offset = emitter->length;
+
+    if (value >= INT8_MIN && value <= INT8_MAX) {
+        uint8_t bytes[2] = { OP_PUSH_BYTE, (uint8_t)(int8_t)value };
+        emit_bytes(emitter, bytes, sizeof(bytes));
+    } else {
+        uint8_t bytes[1 + sizeof(int)] = { OP_PUSH };
+        memcpy(bytes + 1, &value, sizeof(int));
+        emit_bytes(emitter, bytes, sizeof(bytes));
+    }
+    adjust_depth(emitter, 0, 1);
+    emitter->instruction_count++;
+
+    if (emitter->constant_count == 2) {
+        emitter->constant_offsets[0] = emitter->constant_offsets[1];
+        emitter->constants[0] = emitter->constants[1];
+        emitter->constant_count = 1;
+    }
+    emitter->constant_offsets[emitter->constant_count] = offset;
+    emitter->constants[emitter->constant_count] = value;
+    emitter->constant_count++;
+}
+
+/**
+ * @brief Emits a read of input $index
+ */
+static void emit_load(Emitter* emitter, size_t index) {
+    uint8_t bytes[2] = { OP_LOAD, (uint8_t)index };
+    emit_bytes(emitter, bytes, sizeof(bytes));
+    adjust_depth(emitter, 0, 1);
+    emitter->instruction_count++;
+    emitter->constant_count = 0;
+
+    if (index + 1 > emitter->input_count) {
+        emitter->input_count = index + 1;
+    }
+}
+
+/**
+ * @brief Emits an operand-free instruction, folding it into a push when its operands are constants
+ */
+static void emit_operation(Emitter* emitter, Opcode opcode) {
+    size_t pops = 2;
+    size_t pushes = 1;
+    switch (opcode) {
+        case OP_NEG:
+            pops = 1;
+            break;
+        case OP_DUP:
+            pops = 1;
+            pushes = 2;
+            break;
+        case OP_SWAP:
+            pushes = 2;
+            break;
+        case OP_DROP:
+            pops = 1;
+            pushes = 0;
+            break;
+        default:
+            break;
+    }
+
+    bool foldable = opcode != OP_DUP && opcode != OP_SWAP && opcode != OP_DROP;
+    if (foldable && emitter->constant_count >= pops && emitter->error == STACK_VM_SUCCESS) {
+        size_t first = emitter->constant_count - pops;
+        int a = emitter->constants[first];
+        int b = pops == 2 ? emitter->constants[first + 1] : 0;
+        int result;
+        if (fold(opcode, a, b, &result)) {
+            /* Rewind over the constant pushes and push the result instead */
+            emitter->length = emitter->constant_offsets[first];
+            emitter->depth -= pops;
+            emitter->instruction_count -= pops;
+            emitter->constant_count = first;
+            emit_constant(emitter, result);
+            return;
+        }
+    }
+
+    uint8_t byte = (uint8_t)opcode;
+    emit_bytes(emitter, &byte, 1);
+    adjust_depth(emitter, pops, pushes);
+    emitter->instruction_count++;
+    emitter->constant_count = 0;
+}
+
+/**
+ * @brief Computes a binary or unary operation with the VM's semantics
+ * @return false for division or remainder by zero
+ */
+static bool fold(Opcode opcode, int a, int b, int* result) {
+    switch (opcode) {
+        case OP_ADD:
+            *result = (int)((unsigned)a + (unsigned)b);
+            return true;
+        case OP_SUB:
+            *result = (int)((unsigned)a - (unsigned)b);
+            return true;
+        case OP_MUL:
+            *result = (int)((unsigned)a * (unsigned)b);
+            return true;
+        case OP_DIV:
+            if (b == 0) {
+                return false;
+            }
+            *result = (a == INT_MIN && b == -1) ? INT_MIN : a / b;
+            return true;
+        case OP_MOD:
+            if (b == 0) {
+                return false;
+            }
+            *result = (a == INT_MIN && b == -1) ? 0 : a % b;
+            return true;
+        case OP_MIN:
+            *result = a < b ? a : b;
+            return true;
+        case OP_MAX:
+            *result = a > b ? a : b;
+            return true;
+        case OP_NEG:
+            *result = (int)(0u - (unsigned)a);
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Parses an optionally signed decimal integer that fits in an int
+ */
+static bool parse_integer(const char* source, size_t end, size_t* position, int* value) {
+    size_t i = *position;
+    bool negative = false;
+    if (i < end && (source[i] == '-' || source[i] == '+')) {
+        negative = source[i] == '-';
+        i++;
+    }
+    if (i >= end || source[i] < '0' || source[i] > '9') {
+        return false;
+    }
+
+    long long magnitude = 0;
+    while (i < end && source[i] >= '0' && source[i] <= '9') {
+        magnitude = magnitude * 10 + (source[i] - '0');
+        if (magnitude > (long long)INT_MAX + 1) {
+            return false;
+        }
+        i++;
+    }
+    if (!negative && magnitude > INT_MAX) {
+        return false;
+    }
+
+    *value = (int)(negative ? -magnitude : magnitude);
+    *position = i;
+    return true;
+}
+
+/**
+ * @brief Parses an input reference $N
+ */
+static bool parse_input(const char* source, size_t end, size_t* position, size_t* index) {
+    size_t i = *position + 1;
+    if (i >= end || source[i] < '0' || source[i] > '9') {
+        return false;
+    }
+
+    size_t number = 0;
+    while (i < end && source[i] >= '0' && source[i] <= '9') {
+        number = number * 10 + (size_t)(source[i] - '0');
+        if (number >= STACK_VM_MAX_INPUTS) {
+            return false;
+        }
+        i++;
+    }
+
+    *index = number;
+    *position = i;
+    return true;
+}
+
+/**
+ * @brief Tests for the whitespace that separates tokens
+ */
+static inline bool is_space(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+/**
+ * @brief Compiles whitespace-separated RPN tokens
+ */
+static StackVmResult compile_rpn(Emitter* emitter, const char* source, size_t length, size_t* error_offset) {
+    static const struct {
+        const char* name;
+        Opcode opcode;
+    } words[] = {
+        { "+", OP_ADD }, { "-", OP_SUB }, { "*", OP_MUL }, { "/", OP_DIV }, { "%", OP_MOD },
+        { "min", OP_MIN }, { "max", OP_MAX }, { "neg", OP_NEG },
+        { "dup", OP_DUP }, { "swap", OP_SWAP }, { "drop", OP_DROP }
+    };
+
+    size_t i = 0;
+    while (i < length) {
+        if (is_space(source[i])) {
+            i++;
+            continue;
+        }
+
+        size_t start = i;
+        size_t end = i;
+        while (end < length && !is_space(source[end])) {
+            end++;
+        }
+
+        int value;
+        size_t index;
+        size_t position = start;
+        if (source[start] == '$') {
+            if (!parse_input(source, end, &position, &index) || position != end) {
+                *error_offset = start;
+                return STACK_VM_ERROR_SYNTAX;
+            }
+            emit_load(emitter, index);
+        } else if (parse_integer(source, end, &position, &value) && position == end) {
+            emit_constant(emitter, value);
+        } else {
+            size_t w = 0;
+            while (w < sizeof(words) / sizeof(words[0]) &&
+                   (strlen(words[w].name) != end - start ||
+                    memcmp(words[w].name, source + start, end - start) != 0)) {
+                w++;
+            }
+            if (w == sizeof(words) / sizeof(words[0])) {
+                *error_offset = start;
+                return STACK_VM_ERROR_SYNTAX;
+            }
+            emit_operation(emitter, words[w].opcode);
+        }
+
+        if (emitter->error != STACK_VM_SUCCESS) {
+            *error_offset = start;
+            return emitter->error;
+        }
+        i = end;
+    }
+
+    return STACK_VM_SUCCESS;
+}
+
+/**
+ * @brief Binding strength of an infix operator on the operator stack
+ */
+static int precedence(int opcode) {
+    switch (opcode) {
+        case OP_NEG:
+            return 3;
+        case OP_MUL:
+        case OP_DIV:
+        case OP_MOD:
+            return 2;
+        case OP_ADD:
+        case OP_SUB:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Pushes onto the operator stack, growing it when full
+ */
+static bool push_operator(Stack* operators, int opcode) {
+    StackResult result = stack_push(operators, opcode);
+    if (result == STACK_ERROR_OVERFLOW) {
+        size_t capacity = stack_capacity(operators);
+        if (capacity >= STACK_MAX_CAPACITY ||
+            stack_reserve(operators, capacity * 2 < STACK_MAX_CAPACITY ? capacity * 2 : STACK_MAX_CAPACITY) != STACK_SUCCESS) {
+            return false;
+        }
+        result = stack_push(operators, opcode);
+    }
+    return result == STACK_SUCCESS;
+}
+
+/**
+ * @brief Compiles an infix expression with the shunting-yard algorithm
+ *
+ * Operators wait on a dynamic Stack until an operator that binds no more
+ * tightly, a closing parenthesis or the end of input emits them.
+ */
+static StackVmResult compile_infix(Emitter* emitter, const char* source, size_t length, size_t* error_offset) {
+    Stack* operators = stack_create(STACK_DEFAULT_CAPACITY);
+    if (!operators) {
+        return STACK_VM_ERROR_MEMORY_ALLOCATION;
+    }
+    stack_set_wipe_policy(operators, STACK_WIPE_NEVER);
+
+    StackVmResult result = STACK_VM_SUCCESS;
+    bool expect_operand = true;
+    size_t i = 0;
+    int top;
+
+    while (i < length && result == STACK_VM_SUCCESS) {
+        char c = source[i];
+        size_t start = i;
+
+        if (is_space(c)) {
+            i++;
+            continue;
+        }
+
+        if (expect_operand) {
+            size_t index;
+            if (c >= '0' && c <= '9') {
+                int value;
+                if (!parse_integer(source, length, &i, &value)) {
+                    result = STACK_VM_ERROR_SYNTAX;
+                } else {
+                    emit_constant(emitter, value);
+                    expect_operand = false;
+                }
+            } else if (c == '$') {
+                if (!parse_input(source, length, &i, &index)) {
+                    result = STACK_VM_ERROR_SYNTAX;
+                } else {
+                    emit_load(emitter, index);
+                    expect_operand = false;
+                }
+            } else if (c == '(' || c == '-' || c == '+') {
+                /* Unary plus is a no-op; unary minus is a prefix operator */
+                if (c != '+' && !push_operator(operators, c == '(' ? MARK_PAREN : OP_NEG)) {
+                    result = STACK_VM_ERROR_TOO_DEEP;
+                }
+                i++;
+            } else {
+                result = STACK_VM_ERROR_SYNTAX;
+            }
+        } else if (c == ')') {
+            top = 0;
+            while (stack_pop(operators, &top) == STACK_SUCCESS && top != MARK_PAREN) {
+                emit_operation(emitter, (Opcode)top);
+            }
+            if (top != MARK_PAREN) {
+                result = STACK_VM_ERROR_SYNTAX;    /* No matching '(' */
+            }
+            i++;
+        } else {
+            Opcode opcode;
+            switch (c) {
+                case '+': opcode = OP_ADD; break;
+                case '-': opcode = OP_SUB; break;
+                case '*': opcode = OP_MUL; break;
+                case '/': opcode = OP_DIV; break;
+                case '%': opcode = OP_MOD; break;
+                default: opcode = OP_HALT; break;
+            }
+            if (opcode == OP_HALT) {
+                result = STACK_VM_ERROR_SYNTAX;
+            } else {
+                /* All binary operators are left-associative */
+                while (stack_peek(operators, &top) == STACK_SUCCESS &&
+                       precedence(top) >= precedence(opcode)) {
+                    stack_pop(operators, &top);
+                    emit_operation(emitter, (Opcode)top);
+                }
+                if (!push_operator(operators, opcode)) {
+                    result = STACK_VM_ERROR_TOO_DEEP;
+                }
+                expect_operand = true;
+                i++;
+            }
+        }
+
+        if (result == STACK_VM_SUCCESS && emitter->error != STACK_VM_SUCCESS) {
+            result = emitter->error;
+        }
+        if (result != STACK_VM_SUCCESS) {
+            *error_offset = start;
+        }
+    }
+
+    if (result == STACK_VM_SUCCESS) {
+        if (expect_operand) {
+            result = STACK_VM_ERROR_SYNTAX;    /* Empty input or trailing operator */
+            *error_offset = length;
+        }
+        while (result == STACK_VM_SUCCESS && stack_pop(operators, &top) == STACK_SUCCESS) {
+            if (top == MARK_PAREN) {
+                result = STACK_VM_ERROR_SYNTAX;    /* Unclosed '(' */
+                *error_offset = length;
+            } else {
+                emit_operation(emitter, (Opcode)top);
+                result = emitter->error;
+            }
+        }
+    }
+
+    stack_destroy(operators);
+    return result;
+}
+
+StackVmResult stack_vm_compile(const char* source, size_t length, StackVmSyntax syntax,
+                               StackVmProgram** program, size_t* error_offset) {
+    /* Validate input parameters */
+    if (!source || !program) {
+        return STACK_VM_ERROR_NULL_POINTER;
+    }
+
+    size_t offset = 0;
+    Emitter emitter;
+    memset(&emitter, 0, sizeof(emitter));
+
+    StackVmResult result;
+    if (syntax == STACK_VM_SYNTAX_INFIX) {
+        result = compile_infix(&emitter, source, length, &offset);
+    } else {
+        result = compile_rpn(&emitter, source, length, &offset);
+    }
+
+    if (result == STACK_VM_SUCCESS && emitter.depth == 0) {
+        result = STACK_VM_ERROR_SYNTAX;    /* Nothing to return */
+        offset = length;
+    }
+    uint8_t halt = OP_HALT;
+    emit_bytes(&emitter, &halt, 1);
+    if (result == STACK_VM_SUCCESS) {
+        result = emitter.error;
+    }
+
+    StackVmProgram* compiled = NULL;
+    if (result == STACK_VM_SUCCESS) {
+        compiled = malloc(sizeof(StackVmProgram) + emitter.length);
+        if (!compiled) {
+            result = STACK_VM_ERROR_MEMORY_ALLOCATION;
+        }
+    }
+
+    if (result == STACK_VM_SUCCESS) {
+        compiled->input_count = emitter.input_count;
+        compiled->max_depth = emitter.max_depth;
+        compiled->final_depth = emitter.depth;
+        compiled->instruction_count = emitter.instruction_count;
+        compiled->code_size = emitter.length;
+        memcpy(compiled->code, emitter.code, emitter.length);
+        *program = compiled;
+    } else if (error_offset) {
+        *error_offset = offset;
+    }
+
+    free(emitter.code);
+    return result;
+}
+
+void stack_vm_destroy(StackVmProgram* program) {
+    free(program);
+}
+
+#if STACK_VM_THREADED
+/* Label addresses and computed goto are GNU extensions */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#define VM_DISPATCH() goto *dispatch[*ip++]
+#define VM_CASE(opcode) label_##opcode:
+#else
+#define VM_DISPATCH() continue
+#define VM_CASE(opcode) case opcode:
+#endif
+
+/**
+ * @brief Runs a program over one input vector
+ * @param operands Scratch array of at least max_depth + 1 ints; receives the
+ *                 values below the top, starting at operands[1]
+ * @param top_value Receives the top of the operand stack
+ */
+static StackVmResult execute(const StackVmProgram* program, const int* inputs, int* operands, int* top_value) {
+    const uint8_t* ip = program->code;
+    int* sp = operands;     /* Slot for the next value pushed under top */
+    int top = 0;            /* Cached top of stack; operands[0] receives this placeholder */
+    int a;
+
+#if STACK_VM_THREADED
+    static const void* const dispatch[OP_COUNT] = {
+        &&label_OP_HALT, &&label_OP_PUSH_BYTE, &&label_OP_PUSH, &&label_OP_LOAD,
+        &&label_OP_ADD, &&label_OP_SUB, &&label_OP_MUL, &&label_OP_DIV, &&label_OP_MOD,
+        &&label_OP_MIN, &&label_OP_MAX, &&label_OP_NEG,
+        &&label_OP_DUP, &&label_OP_SWAP, &&label_OP_DROP
+    };
+    VM_DISPATCH();
+#else
+    for (;;) {
+        switch ((Opcode)*ip++) {
+#endif
+
+    VM_CASE(OP_PUSH_BYTE)
+        *sp++ = top;
+        top = (int8_t)*ip++;
+        VM_DISPATCH();
+
+    VM_CASE(OP_PUSH)
+        *sp++ = top;
+        memcpy(&top, ip, sizeof(int));
+        ip += sizeof(int);
+        VM_DISPATCH();
+
+    VM_CASE(OP_LOAD)
+        *sp++ = top;
+        top = inputs[*ip++];
+        VM_DISPATCH();
+
+    VM_CASE(OP_ADD)
+        top = (int)((unsigned)*--sp + (unsigned)top);
+        VM_DISPATCH();
+
+    VM_CASE(OP_SUB)
+        top = (int)((unsigned)*--sp - (unsigned)top);
+        VM_DISPATCH();
+
+    VM_CASE(OP_MUL)
+        top = (int)((unsigned)*--sp * (unsigned)top);
+        VM_DISPATCH();
+
+    VM_CASE(OP_DIV)
+        a = *--sp;
+        if (top == 0) {
+            return STACK_VM_ERROR_DIVISION_BY_ZERO;
+        }
+        top = (a == INT_MIN && top == -1) ? INT_MIN : a / top;
+        VM_DISPATCH();
+
+    VM_CASE(OP_MOD)
+        a = *--sp;
+        if (top == 0) {
+            return STACK_VM_ERROR_DIVISION_BY_ZERO;
+        }
+        top = (a == INT_MIN && top == -1) ? 0 : a % top;
+        VM_DISPATCH();
+
+    VM_CASE(OP_MIN)
+        a = *--sp;
+        top = a < top ? a : top;
+        VM_DISPATCH();
+
+    VM_CASE(OP_MAX)
+        a = *--sp;
+        top = a > top ? a : top;
+        VM_DISPATCH();
+
+    VM_CASE(OP_NEG)
+        top = (int)(0u - (unsigned)top);
+        VM_DISPATCH();
+
+    VM_CASE(OP_DUP)
+        *sp++ = top;
+        VM_DISPATCH();
+
+    VM_CASE(OP_SWAP)
+        a = sp[-1];
+        sp[-1] = top;
+        top = a;
+        VM_DISPATCH();
+
+    VM_CASE(OP_DROP)
+        top = *--sp;
+        VM_DISPATCH();
+
+    VM_CASE(OP_HALT)
+        *top_value = top;
+        return STACK_VM_SUCCESS;
+
+#if !STACK_VM_THREADED
+            default:
+                return STACK_VM_ERROR_SYNTAX;  /* Unreachable for compiled programs */
+        }
+    }
+#endif
+}
+
+#if STACK_VM_THREADED
+#pragma GCC diagnostic pop
+#endif
+#undef VM_DISPATCH
+#undef VM_CASE
+
+StackVmResult stack_vm_run(const StackVmProgram* program, const int* inputs, size_t input_count,
+                           Stack* stack) {
+    /* Validate input parameters */
+    if (!program || !stack || (program->input_count > 0 && !inputs)) {
+        return STACK_VM_ERROR_NULL_POINTER;
+    }
+
+    if (input_count < program->input_count) {
+        return STACK_VM_ERROR_MISSING_INPUT;
+    }
+
+    if (stack_capacity(stack) - stack_size(stack) < program->final_depth) {
+        return STACK_VM_ERROR_STACK_FULL;
+    }
+
+    int operands[STACK_VM_MAX_DEPTH + 1];
+    int top;
+    StackVmResult result = execute(program, inputs, operands, &top);
+    if (result != STACK_VM_SUCCESS) {
+        return result;
+    }
+
+    for (size_t i = 1; i < program->final_depth; i++) {
+        stack_push(stack, operands[i]);
+    }
+    stack_push(stack, top);
+    return STACK_VM_SUCCESS;
+}
+
+StackVmResult stack_vm_run_batch(const StackVmProgram* program, const int* inputs, size_t input_stride,
+                                 size_t vector_count, int* results, size_t* failed_index) {
+    /* Validate input parameters */
+    if (!program || (vector_count > 0 && (!results || (program->input_count > 0 && !inputs)))) {
+        return STACK_VM_ERROR_NULL_POINTER;
+    }
+
+    if (input_stride < program->input_count) {
+        return STACK_VM_ERROR_MISSING_INPUT;
+    }
+
+    int operands[STACK_VM_MAX_DEPTH + 1];
+    for (size_t i = 0; i < vector_count; i++) {
+        StackVmResult result = execute(program, inputs ? inputs + i * input_stride : NULL,
+                                       operands, &results[i]);
+        if (result != STACK_VM_SUCCESS) {
+            if (failed_index) {
+                *failed_index = i;
+            }
+            return result;
+        }
+    }
+
+    return STACK_VM_SUCCESS;
+}
+
+size_t stack_vm_input_count(const StackVmProgram* program) {
+    return program ? program->input_count : 0;
+}
+
+size_t stack_vm_instruction_count(const StackVmProgram* program) {
+    return program ? program->instruction_count : 0;
+}
+
+size_t stack_vm_code_size(const StackVmProgram* program) {
+    return program ? program->code_size : 0;
+}
+
+const char* stack_vm_error_string(StackVmResult result) {
+    switch (result) {
+        case STACK_VM_SUCCESS:
+            return "Success";
+        case STACK_VM_ERROR_NULL_POINTER:
+            return "Null pointer provided";
+        case STACK_VM_ERROR_MEMORY_ALLOCATION:
+            return "Memory allocation failed";
+        case STACK_VM_ERROR_SYNTAX:
+            return "Syntax error";
+        case STACK_VM_ERROR_UNDERFLOW:
+            return "Operator has too few operands";
+        case STACK_VM_ERROR_TOO_DEEP:
+            return "Expression needs too deep an operand stack";
+        case STACK_VM_ERROR_MISSING_INPUT:
+            return "Program reads more inputs than provided";
+        case STACK_VM_ERROR_DIVISION_BY_ZERO:
+            return "Division by zero";
+        case STACK_VM_ERROR_STACK_FULL:
+            return "Not enough room on the stack for the results";
+        default:
+            return "Unknown error";
+    }
+}
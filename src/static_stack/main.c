@@ -12,11 +12,16 @@
 #include <string.h>
 #include <ctype.h>
 #include "static_stack.h"
+#include "word_reverse.h"
+#include "reverse_transform.h"
+#include "reversed_view.h"
+#include "reversal_server.h"
 
 /* Constants */
 #define INPUT_BUFFER_SIZE 512
 #define OUTPUT_BUFFER_SIZE 512
 #define MAX_LINE_LENGTH 80
+#define WORD_MODE_INITIAL_BUFFER 4096
 
 /**
  * @brief Safely reads a line of input from the user
@@ -201,10 +206,211 @@ static void run_test_cases(void) {
     }
 }
 
+/**
+ * @brief Reads one line of any length from a stream
+ * @param stream Stream to read from
+ * @param buffer In/out heap buffer, grown as needed
+ * @param buffer_size In/out size of buffer
+ * @param length Receives the line length without its newline
+ * @return true if a line was read, false at end of input or on allocation failure
+ */
+static bool read_long_line(FILE* stream, char** buffer, size_t* buffer_size, size_t* length) {
+    size_t used = 0;
+    
+    while (fgets(*buffer + used, (int)(*buffer_size - used), stream)) {
+        used += strlen(*buffer + used);
+        if (used > 0 && (*buffer)[used - 1] == '\n') {
+            *length = used - 1;
+            return true;
+        }
+        if (used + 1 < *buffer_size) {
+            break;  /* Final line without a newline */
+        }
+        
+        char* grown = realloc(*buffer, *buffer_size * 2);
+        if (!grown) {
+            return false;
+        }
+        *buffer = grown;
+        *buffer_size *= 2;
+    }
+    
+    *length = used;
+    return used > 0;
+}
+
+/**
+ * @brief Reversal of standard input, one line at a time
+ * @param options Word reversal options, or NULL to reverse characters
+ * @param transform Transform fused into character reversal
+ * @return Process exit status
+ */
+static int run_line_mode(const WordReverseOptions* options, const ReverseTransform* transform) {
+    size_t input_size = WORD_MODE_INITIAL_BUFFER;
+    size_t output_size = WORD_MODE_INITIAL_BUFFER;
+    char* input = malloc(input_size);
+    char* output = malloc(output_size);
+    int status = EXIT_SUCCESS;
+    size_t length;
+    
+    if (!input || !output) {
+        free(input);
+        free(output);
+        fprintf(stderr, "Error: %s\n", "Memory allocation failed");
+        return EXIT_FAILURE;
+    }
+    
+    while (read_long_line(stdin, &input, &input_size, &length)) {
+        /* The result never exceeds the input */
+        if (output_size <= length) {
+            char* grown = realloc(output, input_size);
+            if (!grown) {
+                status = EXIT_FAILURE;
+                break;
+            }
+            output = grown;
+            output_size = input_size;
+        }
+        
+        /* Plain reversal streams out of a view without building the result */
+        if (!options && transform->kind == REVERSE_TRANSFORM_NONE) {
+            ReversedViewIterator iterator;
+            reversed_view_iterator_init(&iterator, reversed_view_make(input, length));
+            const char* block;
+            size_t block_length;
+            while ((block_length = reversed_view_next_block(&iterator, &block)) > 0) {
+                fwrite(block, 1, block_length, stdout);
+            }
+            fputc('\n', stdout);
+            continue;
+        }
+        
+        size_t output_length;
+        const char* error = NULL;
+        if (options) {
+            WordReverseResult result = word_reverse(input, length, output, output_size, options, &output_length);
+            error = result != WORD_REVERSE_SUCCESS ? word_reverse_error_string(result) : NULL;
+        } else {
+            ReverseTransformResult result = reverse_transform(input, length, output, output_size,
+                                                              transform, &output_length);
+            error = result != REVERSE_TRANSFORM_SUCCESS ? reverse_transform_error_string(result) : NULL;
+        }
+        if (error) {
+            fprintf(stderr, "Error: %s\n", error);
+            status = EXIT_FAILURE;
+            break;
+        }
+        
+        fwrite(output, 1, output_length, stdout);
+        fputc('\n', stdout);
+    }
+    
+    free(input);
+    free(output);
+    return status;
+}
+
+/**
+ * @brief Serves reversal requests on a Unix domain socket until interrupted
+ * @param socket_path Path of the listening socket
+ * @param thread_count Worker threads, or 0 for one per CPU
+ * @return EXIT_SUCCESS after SIGINT or SIGTERM, EXIT_FAILURE if the server could not start
+ */
+static int run_serve_mode(const char* socket_path, size_t thread_count) {
+    ReversalServerOptions options;
+    reversal_server_options_init(&options);
+    options.socket_path = socket_path;
+    options.thread_count = thread_count;
+    
+    fprintf(stderr, "Serving reversal requests on %s (Ctrl+C to stop)\n", socket_path);
+    ReversalServerResult result = reversal_server_serve(&options);
+    if (result != REVERSAL_SERVER_SUCCESS) {
+        fprintf(stderr, "Error: %s\n", reversal_server_error_string(result));
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Prints command-line usage
+ * @param program Program name
+ */
+static void print_usage(const char* program) {
+    printf("Usage: %s [--words [--collapse] [--delimiters=CHARS]]\n", program);
+    printf("       %s --lines [--upper | --lower | --printable | --replace=C]\n", program);
+    printf("       %s --serve=PATH [--threads=N]\n", program);
+    printf("  (no options)        Interactive character reversal demo\n");
+    printf("  --words             Reverse word order of each line on standard input\n");
+    printf("  --collapse          Join words with a single delimiter\n");
+    printf("  --delimiters=CHARS  Word delimiters (default: whitespace)\n");
+    printf("  --lines             Reverse the characters of each line on standard input\n");
+    printf("  --upper, --lower    Change letter case while reversing\n");
+    printf("  --printable         Drop non-printable characters while reversing\n");
+    printf("  --replace=C         Replace non-printable characters with C while reversing\n");
+    printf("  --serve=PATH        Serve length-prefixed reversal requests on a Unix socket\n");
+    printf("  --threads=N         Server worker threads (default: one per CPU)\n");
+}
+
 /**
  * @brief Main program entry point
  */
-int main(void) {
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        WordReverseOptions options = { NULL, false };
+        ReverseTransform transform = { REVERSE_TRANSFORM_NONE, '?', NULL };
+        bool words = false;
+        bool lines = false;
+        bool word_options = false;
+        const char* serve_path = NULL;
+        size_t thread_count = 0;
+        
+        for (int i = 1; i < argc; i++) {
+            if (strcmp(argv[i], "--words") == 0) {
+                words = true;
+            } else if (strcmp(argv[i], "--lines") == 0) {
+                lines = true;
+            } else if (strcmp(argv[i], "--upper") == 0) {
+                transform.kind = REVERSE_TRANSFORM_UPPER;
+            } else if (strcmp(argv[i], "--lower") == 0) {
+                transform.kind = REVERSE_TRANSFORM_LOWER;
+            } else if (strcmp(argv[i], "--printable") == 0) {
+                transform.kind = REVERSE_TRANSFORM_FILTER;
+            } else if (strncmp(argv[i], "--replace=", 10) == 0 && strlen(argv[i]) == 11) {
+                transform.kind = REVERSE_TRANSFORM_REPLACE;
+                transform.replacement = argv[i][10];
+            } else if (strcmp(argv[i], "--collapse") == 0) {
+                options.collapse = true;
+                word_options = true;
+            } else if (strncmp(argv[i], "--delimiters=", 13) == 0) {
+                options.delimiters = argv[i] + 13;
+                word_options = true;
+            } else if (strncmp(argv[i], "--serve=", 8) == 0 && argv[i][8] != '\0') {
+                serve_path = argv[i] + 8;
+            } else if (strncmp(argv[i], "--threads=", 10) == 0 && atoi(argv[i] + 10) > 0) {
+                thread_count = (size_t)atoi(argv[i] + 10);
+            } else {
+                print_usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+        }
+        
+        /* Options that do not apply to the chosen mode are errors, not ignored */
+        bool transformed = transform.kind != REVERSE_TRANSFORM_NONE;
+        if (serve_path) {
+            if (words || lines || word_options || transformed) {
+                print_usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+            return run_serve_mode(serve_path, thread_count);
+        }
+        
+        if (words == lines || (words && transformed) || (lines && word_options) || thread_count > 0) {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        return run_line_mode(words ? &options : NULL, &transform);
+    }
+    
     printf("=== String Reversal Using Character Stack ===\n");
     printf("Author: Jaden Mardini\n");
     printf("A professional C implementation demonstrating stack-based string reversal\n");
@@ -8,9 +8,14 @@
  */
 
 #include "static_stack.h"
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 
+/* Smallest heap buffer a sized stack spills to */
+#define SPILL_MIN_CAPACITY 64
+
 /* Static stack structure */
 typedef struct {
     char elements[CHAR_STACK_MAX_SIZE];  /* Array to store characters */
@@ -24,6 +29,7 @@ static CharStack g_char_stack = { {0}, 0, 0 };
 /* Static function prototypes */
 static bool is_valid_character(char c);
 static void clear_stack_memory(void);
+static CharStackResult sized_reserve(SizedCharStack* stack, size_t capacity);
 
 /**
  * @brief Validates if character is acceptable for stack operations
@@ -137,6 +143,8 @@ const char* char_stack_error_string(CharStackResult result) {
             return "Stack underflow - cannot pop from empty stack";
         case CHAR_STACK_ERROR_INVALID_INPUT:
             return "Invalid input parameter";
+        case CHAR_STACK_ERROR_MEMORY_ALLOCATION:
+            return "Memory allocation failed";
         default:
             return "Unknown error";
     }
@@ -194,3 +202,202 @@ CharStackResult char_stack_reverse_string(const char* input, char* output, size_
     
     return CHAR_STACK_SUCCESS;
 }
+
+/**
+ * @brief Ensures a sized stack can hold capacity characters
+ */
+static CharStackResult sized_reserve(SizedCharStack* stack, size_t capacity) {
+    if (capacity <= stack->capacity) {
+        return CHAR_STACK_SUCCESS;
+    }
+
+    if (stack->spill_policy != CHAR_STACK_SPILL_HEAP) {
+        return CHAR_STACK_ERROR_OVERFLOW;
+    }
+
+    /* Grow geometrically so repeated pushes spill in amortized O(1) */
+    size_t new_capacity = stack->capacity > SIZE_MAX / 2 ? SIZE_MAX : stack->capacity * 2;
+    if (new_capacity < capacity) {
+        new_capacity = capacity;
+    }
+    if (new_capacity < SPILL_MIN_CAPACITY) {
+        new_capacity = SPILL_MIN_CAPACITY;
+    }
+
+    char* elements = malloc(new_capacity);
+    if (!elements) {
+        return CHAR_STACK_ERROR_MEMORY_ALLOCATION;
+    }
+
+    /* Move contents and securely clear the old storage */
+    if (stack->elements) {
+        memcpy(elements, stack->elements, stack->size);
+        memset(stack->elements, 0, stack->capacity);
+    }
+    if (stack->elements != stack->inline_elements) {
+        free(stack->elements);
+    }
+
+    stack->elements = elements;
+    stack->capacity = new_capacity;
+
+    return CHAR_STACK_SUCCESS;
+}
+
+CharStackResult sized_char_stack_init(SizedCharStack* stack, char* storage, size_t inline_size,
+                                      CharStackSpillPolicy policy) {
+    /* Validate input parameters */
+    if (!stack || (!storage && inline_size > 0)) {
+        return CHAR_STACK_ERROR_INVALID_INPUT;
+    }
+
+    stack->elements = storage;
+    stack->size = 0;
+    stack->capacity = inline_size;
+    stack->inline_elements = storage;
+    stack->inline_capacity = inline_size;
+    stack->spill_policy = policy;
+
+    return CHAR_STACK_SUCCESS;
+}
+
+CharStackResult sized_char_stack_push(SizedCharStack* stack, char c) {
+    /* Validate input */
+    if (!stack || !is_valid_character(c)) {
+        return CHAR_STACK_ERROR_INVALID_INPUT;
+    }
+
+    /* Spill or report overflow */
+    if (stack->size >= stack->capacity) {
+        CharStackResult result = sized_reserve(stack, stack->size + 1);
+        if (result != CHAR_STACK_SUCCESS) {
+            return result;
+        }
+    }
+
+    stack->elements[stack->size++] = c;
+
+    return CHAR_STACK_SUCCESS;
+}
+
+CharStackResult sized_char_stack_pop(SizedCharStack* stack, char* c) {
+    /* Validate input parameters */
+    if (!stack || !c) {
+        return CHAR_STACK_ERROR_INVALID_INPUT;
+    }
+
+    /* Check for underflow */
+    if (stack->size == 0) {
+        *c = CHAR_STACK_EMPTY_CHAR;
+        return CHAR_STACK_ERROR_UNDERFLOW;
+    }
+
+    stack->size--;
+    *c = stack->elements[stack->size];
+
+    /* Clear the popped element for security */
+    stack->elements[stack->size] = '\0';
+
+    return CHAR_STACK_SUCCESS;
+}
+
+CharStackResult sized_char_stack_peek(const SizedCharStack* stack, char* c) {
+    /* Validate input parameters */
+    if (!stack || !c) {
+        return CHAR_STACK_ERROR_INVALID_INPUT;
+    }
+
+    /* Check for underflow */
+    if (stack->size == 0) {
+        *c = CHAR_STACK_EMPTY_CHAR;
+        return CHAR_STACK_ERROR_UNDERFLOW;
+    }
+
+    *c = stack->elements[stack->size - 1];
+
+    return CHAR_STACK_SUCCESS;
+}
+
+size_t sized_char_stack_size(const SizedCharStack* stack) {
+    return stack ? stack->size : 0;
+}
+
+size_t sized_char_stack_capacity(const SizedCharStack* stack) {
+    return stack ? stack->capacity : 0;
+}
+
+bool sized_char_stack_is_empty(const SizedCharStack* stack) {
+    return !stack || stack->size == 0;
+}
+
+bool sized_char_stack_is_spilled(const SizedCharStack* stack) {
+    return stack && stack->elements != stack->inline_elements;
+}
+
+CharStackResult sized_char_stack_clear(SizedCharStack* stack) {
+    if (!stack) {
+        return CHAR_STACK_ERROR_INVALID_INPUT;
+    }
+
+    /* Only the used prefix can hold data */
+    if (stack->size > 0) {
+        memset(stack->elements, 0, stack->size);
+    }
+    stack->size = 0;
+
+    return CHAR_STACK_SUCCESS;
+}
+
+void sized_char_stack_release(SizedCharStack* stack) {
+    if (stack) {
+        sized_char_stack_clear(stack);
+        if (stack->elements != stack->inline_elements) {
+            free(stack->elements);
+        }
+        stack->elements = stack->inline_elements;
+        stack->capacity = stack->inline_capacity;
+    }
+}
+
+CharStackResult sized_char_stack_reverse_string(SizedCharStack* stack, const char* input,
+                                                char* output, size_t max_length) {
+    /* Validate input parameters */
+    if (!stack || !input || !output || max_length == 0) {
+        return CHAR_STACK_ERROR_INVALID_INPUT;
+    }
+
+    /* Clear the stack before use */
+    sized_char_stack_clear(stack);
+
+    /* Check if output buffer is large enough */
+    size_t input_length = strlen(input);
+    if (input_length >= max_length) {
+        return CHAR_STACK_ERROR_INVALID_INPUT;
+    }
+
+    /* Spill at most once, up front, for inputs beyond the inline size */
+    CharStackResult result = sized_reserve(stack, input_length);
+    if (result != CHAR_STACK_SUCCESS) {
+        return result;
+    }
+
+    /* Push all characters onto the stack */
+    for (size_t i = 0; i < input_length; i++) {
+        result = sized_char_stack_push(stack, input[i]);
+        if (result != CHAR_STACK_SUCCESS) {
+            sized_char_stack_clear(stack);  /* Clean up on error */
+            return result;
+        }
+    }
+
+    /* Pop all characters to create reversed string */
+    size_t output_index = 0;
+    while (stack->size > 0) {
+        sized_char_stack_pop(stack, &output[output_index++]);
+    }
+
+    /* Null-terminate the output string */
+    output[output_index] = '\0';
+
+    return CHAR_STACK_SUCCESS;
+}
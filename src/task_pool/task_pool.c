@@ -0,0 +1,390 @@
+/**
+ * @file task_pool.c
+ * @brief Work-Stealing Task Pool Implementation
+ * @author Jaden Mardini
+ *
+ * Each worker owns a Chase-Lev deque and a free list of task records, so
+ * spawning a task allocates nothing on the common path and touches no
+ * shared state other than the group counter. A worker looking for work
+ * pops its own deque first and otherwise steals from the other workers,
+ * starting at a random victim. Workers spin (yielding the CPU) while a run
+ * is active and sleep on a condition variable between runs.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "task_pool.h"
+#include "work_stealing_deque.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/* Task records allocated at a time per worker */
+#define RECORD_CHUNK_SIZE 256
+
+/* Initial slots in each worker's deque */
+#define WORKER_DEQUE_CAPACITY 256
+
+/* Failed searches for work before yielding the CPU */
+#define IDLE_SPINS_BEFORE_YIELD 64
+
+/* Keeps per-worker state on separate cache lines */
+#define WORKER_CACHE_LINE_SIZE 64
+
+/* A spawned task */
+typedef struct TaskRecord {
+    TaskFunction function;
+    void* argument;
+    TaskGroup* group;
+    size_t spawner;             /* Index of the spawning worker */
+    struct TaskRecord* next;    /* Free-list link */
+} TaskRecord;
+
+/* Chunk of task records, freed with the pool */
+typedef struct RecordChunk {
+    struct RecordChunk* next;
+    TaskRecord records[RECORD_CHUNK_SIZE];
+} RecordChunk;
+
+/* Per-worker state */
+typedef struct {
+    alignas(WORKER_CACHE_LINE_SIZE) TaskPool* pool;
+    size_t index;
+    WorkStealingDeque* deque;
+    TaskRecord* free_records;
+    RecordChunk* chunks;
+    uint64_t random_state;      /* Victim selection */
+    atomic_size_t executed;
+    atomic_size_t stolen;
+    pthread_t thread;
+    bool thread_started;
+} Worker;
+
+/* Pool structure definition (opaque to users) */
+struct TaskPool {
+    Worker* workers;
+    size_t worker_count;
+    atomic_bool active;         /* A run is in progress */
+    bool shutdown;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+};
+
+/* Worker the current thread is acting as, if any */
+static _Thread_local Worker* current_worker = NULL;
+
+/* Static function prototypes */
+static TaskRecord* record_acquire(Worker* worker);
+static void record_release(Worker* worker, TaskRecord* record);
+static void execute(Worker* worker, TaskRecord* record);
+static bool find_and_run(Worker* worker);
+static void* worker_main(void* argument);
+
+/**
+ * @brief Takes a task record from the worker's free list, growing it if empty
+ */
+static TaskRecord* record_acquire(Worker* worker) {
+    if (!worker->free_records) {
+        RecordChunk* chunk = malloc(sizeof(RecordChunk));
+        if (!chunk) {
+            return NULL;
+        }
+        chunk->next = worker->chunks;
+        worker->chunks = chunk;
+        for (size_t i = RECORD_CHUNK_SIZE; i > 0; i--) {
+            chunk->records[i - 1].next = worker->free_records;
+            worker->free_records = &chunk->records[i - 1];
+        }
+    }
+
+    TaskRecord* record = worker->free_records;
+    worker->free_records = record->next;
+    return record;
+}
+
+/**
+ * @brief Returns a record to the free list of the worker that ran it
+ */
+static void record_release(Worker* worker, TaskRecord* record) {
+    record->next = worker->free_records;
+    worker->free_records = record;
+}
+
+/**
+ * @brief Runs a task and signals its group
+ */
+static void execute(Worker* worker, TaskRecord* record) {
+    TaskGroup* group = record->group;
+    bool stolen = record->spawner != worker->index;
+
+    record->function(record->argument);
+    record_release(worker, record);
+
+    atomic_fetch_add_explicit(&worker->executed, 1, memory_order_relaxed);
+    if (stolen) {
+        atomic_fetch_add_explicit(&worker->stolen, 1, memory_order_relaxed);
+    }
+
+    /* Release publishes the task's effects to the waiter */
+    atomic_fetch_sub_explicit(&group->pending, 1, memory_order_release);
+}
+
+/**
+ * @brief Runs one task from the worker's own deque or a victim's
+ * @return true if a task was run
+ */
+static bool find_and_run(Worker* worker) {
+    void* item;
+
+    if (ws_deque_pop(worker->deque, &item) == STACK_SUCCESS) {
+        execute(worker, item);
+        return true;
+    }
+
+    TaskPool* pool = worker->pool;
+    if (pool->worker_count < 2) {
+        return false;
+    }
+
+    /* xorshift64 picks where to start scanning victims */
+    uint64_t x = worker->random_state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    worker->random_state = x;
+
+    size_t start = (size_t)(x % pool->worker_count);
+    for (size_t i = 0; i < pool->worker_count; i++) {
+        Worker* victim = &pool->workers[(start + i) % pool->worker_count];
+        if (victim == worker) {
+            continue;
+        }
+
+        StackResult result;
+        while ((result = ws_deque_steal(victim->deque, &item)) == STACK_ERROR_CONTENDED) {
+            /* Lost a race; the victim may still have more */
+        }
+        if (result == STACK_SUCCESS) {
+            execute(worker, item);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Worker thread: sleeps between runs, hunts for tasks during them
+ */
+static void* worker_main(void* argument) {
+    Worker* worker = argument;
+    TaskPool* pool = worker->pool;
+    current_worker = worker;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (!atomic_load_explicit(&pool->active, memory_order_acquire) && !pool->shutdown) {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+        bool shutdown = pool->shutdown;
+        pthread_mutex_unlock(&pool->lock);
+
+        if (shutdown) {
+            break;
+        }
+
+        unsigned idle = 0;
+        while (atomic_load_explicit(&pool->active, memory_order_acquire)) {
+            if (find_and_run(worker)) {
+                idle = 0;
+            } else if (++idle >= IDLE_SPINS_BEFORE_YIELD) {
+                sched_yield();
+                idle = 0;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+TaskPool* task_pool_create(size_t thread_count) {
+    if (thread_count == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        thread_count = online > 0 ? (size_t)online : 1;
+    }
+
+    TaskPool* pool = malloc(sizeof(TaskPool));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->workers = aligned_alloc(WORKER_CACHE_LINE_SIZE, thread_count * sizeof(Worker));
+    if (!pool->workers) {
+        free(pool);
+        return NULL;
+    }
+
+    pool->worker_count = thread_count;
+    pool->shutdown = false;
+    atomic_init(&pool->active, false);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+
+    bool ok = true;
+    for (size_t i = 0; i < thread_count; i++) {
+        Worker* worker = &pool->workers[i];
+        worker->pool = pool;
+        worker->index = i;
+        worker->deque = ws_deque_create(WORKER_DEQUE_CAPACITY);
+        worker->free_records = NULL;
+        worker->chunks = NULL;
+        worker->random_state = 0x9E3779B97F4A7C15ULL * (i + 1);
+        atomic_init(&worker->executed, 0);
+        atomic_init(&worker->stolen, 0);
+        worker->thread_started = false;
+        ok = ok && worker->deque != NULL;
+    }
+
+    /* Worker 0 is the thread calling task_pool_run() */
+    for (size_t i = 1; ok && i < thread_count; i++) {
+        Worker* worker = &pool->workers[i];
+        worker->thread_started = pthread_create(&worker->thread, NULL, worker_main, worker) == 0;
+        ok = worker->thread_started;
+    }
+
+    if (!ok) {
+        task_pool_destroy(pool);
+        return NULL;
+    }
+
+    return pool;
+}
+
+void task_pool_destroy(TaskPool* pool) {
+    if (pool) {
+        pthread_mutex_lock(&pool->lock);
+        pool->shutdown = true;
+        pthread_cond_broadcast(&pool->wake);
+        pthread_mutex_unlock(&pool->lock);
+
+        for (size_t i = 0; i < pool->worker_count; i++) {
+            Worker* worker = &pool->workers[i];
+            if (worker->thread_started) {
+                pthread_join(worker->thread, NULL);
+            }
+        }
+
+        /* Records may sit on any worker's free list, so free chunks only after all threads stop */
+        for (size_t i = 0; i < pool->worker_count; i++) {
+            Worker* worker = &pool->workers[i];
+            RecordChunk* chunk = worker->chunks;
+            while (chunk) {
+                RecordChunk* next = chunk->next;
+                free(chunk);
+                chunk = next;
+            }
+            ws_deque_destroy(worker->deque);
+        }
+
+        pthread_cond_destroy(&pool->wake);
+        pthread_mutex_destroy(&pool->lock);
+        free(pool->workers);
+        free(pool);
+    }
+}
+
+StackResult task_pool_run(TaskPool* pool, TaskFunction function, void* argument) {
+    /* Validate input parameters */
+    if (!pool || !function) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    if (current_worker) {
+        return STACK_ERROR_UNSUPPORTED;    /* Nested runs would share worker 0 */
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    atomic_store_explicit(&pool->active, true, memory_order_release);
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    current_worker = &pool->workers[0];
+    function(argument);
+    current_worker = NULL;
+
+    atomic_store_explicit(&pool->active, false, memory_order_release);
+
+    return STACK_SUCCESS;
+}
+
+StackResult task_group_spawn(TaskGroup* group, TaskFunction function, void* argument) {
+    /* Validate input parameters */
+    if (!group || !function) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    Worker* worker = current_worker;
+    if (!worker) {
+        return STACK_ERROR_UNSUPPORTED;
+    }
+
+    TaskRecord* record = record_acquire(worker);
+    if (!record) {
+        function(argument);
+        return STACK_SUCCESS;
+    }
+
+    record->function = function;
+    record->argument = argument;
+    record->group = group;
+    record->spawner = worker->index;
+    atomic_fetch_add_explicit(&group->pending, 1, memory_order_relaxed);
+
+    if (ws_deque_push(worker->deque, record) != STACK_SUCCESS) {
+        /* Could not queue: run it here instead */
+        execute(worker, record);
+    }
+
+    return STACK_SUCCESS;
+}
+
+void task_group_wait(TaskGroup* group) {
+    if (!group) {
+        return;
+    }
+
+    Worker* worker = current_worker;
+    unsigned idle = 0;
+
+    while (atomic_load_explicit(&group->pending, memory_order_acquire) != 0) {
+        if (worker && find_and_run(worker)) {
+            idle = 0;
+        } else if (++idle >= IDLE_SPINS_BEFORE_YIELD) {
+            sched_yield();
+            idle = 0;
+        }
+    }
+}
+
+size_t task_pool_thread_count(const TaskPool* pool) {
+    return pool ? pool->worker_count : 0;
+}
+
+StackResult task_pool_get_stats(const TaskPool* pool, TaskPoolStats* stats) {
+    if (!pool || !stats) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    stats->executed = 0;
+    stats->stolen = 0;
+    for (size_t i = 0; i < pool->worker_count; i++) {
+        stats->executed += atomic_load_explicit(&pool->workers[i].executed, memory_order_relaxed);
+        stats->stolen += atomic_load_explicit(&pool->workers[i].stolen, memory_order_relaxed);
+    }
+
+    return STACK_SUCCESS;
+}
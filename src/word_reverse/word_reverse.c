@@ -0,0 +1,331 @@
+/**
+ * @file word_reverse.c
+ * @brief Word-Order Reversal Implementation
+ * @author Jaden Mardini
+ *
+ * The input is classified 64 bytes at a time: SSE2 compares against each
+ * delimiter give a 64-bit delimiter mask, and XOR with the mask shifted by
+ * one byte leaves a bit at every word/delimiter boundary. Only boundary
+ * positions are visited, each closing one span on the span stack. The
+ * stack is small enough to stay in L1; when it fills, it is flushed by
+ * popping spans last to first into the output region those spans map to,
+ * each with a single bulk copy. Regions are filled from the end of the
+ * output towards the start, so nothing but the span stack is buffered.
+ */
+
+#include "word_reverse.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* Bytes examined per block */
+#define BLOCK_SIZE 64
+
+/* Span boundaries buffered between flushes */
+#define SPAN_STACK_SIZE 1024
+
+/* Spans up to this length are copied with one 16-byte move when in bounds */
+#define SHORT_SPAN_LENGTH 16
+
+/*
+ * Bounded stack of span end offsets. Consecutive entries delimit the spans
+ * (offset, length) pushed since the last flush, which alternate between
+ * words and delimiter runs, so one offset per span is all that is stored.
+ */
+typedef struct {
+    size_t ends[SPAN_STACK_SIZE];
+    size_t count;
+    size_t start;           /* Offset where the first stacked span begins */
+    bool start_is_word;     /* Kind of the first stacked span */
+    const char* input;
+    size_t input_length;
+    char* output;
+    size_t cursor;          /* Start of the output already written */
+    bool collapse;
+    bool emitted_words;     /* Some word already sits after the cursor */
+    char separator;
+} SpanStack;
+
+/* Delimiter lookup state */
+typedef struct {
+    bool is_delimiter[256];
+#if defined(__SSE2__)
+    __m128i needles[WORD_REVERSE_MAX_DELIMITERS];
+#endif
+    size_t delimiter_count;
+} Classifier;
+
+/* Static function prototypes */
+static WordReverseResult classifier_init(Classifier* classifier, const char* delimiters);
+static uint64_t delimiter_mask(const Classifier* classifier, const unsigned char* block);
+static size_t emit_span(const SpanStack* stack, size_t begin, size_t end,
+                        size_t position, size_t region_end);
+static bool span_stack_flush(SpanStack* stack);
+static void copy_span(char* destination, const char* source, size_t length, bool padded);
+
+/**
+ * @brief Builds lookup tables for a delimiter set
+ */
+static WordReverseResult classifier_init(Classifier* classifier, const char* delimiters) {
+    size_t count = strlen(delimiters);
+    if (count == 0 || count > WORD_REVERSE_MAX_DELIMITERS) {
+        return WORD_REVERSE_ERROR_INVALID_DELIMITERS;
+    }
+
+    memset(classifier->is_delimiter, 0, sizeof(classifier->is_delimiter));
+    classifier->delimiter_count = count;
+
+    for (size_t i = 0; i < count; i++) {
+        classifier->is_delimiter[(unsigned char)delimiters[i]] = true;
+#if defined(__SSE2__)
+        classifier->needles[i] = _mm_set1_epi8(delimiters[i]);
+#endif
+    }
+
+    return WORD_REVERSE_SUCCESS;
+}
+
+/**
+ * @brief Returns a mask with bit i set when block[i] is a delimiter
+ */
+static inline uint64_t delimiter_mask(const Classifier* classifier, const unsigned char* block) {
+#if defined(__SSE2__)
+    __m128i b0 = _mm_loadu_si128((const __m128i*)(const void*)block);
+    __m128i b1 = _mm_loadu_si128((const __m128i*)(const void*)(block + 16));
+    __m128i b2 = _mm_loadu_si128((const __m128i*)(const void*)(block + 32));
+    __m128i b3 = _mm_loadu_si128((const __m128i*)(const void*)(block + 48));
+    __m128i h0 = _mm_setzero_si128();
+    __m128i h1 = _mm_setzero_si128();
+    __m128i h2 = _mm_setzero_si128();
+    __m128i h3 = _mm_setzero_si128();
+
+    for (size_t k = 0; k < classifier->delimiter_count; k++) {
+        __m128i needle = classifier->needles[k];
+        h0 = _mm_or_si128(h0, _mm_cmpeq_epi8(b0, needle));
+        h1 = _mm_or_si128(h1, _mm_cmpeq_epi8(b1, needle));
+        h2 = _mm_or_si128(h2, _mm_cmpeq_epi8(b2, needle));
+        h3 = _mm_or_si128(h3, _mm_cmpeq_epi8(b3, needle));
+    }
+
+    return (uint64_t)(unsigned)_mm_movemask_epi8(h0) |
+           ((uint64_t)(unsigned)_mm_movemask_epi8(h1) << 16) |
+           ((uint64_t)(unsigned)_mm_movemask_epi8(h2) << 32) |
+           ((uint64_t)(unsigned)_mm_movemask_epi8(h3) << 48);
+#else
+    uint64_t mask = 0;
+    for (int i = 0; i < BLOCK_SIZE; i++) {
+        mask |= (uint64_t)classifier->is_delimiter[block[i]] << i;
+    }
+    return mask;
+#endif
+}
+
+/**
+ * @brief Writes input[begin, end) at position within a region
+ * @return Position just past the written span
+ */
+static inline size_t emit_span(const SpanStack* stack, size_t begin, size_t end,
+                               size_t position, size_t region_end) {
+    bool padded = begin + SHORT_SPAN_LENGTH <= stack->input_length &&
+                  position + SHORT_SPAN_LENGTH <= region_end;
+    copy_span(stack->output + position, stack->input + begin, end - begin, padded);
+    return position + (end - begin);
+}
+
+/**
+ * @brief Pops every stacked span into the output just before the cursor
+ * @return false if the output has no room left
+ */
+static bool span_stack_flush(SpanStack* stack) {
+    if (stack->count == 0) {
+        return true;
+    }
+
+    size_t first = stack->start;
+    size_t last = stack->ends[stack->count - 1];
+    size_t size = last - first;
+
+    /* Spans alternate, so words sit at every other index from the first word */
+    size_t first_word = stack->start_is_word ? 0 : 1;
+    size_t words = stack->count > first_word ? (stack->count - first_word + 1) / 2 : 0;
+
+    /* Collapsed output keeps words only, each followed by a separator except the last overall */
+    if (stack->collapse) {
+        size = stack->emitted_words ? words : (words > 0 ? words - 1 : 0);
+        for (size_t j = 0; j < words; j++) {
+            size_t index = first_word + 2 * j;
+            size += stack->ends[index] - (index > 0 ? stack->ends[index - 1] : first);
+        }
+        stack->emitted_words = stack->emitted_words || words > 0;
+    }
+    if (size > stack->cursor) {
+        return false;
+    }
+
+    size_t region_end = stack->cursor;
+    size_t position = region_end - size;
+    stack->cursor = position;
+
+    /* The last span pushed is the first written */
+    if (stack->collapse) {
+        for (size_t j = words; j > 0; j--) {
+            size_t index = first_word + 2 * (j - 1);
+            size_t begin = index > 0 ? stack->ends[index - 1] : first;
+            position = emit_span(stack, begin, stack->ends[index], position, region_end);
+            if (position < region_end) {
+                stack->output[position++] = stack->separator;
+            }
+        }
+    } else {
+        for (size_t i = stack->count; i > 0; i--) {
+            size_t begin = i > 1 ? stack->ends[i - 2] : first;
+            position = emit_span(stack, begin, stack->ends[i - 1], position, region_end);
+        }
+    }
+
+    stack->start = last;
+    stack->start_is_word ^= (stack->count & 1) != 0;
+    stack->count = 0;
+    return true;
+}
+
+/**
+ * @brief Copies one span
+ *
+ * When padded is set, SHORT_SPAN_LENGTH bytes may be read from source and
+ * written to destination; bytes past length are overwritten by later spans
+ * of the same region.
+ */
+static inline void copy_span(char* destination, const char* source, size_t length, bool padded) {
+#if defined(__SSE2__)
+    if (padded && length <= SHORT_SPAN_LENGTH) {
+        _mm_storeu_si128((__m128i*)(void*)destination,
+                         _mm_loadu_si128((const __m128i*)(const void*)source));
+        return;
+    }
+#else
+    (void)padded;
+#endif
+    memcpy(destination, source, length);
+}
+
+WordReverseResult word_reverse(const char* input, size_t length, char* output, size_t output_size,
+                               const WordReverseOptions* options, size_t* output_length) {
+    /* Validate input parameters */
+    if (!input || !output) {
+        return WORD_REVERSE_ERROR_NULL_POINTER;
+    }
+
+    const char* delimiters = options && options->delimiters ? options->delimiters
+                                                            : WORD_REVERSE_DEFAULT_DELIMITERS;
+    bool collapse = options && options->collapse;
+
+    Classifier classifier;
+    WordReverseResult result = classifier_init(&classifier, delimiters);
+    if (result != WORD_REVERSE_SUCCESS) {
+        return result;
+    }
+
+    /*
+     * Uncollapsed output is exactly as long as the input. Collapsed output
+     * is built against the end of the buffer and moved down afterwards.
+     */
+    if (!collapse && output_size <= length) {
+        return WORD_REVERSE_ERROR_BUFFER_TOO_SMALL;
+    }
+    if (output_size == 0) {
+        return WORD_REVERSE_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    const unsigned char* bytes = (const unsigned char*)input;
+    bool first_is_delimiter = length > 0 && classifier.is_delimiter[bytes[0]];
+
+    SpanStack stack;
+    stack.count = 0;
+    stack.start = 0;
+    stack.start_is_word = !first_is_delimiter;
+    stack.input = input;
+    stack.input_length = length;
+    stack.output = output;
+    stack.cursor = collapse ? output_size - 1 : length;
+    stack.collapse = collapse;
+    stack.emitted_words = false;
+    stack.separator = delimiters[0];
+    size_t result_end = stack.cursor;
+
+    /* Seeding with the first byte's kind keeps offset 0 from being a boundary */
+    uint64_t previous_bit = first_is_delimiter ? 1 : 0;
+
+    for (size_t base = 0; base < length; base += BLOCK_SIZE) {
+        size_t remaining = length - base;
+        uint64_t valid = ~0ULL;
+        uint64_t mask;
+
+        if (remaining >= BLOCK_SIZE) {
+            mask = delimiter_mask(&classifier, bytes + base);
+        } else {
+            unsigned char tail[BLOCK_SIZE] = {0};
+            memcpy(tail, bytes + base, remaining);
+            mask = delimiter_mask(&classifier, tail);
+            valid = (1ULL << remaining) - 1;
+        }
+
+        uint64_t boundaries = (mask ^ ((mask << 1) | previous_bit)) & valid;
+        previous_bit = mask >> 63;
+
+        /* A block adds at most BLOCK_SIZE boundaries, so check room once */
+        if (stack.count + BLOCK_SIZE > SPAN_STACK_SIZE && !span_stack_flush(&stack)) {
+            return WORD_REVERSE_ERROR_BUFFER_TOO_SMALL;
+        }
+
+        /* Each boundary ends the span that began at the previous one */
+        size_t* top = stack.ends + stack.count;
+        while (boundaries) {
+            *top++ = base + (size_t)__builtin_ctzll(boundaries);
+            boundaries &= boundaries - 1;
+        }
+        stack.count = (size_t)(top - stack.ends);
+    }
+
+    /* The input end closes the final span */
+    if (length > 0) {
+        if (stack.count == SPAN_STACK_SIZE && !span_stack_flush(&stack)) {
+            return WORD_REVERSE_ERROR_BUFFER_TOO_SMALL;
+        }
+        stack.ends[stack.count++] = length;
+    }
+    if (!span_stack_flush(&stack)) {
+        return WORD_REVERSE_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    size_t result_length = result_end - stack.cursor;
+    if (stack.cursor > 0) {
+        memmove(output, output + stack.cursor, result_length);
+    }
+    output[result_length] = '\0';
+
+    if (output_length) {
+        *output_length = result_length;
+    }
+
+    return WORD_REVERSE_SUCCESS;
+}
+
+const char* word_reverse_error_string(WordReverseResult result) {
+    switch (result) {
+        case WORD_REVERSE_SUCCESS:
+            return "Success";
+        case WORD_REVERSE_ERROR_NULL_POINTER:
+            return "Null pointer provided";
+        case WORD_REVERSE_ERROR_INVALID_DELIMITERS:
+            return "Delimiter set is empty or too large";
+        case WORD_REVERSE_ERROR_BUFFER_TOO_SMALL:
+            return "Output buffer too small";
+        default:
+            return "Unknown error";
+    }
+}
@@ -0,0 +1,213 @@
+/**
+ * @file work_stealing_deque.c
+ * @brief Chase-Lev Work-Stealing Deque Implementation
+ * @author Jaden Mardini
+ *
+ * Follows the C11 formulation of the Chase-Lev deque by Le, Pop, Cohen and
+ * Zappa Nardelli. top only ever increases and is advanced by CAS, by
+ * thieves and by the owner when it races for the last item; bottom is
+ * written only by the owner. A release fence orders the slot store before
+ * the bottom store in push, and sequentially consistent fences in pop and
+ * steal order the bottom/top accesses that decide who gets the last item.
+ *
+ * When the buffer is full the owner copies the live range into one twice
+ * the size. A thief may still be reading the old buffer, so it is retired
+ * onto a list and freed with the deque rather than immediately.
+ */
+
+#include "work_stealing_deque.h"
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/* Keeps the owner's and thieves' indices on separate cache lines */
+#define DEQUE_CACHE_LINE_SIZE 64
+
+/* Circular buffer of item slots */
+typedef struct DequeBuffer {
+    struct DequeBuffer* retired;    /* Older buffer kept alive for thieves */
+    int64_t mask;                   /* Capacity - 1; capacity is a power of two */
+    _Atomic(void*) slots[];
+} DequeBuffer;
+
+/* Deque structure definition (opaque to users) */
+struct WorkStealingDeque {
+    alignas(DEQUE_CACHE_LINE_SIZE) atomic_int_least64_t top;    /* Next item to steal */
+    alignas(DEQUE_CACHE_LINE_SIZE) atomic_int_least64_t bottom; /* Next free slot */
+    _Atomic(DequeBuffer*) buffer;
+};
+
+/* Static function prototypes */
+static DequeBuffer* buffer_create(int64_t capacity);
+static DequeBuffer* buffer_grow(DequeBuffer* buffer, int64_t top, int64_t bottom);
+
+/**
+ * @brief Allocates a buffer of capacity slots (a power of two)
+ */
+static DequeBuffer* buffer_create(int64_t capacity) {
+    DequeBuffer* buffer = malloc(sizeof(DequeBuffer) + (size_t)capacity * sizeof(_Atomic(void*)));
+    if (!buffer) {
+        return NULL;
+    }
+
+    buffer->retired = NULL;
+    buffer->mask = capacity - 1;
+    for (int64_t i = 0; i < capacity; i++) {
+        atomic_init(&buffer->slots[i], NULL);
+    }
+
+    return buffer;
+}
+
+/**
+ * @brief Copies the live range [top, bottom) into a buffer twice the size
+ */
+static DequeBuffer* buffer_grow(DequeBuffer* buffer, int64_t top, int64_t bottom) {
+    DequeBuffer* grown = buffer_create(2 * (buffer->mask + 1));
+    if (!grown) {
+        return NULL;
+    }
+
+    for (int64_t i = top; i < bottom; i++) {
+        void* item = atomic_load_explicit(&buffer->slots[i & buffer->mask], memory_order_relaxed);
+        atomic_store_explicit(&grown->slots[i & grown->mask], item, memory_order_relaxed);
+    }
+
+    grown->retired = buffer;
+    return grown;
+}
+
+WorkStealingDeque* ws_deque_create(size_t initial_capacity) {
+    size_t capacity = WS_DEQUE_MIN_CAPACITY;
+    while (capacity < initial_capacity && capacity <= SIZE_MAX / 2) {
+        capacity *= 2;
+    }
+
+    WorkStealingDeque* deque = aligned_alloc(DEQUE_CACHE_LINE_SIZE, sizeof(WorkStealingDeque));
+    if (!deque) {
+        return NULL;
+    }
+
+    DequeBuffer* buffer = buffer_create((int64_t)capacity);
+    if (!buffer) {
+        free(deque);
+        return NULL;
+    }
+
+    atomic_init(&deque->top, 0);
+    atomic_init(&deque->bottom, 0);
+    atomic_init(&deque->buffer, buffer);
+
+    return deque;
+}
+
+void ws_deque_destroy(WorkStealingDeque* deque) {
+    if (deque) {
+        DequeBuffer* buffer = atomic_load_explicit(&deque->buffer, memory_order_relaxed);
+        while (buffer) {
+            DequeBuffer* retired = buffer->retired;
+            free(buffer);
+            buffer = retired;
+        }
+        free(deque);
+    }
+}
+
+StackResult ws_deque_push(WorkStealingDeque* deque, void* item) {
+    /* Validate input parameters */
+    if (!deque || !item) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    DequeBuffer* buffer = atomic_load_explicit(&deque->buffer, memory_order_relaxed);
+
+    if (bottom - top > buffer->mask) {
+        DequeBuffer* grown = buffer_grow(buffer, top, bottom);
+        if (!grown) {
+            return STACK_ERROR_MEMORY_ALLOCATION;
+        }
+        /* Release so a thief that sees the new buffer also sees its contents */
+        atomic_store_explicit(&deque->buffer, grown, memory_order_release);
+        buffer = grown;
+    }
+
+    atomic_store_explicit(&buffer->slots[bottom & buffer->mask], item, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+
+    return STACK_SUCCESS;
+}
+
+StackResult ws_deque_pop(WorkStealingDeque* deque, void** item) {
+    /* Validate input parameters */
+    if (!deque || !item) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    /* Claim the bottom slot before looking at top */
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    DequeBuffer* buffer = atomic_load_explicit(&deque->buffer, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    if (top > bottom) {
+        /* Empty: restore bottom */
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return STACK_ERROR_UNDERFLOW;
+    }
+
+    void* value = atomic_load_explicit(&buffer->slots[bottom & buffer->mask], memory_order_relaxed);
+
+    if (top == bottom) {
+        /* Last item: race thieves for it by advancing top */
+        bool won = atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                           memory_order_seq_cst, memory_order_relaxed);
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        if (!won) {
+            return STACK_ERROR_UNDERFLOW;
+        }
+    }
+
+    *item = value;
+    return STACK_SUCCESS;
+}
+
+StackResult ws_deque_steal(WorkStealingDeque* deque, void** item) {
+    /* Validate input parameters */
+    if (!deque || !item) {
+        return STACK_ERROR_NULL_POINTER;
+    }
+
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+    if (top >= bottom) {
+        return STACK_ERROR_UNDERFLOW;
+    }
+
+    DequeBuffer* buffer = atomic_load_explicit(&deque->buffer, memory_order_acquire);
+    void* value = atomic_load_explicit(&buffer->slots[top & buffer->mask], memory_order_relaxed);
+
+    if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed)) {
+        return STACK_ERROR_CONTENDED;
+    }
+
+    *item = value;
+    return STACK_SUCCESS;
+}
+
+size_t ws_deque_size(const WorkStealingDeque* deque) {
+    if (!deque) {
+        return 0;
+    }
+
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+    return bottom > top ? (size_t)(bottom - top) : 0;
+}
@@ -9,9 +9,38 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <limits.h>
 #include <assert.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <signal.h>
 #include "dynamic_stack.h"
 #include "static_stack.h"
+#include "persistent_stack.h"
+#include "minmax_stack.h"
+#include "monotonic_stack.h"
+#include "bracket_validator.h"
+#include "word_reverse.h"
+#include "palindrome.h"
+#include "work_stealing_deque.h"
+#include "task_pool.h"
+#include "stack_vm.h"
+#include "reverse_transform.h"
+#include "sharded_stack.h"
+#include "blocking_stack.h"
+#include "compact_stack.h"
+#include "reversed_view.h"
+#include "reversal_cache.h"
+#include "reversal_server.h"
+#include "spill_stack.h"
+#include "shared_stack.h"
+#include "stack_scan.h"
+#include "multi_stack.h"
 
 /* Test result tracking */
 static int tests_run = 0;
@@ -164,6 +193,70 @@ static void test_dynamic_stack_peek(void) {
     stack_destroy(stack);
 }
 
+/**
+ * @brief Tests dynamic stack checkpoints and rewinding
+ */
+static void test_dynamic_stack_mark_rewind(void) {
+    TEST_SECTION("Dynamic Stack Mark/Rewind Tests");
+    
+    Stack* stack = stack_create(10);
+    TEST_ASSERT(stack != NULL, "Create test stack");
+    
+    stack_push(stack, 1);
+    stack_push(stack, 2);
+    StackMark outer = stack_mark(stack);
+    TEST_ASSERT(outer.size == 2, "Outer mark records size");
+    
+    stack_push(stack, 3);
+    StackMark inner = stack_mark(stack);
+    stack_push(stack, 4);
+    stack_push(stack, 5);
+    
+    /* Rewind to inner checkpoint */
+    StackResult result = stack_rewind(stack, inner);
+    TEST_ASSERT(result == STACK_SUCCESS, "Rewind to inner mark");
+    TEST_ASSERT(stack_size(stack) == 3, "Size restored to inner mark");
+    
+    int value;
+    stack_peek(stack, &value);
+    TEST_ASSERT(value == 3, "Top restored to inner mark");
+    
+    /* Rewind to outer checkpoint invalidates the inner one */
+    result = stack_rewind(stack, outer);
+    TEST_ASSERT(result == STACK_SUCCESS, "Rewind to outer mark");
+    TEST_ASSERT(stack_size(stack) == 2, "Size restored to outer mark");
+    
+    result = stack_rewind(stack, inner);
+    TEST_ASSERT(result == STACK_ERROR_INVALID_MARK, "Rewind to discarded mark fails");
+    
+#ifdef DEBUG
+    /* Popping below a mark and re-pushing past it is detected in debug builds */
+    StackMark stale = stack_mark(stack);
+    stack_pop(stack, &value);
+    stack_push(stack, 7);
+    stack_push(stack, 8);
+    result = stack_rewind(stack, stale);
+    TEST_ASSERT(result == STACK_ERROR_INVALID_MARK, "Rewind to re-pushed mark fails in debug");
+    stack_clear(stack);
+    stack_push(stack, 1);
+    stack_push(stack, 2);
+#endif
+    
+    /* Rewinding with wipes disabled leaves discarded slots untouched */
+    result = stack_set_wipe_policy(stack, STACK_WIPE_NEVER);
+    TEST_ASSERT(result == STACK_SUCCESS, "Set wipe policy");
+    StackMark mark = stack_mark(stack);
+    stack_push(stack, 99);
+    stack_rewind(stack, mark);
+    stack_pop(stack, &value);
+    TEST_ASSERT(value == 2, "Pop after rewind returns element below mark");
+    
+    result = stack_rewind(NULL, mark);
+    TEST_ASSERT(result == STACK_ERROR_NULL_POINTER, "Rewind null stack fails");
+    
+    stack_destroy(stack);
+}
+
 /**
  * @brief Tests static character stack operations
  */
@@ -279,6 +372,1803 @@ static void test_error_handling(void) {
     TEST_ASSERT(result == STACK_ERROR_NULL_POINTER, "Clear null stack fails appropriately");
 }
 
+/**
+ * @brief Tests persistent stack versions and structural sharing
+ */
+static void test_persistent_stack(void) {
+    TEST_SECTION("Persistent Stack Tests");
+
+    PersistentStackPool* pool = persistent_stack_pool_create();
+    TEST_ASSERT(pool != NULL, "Create persistent stack pool");
+
+    PersistentStack base;
+    TEST_ASSERT(persistent_stack_init(&base, pool) == STACK_SUCCESS, "Initialize empty version");
+    TEST_ASSERT(persistent_stack_is_empty(&base), "New version is empty");
+
+    persistent_stack_push(&base, 1);
+    persistent_stack_push(&base, 2);
+    persistent_stack_push(&base, 3);
+    TEST_ASSERT(persistent_stack_size(&base) == 3, "Version size after pushes");
+
+    /* Snapshot shares every node */
+    PersistentStack snapshot;
+    TEST_ASSERT(persistent_stack_snapshot(&base, &snapshot) == STACK_SUCCESS, "Snapshot version");
+    TEST_ASSERT(persistent_stack_pool_live_nodes(pool) == 3, "Snapshot allocates no nodes");
+
+    /* Diverge the two versions */
+    int value;
+    persistent_stack_pop(&base, &value);
+    TEST_ASSERT(value == 3, "Pop from shared version returns top");
+    persistent_stack_push(&base, 42);
+    TEST_ASSERT(persistent_stack_pool_live_nodes(pool) == 4, "Diverging push shares the tail");
+
+    persistent_stack_peek(&snapshot, &value);
+    TEST_ASSERT(value == 3, "Snapshot unaffected by later pushes");
+    persistent_stack_peek(&base, &value);
+    TEST_ASSERT(value == 42, "Working version sees its own push");
+
+    PersistentStack clone;
+    persistent_stack_clone(&snapshot, &clone);
+    persistent_stack_release(&snapshot);
+    TEST_ASSERT(persistent_stack_pool_live_nodes(pool) == 4, "Clone keeps released version alive");
+
+    persistent_stack_pop(&clone, &value);
+    TEST_ASSERT(value == 3, "Clone pops original top");
+    TEST_ASSERT(persistent_stack_pool_live_nodes(pool) == 3, "Unshared node reclaimed on pop");
+
+    persistent_stack_release(&clone);
+    persistent_stack_release(&base);
+    TEST_ASSERT(persistent_stack_pool_live_nodes(pool) == 0, "All nodes reclaimed after release");
+
+    TEST_ASSERT(persistent_stack_pop(&base, &value) == STACK_ERROR_UNDERFLOW, "Pop from empty version fails");
+    TEST_ASSERT(persistent_stack_push(NULL, 1) == STACK_ERROR_NULL_POINTER, "Push to null version fails");
+
+    persistent_stack_pool_destroy(pool);
+}
+
+/**
+ * @brief Tests min/max/sum tracking stack aggregates
+ */
+static void test_minmax_stack(void) {
+    TEST_SECTION("Min/Max Stack Tests");
+    
+    MinMaxStack* stack = minmax_stack_create(8, MINMAX_STACK_TRACK_ALL);
+    TEST_ASSERT(stack != NULL, "Create min/max stack");
+    
+    int value;
+    long long sum;
+    TEST_ASSERT(minmax_stack_min(stack, &value) == STACK_ERROR_UNDERFLOW, "Min of empty stack fails");
+    
+    static const int pushes[] = {5, 3, 8, 3, 1, 9};
+    for (size_t i = 0; i < sizeof(pushes) / sizeof(pushes[0]); i++) {
+        minmax_stack_push(stack, pushes[i]);
+    }
+    
+    minmax_stack_min(stack, &value);
+    TEST_ASSERT(value == 1, "Minimum tracked across pushes");
+    minmax_stack_max(stack, &value);
+    TEST_ASSERT(value == 9, "Maximum tracked across pushes");
+    minmax_stack_sum(stack, &sum);
+    TEST_ASSERT(sum == 29, "Sum tracked across pushes");
+    
+    /* Pop 9 and 1: extrema fall back to earlier records */
+    minmax_stack_pop(stack, &value);
+    minmax_stack_pop(stack, &value);
+    minmax_stack_min(stack, &value);
+    TEST_ASSERT(value == 3, "Minimum restored after popping extremum");
+    minmax_stack_max(stack, &value);
+    TEST_ASSERT(value == 8, "Maximum restored after popping extremum");
+    
+    /* Duplicate minimum: popping one copy keeps the other */
+    minmax_stack_pop(stack, &value);
+    minmax_stack_min(stack, &value);
+    TEST_ASSERT(value == 3, "Duplicate minimum survives popping one copy");
+    minmax_stack_sum(stack, &sum);
+    TEST_ASSERT(sum == 16, "Sum restored after pops");
+    
+    minmax_stack_clear(stack);
+    TEST_ASSERT(minmax_stack_is_empty(stack), "Stack empty after clear");
+    minmax_stack_destroy(stack);
+    
+    /* Untracked aggregates are reported as unsupported */
+    stack = minmax_stack_create(4, MINMAX_STACK_TRACK_MIN);
+    minmax_stack_push(stack, 2);
+    TEST_ASSERT(minmax_stack_max(stack, &value) == STACK_ERROR_UNSUPPORTED, "Untracked maximum unsupported");
+    TEST_ASSERT(minmax_stack_sum(stack, &sum) == STACK_ERROR_UNSUPPORTED, "Untracked sum unsupported");
+    minmax_stack_destroy(stack);
+    
+    TEST_ASSERT(minmax_stack_create(0, MINMAX_STACK_TRACK_ALL) == NULL, "Create with invalid capacity fails");
+}
+
+/**
+ * @brief Tests monotonic-stack kernels against known answers
+ */
+static void test_monotonic_kernels(void) {
+    TEST_SECTION("Monotonic Stack Kernel Tests");
+    
+    static const int values[] = {2, 1, 5, 6, 2, 3};
+    size_t out[6];
+    
+    StackResult result = monotonic_next_greater(NULL, values, 6, out);
+    TEST_ASSERT(result == STACK_SUCCESS, "Next greater without workspace");
+    TEST_ASSERT(out[0] == 2 && out[1] == 2 && out[2] == 3 && out[3] == MONOTONIC_NONE &&
+                out[4] == 5 && out[5] == MONOTONIC_NONE, "Next greater indices correct");
+    
+    MonotonicWorkspace* workspace = monotonic_workspace_create(0);
+    TEST_ASSERT(workspace != NULL, "Create workspace");
+    
+    monotonic_previous_smaller(workspace, values, 6, out);
+    TEST_ASSERT(out[0] == MONOTONIC_NONE && out[1] == MONOTONIC_NONE && out[2] == 1 &&
+                out[3] == 2 && out[4] == 1 && out[5] == 4, "Previous smaller indices correct");
+    
+    static const int prices[] = {100, 80, 60, 70, 60, 75, 85};
+    size_t spans[7];
+    monotonic_stock_span(workspace, prices, 7, spans);
+    TEST_ASSERT(spans[0] == 1 && spans[1] == 1 && spans[2] == 1 && spans[3] == 2 &&
+                spans[4] == 1 && spans[5] == 4 && spans[6] == 6, "Stock spans correct");
+    
+    long long area = 0;
+    monotonic_largest_rectangle(workspace, values, 6, &area);
+    TEST_ASSERT(area == 10, "Largest rectangle area correct");
+    
+    /* Batch over several threads matches single-array results */
+    MonotonicJob jobs[4];
+    size_t batch_out[4][6];
+    for (size_t i = 0; i < 4; i++) {
+        jobs[i].kernel = i % 2 ? MONOTONIC_LARGEST_RECTANGLE : MONOTONIC_NEXT_SMALLER;
+        jobs[i].values = values;
+        jobs[i].count = 6;
+        jobs[i].indices = batch_out[i];
+    }
+    result = monotonic_run_batch(jobs, 4, 3);
+    TEST_ASSERT(result == STACK_SUCCESS, "Batch run succeeds");
+    TEST_ASSERT(jobs[1].area == 10 && jobs[3].area == 10, "Batch rectangle results correct");
+    TEST_ASSERT(batch_out[0][0] == 1 && batch_out[2][3] == 4, "Batch next smaller results correct");
+    
+    result = monotonic_next_greater(workspace, NULL, 6, out);
+    TEST_ASSERT(result == STACK_ERROR_NULL_POINTER, "Null input rejected");
+    
+    monotonic_workspace_destroy(workspace);
+}
+
+/**
+ * @brief Tests the bracket balance validator
+ */
+static void test_bracket_validator(void) {
+    TEST_SECTION("Bracket Validator Tests");
+    
+    BracketReport report;
+    const char* balanced = "{\"a\": [1, 2, (3)], \"b\": {\"c\": []}}";
+    BracketResult result = bracket_validate(balanced, strlen(balanced), NULL, &report);
+    TEST_ASSERT(result == BRACKET_BALANCED, "Balanced payload accepted");
+    TEST_ASSERT(report.max_depth == 3, "Maximum depth reported");
+    
+    const char* mismatch = "[1, {2, 3]}";
+    result = bracket_validate(mismatch, strlen(mismatch), NULL, &report);
+    TEST_ASSERT(result == BRACKET_ERROR_MISMATCH, "Mismatched closer detected");
+    TEST_ASSERT(report.error_offset == 9, "Mismatch offset is exact");
+    
+    result = bracket_validate("())", 3, NULL, &report);
+    TEST_ASSERT(result == BRACKET_ERROR_UNEXPECTED_CLOSE && report.error_offset == 2,
+                "Unexpected closer detected at offset");
+    
+    result = bracket_validate("((", 2, NULL, &report);
+    TEST_ASSERT(result == BRACKET_ERROR_UNCLOSED && report.error_offset == 2,
+                "Unclosed opener reported at end of input");
+    
+    /* Delimiters inside strings are ignored, including escaped quotes */
+    BracketOptions options = { NULL, true, '"' };
+    const char* quoted = "{\"key\": \"value with ) and \\\" quote\"}";
+    result = bracket_validate(quoted, strlen(quoted), &options, &report);
+    TEST_ASSERT(result == BRACKET_BALANCED, "Delimiters inside strings skipped");
+    result = bracket_validate("[\"open", 6, &options, &report);
+    TEST_ASSERT(result == BRACKET_ERROR_UNTERMINATED_STRING, "Unterminated string detected");
+    
+    /* Depth far beyond the old 256-character stack, spanning SIMD blocks */
+    size_t depth = 100000;
+    char* deep = malloc(2 * depth + 1);
+    for (size_t i = 0; i < depth; i++) {
+        deep[i] = '[';
+        deep[2 * depth - 1 - i] = ']';
+    }
+    deep[2 * depth] = '\0';
+    result = bracket_validate(deep, 2 * depth, NULL, &report);
+    TEST_ASSERT(result == BRACKET_BALANCED && report.max_depth == depth, "Deep nesting limited only by memory");
+    deep[2 * depth - 3] = ')';
+    result = bracket_validate(deep, 2 * depth, NULL, &report);
+    TEST_ASSERT(result == BRACKET_ERROR_MISMATCH && report.error_offset == 2 * depth - 3,
+                "Mismatch offset exact in large input");
+    free(deep);
+    
+    BracketOptions custom = { "<>", false, 0 };
+    result = bracket_validate("<a><b></b></a>", 14, &custom, &report);
+    TEST_ASSERT(result == BRACKET_BALANCED, "Custom delimiter pairs accepted");
+    
+    custom.pairs = "(((";
+    result = bracket_validate("()", 2, &custom, &report);
+    TEST_ASSERT(result == BRACKET_ERROR_INVALID_INPUT, "Invalid pair specification rejected");
+    TEST_ASSERT(bracket_validate(NULL, 4, NULL, NULL) == BRACKET_ERROR_INVALID_INPUT, "Null input rejected");
+}
+
+/**
+ * @brief Tests inline small-buffer storage and growth to the heap
+ */
+static void test_dynamic_stack_reserve(void) {
+    TEST_SECTION("Dynamic Stack Small-Buffer/Reserve Tests");
+    
+    Stack* stack = stack_create(4);
+    TEST_ASSERT(stack != NULL, "Create small stack");
+    
+    for (int i = 0; i < 4; i++) {
+        stack_push(stack, i * 10);
+    }
+    TEST_ASSERT(stack_push(stack, 40) == STACK_ERROR_OVERFLOW, "Small stack still bounded by capacity");
+    
+    /* Grow past the inline capacity */
+    StackResult result = stack_reserve(stack, STACK_INLINE_CAPACITY + 8);
+    TEST_ASSERT(result == STACK_SUCCESS, "Reserve beyond inline capacity");
+    TEST_ASSERT(stack_capacity(stack) == STACK_INLINE_CAPACITY + 8, "Capacity updated after reserve");
+    TEST_ASSERT(stack_size(stack) == 4, "Size preserved across reserve");
+    
+    for (int i = 4; i < STACK_INLINE_CAPACITY + 8; i++) {
+        stack_push(stack, i * 10);
+    }
+    TEST_ASSERT(stack_is_full(stack), "Grown stack fills to new capacity");
+    
+    int value;
+    bool ordered = true;
+    for (int i = STACK_INLINE_CAPACITY + 7; i >= 0; i--) {
+        stack_pop(stack, &value);
+        ordered = ordered && value == i * 10;
+    }
+    TEST_ASSERT(ordered, "Contents preserved in LIFO order after move to heap");
+    
+    TEST_ASSERT(stack_reserve(stack, 2) == STACK_SUCCESS, "Shrinking reserve is a no-op");
+    TEST_ASSERT(stack_capacity(stack) == STACK_INLINE_CAPACITY + 8, "Capacity unchanged by no-op reserve");
+    TEST_ASSERT(stack_reserve(stack, STACK_MAX_CAPACITY + 1) == STACK_ERROR_INVALID_CAPACITY,
+                "Reserve beyond maximum capacity fails");
+    TEST_ASSERT(stack_reserve(NULL, 10) == STACK_ERROR_NULL_POINTER, "Reserve null stack fails");
+    
+    stack_destroy(stack);
+    
+    /* A large-capacity stack starts inline and moves on its first push past it */
+    stack = stack_create(STACK_DEFAULT_CAPACITY);
+    for (int i = 0; i < STACK_DEFAULT_CAPACITY; i++) {
+        stack_push(stack, i * 3);
+    }
+    TEST_ASSERT(stack_is_full(stack) && stack_push(stack, 0) == STACK_ERROR_OVERFLOW,
+                "Default-capacity stack fills past inline storage");
+    ordered = true;
+    for (int i = STACK_DEFAULT_CAPACITY - 1; i >= 0; i--) {
+        ordered = ordered && stack_pop(stack, &value) == STACK_SUCCESS && value == i * 3;
+    }
+    TEST_ASSERT(ordered, "Contents preserved across the move out of inline storage");
+    stack_destroy(stack);
+    
+    /* Reserving while inline only raises the limit */
+    stack = stack_create(2);
+    stack_push(stack, 1);
+    stack_push(stack, 2);
+    TEST_ASSERT(stack_reserve(stack, 64) == STACK_SUCCESS && stack_capacity(stack) == 64, "Reserve while inline");
+    for (int i = 3; i <= 64; i++) {
+        stack_push(stack, i);
+    }
+    TEST_ASSERT(stack_size(stack) == 64 && stack_peek(stack, &value) == STACK_SUCCESS && value == 64 &&
+                stack_data(stack)[2] == 3 && stack_data(stack)[1] == 2, "Pushes after inline reserve fill the new capacity");
+    stack_destroy(stack);
+}
+
+/**
+ * @brief Tests compile-time-sized character stacks with heap spill
+ */
+static void test_sized_char_stack(void) {
+    TEST_SECTION("Sized Character Stack Tests");
+    
+    CHAR_STACK_DEFINE(small, 8, CHAR_STACK_SPILL_NONE);
+    TEST_ASSERT(sized_char_stack_capacity(&small) == 8, "Sized stack has declared capacity");
+    
+    CharStackResult result = CHAR_STACK_SUCCESS;
+    for (int i = 0; i < 8; i++) {
+        result = sized_char_stack_push(&small, (char)('a' + i));
+    }
+    TEST_ASSERT(result == CHAR_STACK_SUCCESS, "Fill sized stack to capacity");
+    result = sized_char_stack_push(&small, 'z');
+    TEST_ASSERT(result == CHAR_STACK_ERROR_OVERFLOW, "Non-spilling stack overflows");
+    
+    char c;
+    sized_char_stack_pop(&small, &c);
+    TEST_ASSERT(c == 'h', "Sized stack pops in LIFO order");
+    TEST_ASSERT(!sized_char_stack_is_spilled(&small), "Non-spilling stack stays inline");
+    
+    /* Short strings stay inline; long ones spill instead of failing */
+    CHAR_STACK_DEFINE(spill, 16, CHAR_STACK_SPILL_HEAP);
+    char output[1024];
+    result = sized_char_stack_reverse_string(&spill, "Hello", output, sizeof(output));
+    TEST_ASSERT(result == CHAR_STACK_SUCCESS && strcmp(output, "olleH") == 0, "Short string reversed inline");
+    TEST_ASSERT(!sized_char_stack_is_spilled(&spill), "Short string does not allocate");
+    
+    char long_input[600];
+    memset(long_input, 'x', sizeof(long_input) - 1);
+    long_input[0] = 'A';
+    long_input[sizeof(long_input) - 1] = '\0';
+    result = sized_char_stack_reverse_string(&spill, long_input, output, sizeof(output));
+    TEST_ASSERT(result == CHAR_STACK_SUCCESS, "String beyond 256 characters reversed");
+    TEST_ASSERT(strlen(output) == sizeof(long_input) - 1 && output[sizeof(long_input) - 2] == 'A',
+                "Long string reversed correctly");
+    TEST_ASSERT(sized_char_stack_is_spilled(&spill), "Long string spilled to heap");
+    
+    sized_char_stack_release(&spill);
+    TEST_ASSERT(!sized_char_stack_is_spilled(&spill), "Release returns to inline storage");
+    TEST_ASSERT(sized_char_stack_capacity(&spill) == 16, "Release restores inline capacity");
+    
+    result = sized_char_stack_reverse_string(&small, long_input, output, sizeof(output));
+    TEST_ASSERT(result == CHAR_STACK_ERROR_OVERFLOW, "Long string overflows non-spilling stack");
+    TEST_ASSERT(sized_char_stack_push(NULL, 'a') == CHAR_STACK_ERROR_INVALID_INPUT, "Push to null sized stack fails");
+}
+
+/**
+ * @brief Tests aligned, huge-page and NUMA placement options
+ */
+static void test_dynamic_stack_options(void) {
+    TEST_SECTION("Dynamic Stack Placement Options Tests");
+    
+    StackOptions options;
+    stack_options_init(&options);
+    TEST_ASSERT(options.alignment == 0 && !options.pad_header &&
+                options.huge_pages == STACK_HUGE_PAGES_NEVER &&
+                options.numa_node == STACK_NUMA_NODE_ANY, "Options initialize to defaults");
+    
+    options.alignment = STACK_CACHE_LINE_SIZE;
+    options.pad_header = true;
+    Stack* stack = stack_create_with_options(8, &options);
+    TEST_ASSERT(stack != NULL, "Create cache-line aligned stack");
+    TEST_ASSERT(((uintptr_t)stack % STACK_CACHE_LINE_SIZE) == 0, "Padded header starts a cache line");
+    
+    for (int i = 0; i < 8; i++) {
+        stack_push(stack, i);
+    }
+    TEST_ASSERT(stack_reserve(stack, 100) == STACK_SUCCESS, "Reserve keeps aligned placement");
+    int value;
+    stack_pop(stack, &value);
+    TEST_ASSERT(value == 7 && stack_size(stack) == 7, "Aligned stack keeps LIFO order across reserve");
+    stack_destroy(stack);
+    
+    /* Huge pages are advisory; creation succeeds with or without kernel support */
+    stack_options_init(&options);
+    options.huge_pages = STACK_HUGE_PAGES_AUTO;
+    size_t large = STACK_HUGE_PAGE_SIZE / sizeof(int);
+    stack = stack_create_with_options(large, &options);
+    TEST_ASSERT(stack != NULL, "Create huge-page backed stack");
+    bool all_pushed = true;
+    for (size_t i = 0; i < large; i++) {
+        all_pushed = all_pushed && stack_push(stack, (int)i) == STACK_SUCCESS;
+    }
+    TEST_ASSERT(all_pushed && stack_is_full(stack), "Huge-page stack fills to capacity");
+    stack_pop(stack, &value);
+    TEST_ASSERT(value == (int)(large - 1), "Huge-page stack pops last value");
+    stack_destroy(stack);
+    
+    stack_options_init(&options);
+    options.alignment = 48;
+    TEST_ASSERT(stack_create_with_options(8, &options) == NULL, "Non power-of-two alignment rejected");
+    stack_options_init(&options);
+    options.numa_node = -2;
+    TEST_ASSERT(stack_create_with_options(8, &options) == NULL, "Invalid NUMA node rejected");
+}
+
+/* Bump allocator state for the allocator hook tests */
+typedef struct {
+    unsigned char buffer[4096];
+    size_t used;
+    size_t allocations;
+    size_t frees;
+    bool fail;              /* Refuse every request once set */
+} TestArena;
+
+static void* test_arena_allocate(void* context, size_t size, size_t alignment) {
+    TestArena* arena = context;
+    size_t start = (arena->used + alignment - 1) & ~(alignment - 1);
+    if (arena->fail || start + size > sizeof(arena->buffer)) {
+        return NULL;
+    }
+    arena->used = start + size;
+    arena->allocations++;
+    return arena->buffer + start;
+}
+
+static void test_arena_deallocate(void* context, void* ptr, size_t size) {
+    TestArena* arena = context;
+    (void)ptr;
+    (void)size;
+    arena->frees++;
+}
+
+/**
+ * @brief Tests pluggable allocator hooks
+ */
+static void test_dynamic_stack_allocator(void) {
+    TEST_SECTION("Dynamic Stack Allocator Hook Tests");
+    
+    static TestArena arena;
+    memset(&arena, 0, sizeof(arena));
+    StackAllocator allocator = { test_arena_allocate, NULL, test_arena_deallocate, &arena };
+    
+    Stack* stack = stack_create_with_allocator(32, NULL, &allocator);
+    TEST_ASSERT(stack != NULL, "Create stack from bump allocator");
+    TEST_ASSERT((unsigned char*)stack >= arena.buffer &&
+                (unsigned char*)stack < arena.buffer + sizeof(arena.buffer), "Header comes from the arena");
+    
+    /* Elements start inline and move to the hooks when the stack outgrows them */
+    size_t allocations = arena.allocations;
+    for (int i = 0; i < STACK_INLINE_CAPACITY; i++) {
+        stack_push(stack, i);
+    }
+    TEST_ASSERT(arena.allocations == allocations, "No element allocation while elements fit inline");
+    arena.fail = true;
+    TEST_ASSERT(STACK_INLINE_CAPACITY == 0 || stack_push(stack, STACK_INLINE_CAPACITY) == STACK_ERROR_MEMORY_ALLOCATION,
+                "Failed move out of inline storage reports memory allocation error");
+    TEST_ASSERT(stack_size(stack) == STACK_INLINE_CAPACITY, "Failed move leaves stack intact");
+    arena.fail = false;
+    for (int i = STACK_INLINE_CAPACITY; i < 32; i++) {
+        stack_push(stack, i);
+    }
+    TEST_ASSERT(STACK_INLINE_CAPACITY == 0 || arena.allocations == allocations + 1,
+                "Elements allocated through hooks once, on outgrowing inline storage");
+    
+    /* Growth without a reallocate hook allocates, copies and frees */
+    allocations = arena.allocations;
+    TEST_ASSERT(stack_reserve(stack, 64) == STACK_SUCCESS, "Reserve through allocator hooks");
+    TEST_ASSERT(arena.allocations > allocations, "Growth allocated through hooks");
+    int value;
+    stack_pop(stack, &value);
+    TEST_ASSERT(value == 31, "Contents preserved across hooked growth");
+    
+    /* A failing allocator surfaces as a memory allocation error */
+    arena.fail = true;
+    TEST_ASSERT(stack_reserve(stack, 128) == STACK_ERROR_MEMORY_ALLOCATION,
+                "Failed growth reports memory allocation error");
+    TEST_ASSERT(stack_capacity(stack) == 64 && stack_size(stack) == 31, "Failed growth leaves stack intact");
+    stack_pop(stack, &value);
+    TEST_ASSERT(value == 30, "Stack usable after failed growth");
+    TEST_ASSERT(stack_create_with_allocator(8, NULL, &allocator) == NULL,
+                "Create fails when allocator refuses");
+    
+    stack_destroy(stack);
+    TEST_ASSERT(arena.frees == arena.allocations, "Every hooked allocation freed through hooks");
+    
+    StackAllocator incomplete = { NULL, NULL, test_arena_deallocate, &arena };
+    TEST_ASSERT(stack_create_with_allocator(8, NULL, &incomplete) == NULL, "Allocator without allocate rejected");
+}
+
+/**
+ * @brief Tests word-order reversal
+ */
+static void test_word_reverse(void) {
+    TEST_SECTION("Word Reversal Tests");
+    
+    char output[256];
+    size_t length = 0;
+    
+    const char* sentence = "the quick brown fox";
+    WordReverseResult result = word_reverse(sentence, strlen(sentence), output, sizeof(output), NULL, &length);
+    TEST_ASSERT(result == WORD_REVERSE_SUCCESS, "Reverse simple sentence");
+    TEST_ASSERT(strcmp(output, "fox brown quick the") == 0, "Word order reversed, words intact");
+    TEST_ASSERT(length == strlen(sentence), "Uncollapsed output keeps input length");
+    
+    const char* spaced = "  a  bc\td ";
+    word_reverse(spaced, strlen(spaced), output, sizeof(output), NULL, NULL);
+    TEST_ASSERT(strcmp(output, " d\tbc  a  ") == 0, "Whitespace runs reversed with the words");
+    
+    WordReverseOptions collapse = { NULL, true };
+    word_reverse(spaced, strlen(spaced), output, sizeof(output), &collapse, &length);
+    TEST_ASSERT(strcmp(output, "d bc a") == 0 && length == 6, "Collapse drops edges and joins with one delimiter");
+    
+    WordReverseOptions csv = { ",;", true };
+    const char* fields = "x,,y;z";
+    word_reverse(fields, strlen(fields), output, sizeof(output), &csv, NULL);
+    TEST_ASSERT(strcmp(output, "z,y,x") == 0, "Custom delimiters honoured");
+    
+    word_reverse("   ", 3, output, sizeof(output), &collapse, &length);
+    TEST_ASSERT(length == 0 && output[0] == '\0', "Delimiters only collapse to empty");
+    word_reverse("", 0, output, sizeof(output), NULL, &length);
+    TEST_ASSERT(length == 0 && output[0] == '\0', "Empty input gives empty output");
+    
+    /* Long input crosses SIMD blocks and several span stack flushes */
+    size_t long_length = 30000;
+    char* text = malloc(long_length + 1);
+    char* reversed = malloc(long_length + 1);
+    char* restored = malloc(long_length + 1);
+    if (text && reversed && restored) {
+        for (size_t i = 0; i < long_length; i++) {
+            text[i] = (i % 7 == 3 || i % 11 == 0) ? ' ' : (char)('a' + i % 26);
+        }
+        word_reverse(text, long_length, reversed, long_length + 1, NULL, NULL);
+        word_reverse(reversed, long_length, restored, long_length + 1, NULL, NULL);
+        TEST_ASSERT(memcmp(text, restored, long_length) == 0, "Reversing twice restores long input");
+    }
+    free(text);
+    free(reversed);
+    free(restored);
+    
+    TEST_ASSERT(word_reverse(sentence, strlen(sentence), output, 5, NULL, NULL) == WORD_REVERSE_ERROR_BUFFER_TOO_SMALL,
+                "Small output buffer rejected");
+    WordReverseOptions empty = { "", false };
+    TEST_ASSERT(word_reverse(sentence, 3, output, sizeof(output), &empty, NULL) == WORD_REVERSE_ERROR_INVALID_DELIMITERS,
+                "Empty delimiter set rejected");
+    TEST_ASSERT(word_reverse(NULL, 0, output, sizeof(output), NULL, NULL) == WORD_REVERSE_ERROR_NULL_POINTER,
+                "Null input rejected");
+}
+
+/**
+ * @brief Tests palindrome and mirror-equality detection
+ */
+static void test_palindrome(void) {
+    TEST_SECTION("Palindrome Detection Tests");
+    
+    TEST_ASSERT(palindrome_check("racecar", 7, PALINDROME_EXACT), "Odd-length palindrome detected");
+    TEST_ASSERT(palindrome_check("abba", 4, PALINDROME_EXACT), "Even-length palindrome detected");
+    TEST_ASSERT(!palindrome_check("abca", 4, PALINDROME_EXACT), "Non-palindrome rejected");
+    TEST_ASSERT(palindrome_check("", 0, PALINDROME_EXACT) && palindrome_check("x", 1, PALINDROME_EXACT),
+                "Empty and single-byte strings are palindromes");
+    TEST_ASSERT(!palindrome_check("Racecar", 7, PALINDROME_EXACT), "Exact mode is case-sensitive");
+    TEST_ASSERT(palindrome_check("Racecar", 7, PALINDROME_FOLD_CASE), "Case folding ignores letter case");
+    
+    const char* panama = "A man, a plan, a canal: Panama!";
+    TEST_ASSERT(!palindrome_check(panama, strlen(panama), PALINDROME_FOLD_CASE), "Punctuation counts unless skipped");
+    TEST_ASSERT(palindrome_check(panama, strlen(panama), PALINDROME_NATURAL), "Natural mode skips punctuation and spaces");
+    TEST_ASSERT(palindrome_check(" ,. ", 4, PALINDROME_NATURAL), "Only skipped characters is a palindrome");
+    
+    /* Long inputs exercise the block compares, including the overlapping final one */
+    char buffer[101];
+    for (size_t i = 0; i < 50; i++) {
+        buffer[i] = (char)('a' + i % 26);
+        buffer[99 - i] = buffer[i];
+    }
+    buffer[100] = '\0';
+    bool all_lengths = true;
+    for (size_t trim = 0; trim < 40; trim++) {
+        all_lengths = all_lengths && palindrome_check(buffer + trim, 100 - 2 * trim, PALINDROME_EXACT);
+    }
+    TEST_ASSERT(all_lengths, "Block compares accept palindromes of many lengths");
+    buffer[40] = '#';
+    TEST_ASSERT(!palindrome_check(buffer, 100, PALINDROME_EXACT), "Mismatch inside a block detected");
+    TEST_ASSERT(!palindrome_check(buffer, 100, PALINDROME_SKIP_PUNCTUATION),
+                "Skipping one side's punctuation still needs the rest to mirror");
+    
+    /* Char stack round trip agrees with the mirror compare */
+    char reversed[64];
+    char_stack_reverse_string("level", reversed, sizeof(reversed));
+    TEST_ASSERT(strcmp("level", reversed) == 0 && palindrome_check("level", 5, PALINDROME_EXACT),
+                "Mirror compare agrees with reverse and strcmp");
+    
+    const char* words[] = { "noon", "stack", "Madam", "a", "", "xyzzy", NULL };
+    uint64_t bitmap[PALINDROME_BITMAP_WORDS(7)];
+    PalindromeResult result = palindrome_check_batch(words, NULL, 7, PALINDROME_FOLD_CASE, bitmap);
+    TEST_ASSERT(result == PALINDROME_SUCCESS, "Batch check succeeds");
+    TEST_ASSERT(bitmap[0] == 0x1Du, "Batch bitmap marks palindromes, NULL entries clear");
+    
+    const char* many[70];
+    for (size_t i = 0; i < 70; i++) {
+        many[i] = (i % 3 == 0) ? "abcba" : "abcab";
+    }
+    uint64_t wide[PALINDROME_BITMAP_WORDS(70)];
+    palindrome_check_batch(many, NULL, 70, PALINDROME_EXACT, wide);
+    TEST_ASSERT(wide[0] == 0x9249249249249249ULL && wide[1] == 0x24u, "Batch bitmap spans multiple words");
+    TEST_ASSERT(palindrome_check_batch(NULL, NULL, 1, 0, wide) == PALINDROME_ERROR_NULL_POINTER,
+                "Batch rejects null strings array");
+}
+
+/* Shared state for the multi-threaded steal test */
+typedef struct {
+    WorkStealingDeque* deque;
+    unsigned char* seen;
+    atomic_size_t taken;
+    atomic_bool done;
+} StealContext;
+
+/**
+ * @brief Thief thread: steals until the owner is done and the deque is drained
+ */
+static void* steal_worker(void* argument) {
+    StealContext* context = argument;
+    void* item;
+    for (;;) {
+        StackResult result = ws_deque_steal(context->deque, &item);
+        if (result == STACK_SUCCESS) {
+            context->seen[*(int*)item]++;
+            atomic_fetch_add(&context->taken, 1);
+        } else if (result == STACK_ERROR_UNDERFLOW && atomic_load(&context->done)) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+/* Node of the recursive pool test */
+typedef struct {
+    int n;
+    long long result;
+} PoolFibTask;
+
+/**
+ * @brief Computes fib(n) by spawning one branch into the pool
+ */
+static void pool_fib_task(void* argument) {
+    PoolFibTask* task = argument;
+    if (task->n < 2) {
+        task->result = task->n;
+        return;
+    }
+    TaskGroup group = TASK_GROUP_INITIALIZER;
+    PoolFibTask left = { task->n - 1, 0 };
+    PoolFibTask right = { task->n - 2, 0 };
+    task_group_spawn(&group, pool_fib_task, &left);
+    pool_fib_task(&right);
+    task_group_wait(&group);
+    task->result = left.result + right.result;
+}
+
+/**
+ * @brief Test work-stealing deque and task pool
+ */
+static void test_work_stealing(void) {
+    TEST_SECTION("Work-Stealing Deque Tests");
+    
+    WorkStealingDeque* deque = ws_deque_create(0);
+    TEST_ASSERT(deque != NULL, "Deque creation");
+    
+    int values[100];
+    bool pushed = true;
+    for (int i = 0; i < 100; i++) {
+        values[i] = i;
+        pushed = pushed && ws_deque_push(deque, &values[i]) == STACK_SUCCESS;
+    }
+    TEST_ASSERT(pushed && ws_deque_size(deque) == 100, "Push grows past the initial capacity");
+    
+    void* item = NULL;
+    TEST_ASSERT(ws_deque_pop(deque, &item) == STACK_SUCCESS && item == &values[99], "Owner pops the newest item");
+    TEST_ASSERT(ws_deque_steal(deque, &item) == STACK_SUCCESS && item == &values[0], "Thief steals the oldest item");
+    
+    bool ordered = true;
+    for (int i = 98; i >= 1; i--) {
+        ordered = ordered && ws_deque_pop(deque, &item) == STACK_SUCCESS && item == &values[i];
+    }
+    TEST_ASSERT(ordered, "Remaining items pop in LIFO order");
+    TEST_ASSERT(ws_deque_pop(deque, &item) == STACK_ERROR_UNDERFLOW, "Pop from empty deque reports underflow");
+    TEST_ASSERT(ws_deque_steal(deque, &item) == STACK_ERROR_UNDERFLOW, "Steal from empty deque reports underflow");
+    TEST_ASSERT(ws_deque_push(deque, NULL) == STACK_ERROR_NULL_POINTER, "NULL item rejected");
+    
+    /* Owner pushes and pops while three thieves steal: every item is taken exactly once */
+    enum { STRESS_ITEMS = 20000, THIEVES = 3 };
+    int* items = malloc(STRESS_ITEMS * sizeof(int));
+    StealContext context;
+    context.deque = deque;
+    context.seen = calloc(STRESS_ITEMS, 1);
+    atomic_init(&context.taken, 0);
+    atomic_init(&context.done, false);
+    
+    pthread_t thieves[THIEVES];
+    for (int t = 0; t < THIEVES; t++) {
+        pthread_create(&thieves[t], NULL, steal_worker, &context);
+    }
+    for (int i = 0; i < STRESS_ITEMS; i++) {
+        items[i] = i;
+        ws_deque_push(deque, &items[i]);
+        if (i % 3 == 0 && ws_deque_pop(deque, &item) == STACK_SUCCESS) {
+            context.seen[*(int*)item]++;
+            atomic_fetch_add(&context.taken, 1);
+        }
+    }
+    while (ws_deque_pop(deque, &item) == STACK_SUCCESS) {
+        context.seen[*(int*)item]++;
+        atomic_fetch_add(&context.taken, 1);
+    }
+    atomic_store(&context.done, true);
+    for (int t = 0; t < THIEVES; t++) {
+        pthread_join(thieves[t], NULL);
+    }
+    
+    bool exactly_once = atomic_load(&context.taken) == STRESS_ITEMS;
+    for (int i = 0; i < STRESS_ITEMS; i++) {
+        exactly_once = exactly_once && context.seen[i] == 1;
+    }
+    TEST_ASSERT(exactly_once, "Concurrent pop and steal take every item exactly once");
+    free(context.seen);
+    free(items);
+    ws_deque_destroy(deque);
+    
+    TaskPool* pool = task_pool_create(4);
+    TEST_ASSERT(pool != NULL && task_pool_thread_count(pool) == 4, "Task pool creation");
+    
+    TaskGroup outside = TASK_GROUP_INITIALIZER;
+    TEST_ASSERT(task_group_spawn(&outside, pool_fib_task, NULL) == STACK_ERROR_UNSUPPORTED,
+                "Spawn outside a pool task rejected");
+    
+    PoolFibTask root = { 20, 0 };
+    TEST_ASSERT(task_pool_run(pool, pool_fib_task, &root) == STACK_SUCCESS && root.result == 6765,
+                "Recursive tasks compute fib(20)");
+    
+    TaskPoolStats stats;
+    task_pool_get_stats(pool, &stats);
+    TEST_ASSERT(stats.executed == 10945, "Pool ran every spawned task");
+    
+    root.result = 0;
+    TEST_ASSERT(task_pool_run(pool, pool_fib_task, &root) == STACK_SUCCESS && root.result == 6765,
+                "Pool can be reused for another run");
+    task_pool_destroy(pool);
+}
+
+/**
+ * @brief Compiles source and evaluates it on one input vector
+ */
+static StackVmResult vm_evaluate(const char* source, StackVmSyntax syntax, const int* inputs,
+                                 size_t input_count, int* value) {
+    StackVmProgram* program;
+    StackVmResult result = stack_vm_compile(source, strlen(source), syntax, &program, NULL);
+    if (result == STACK_VM_SUCCESS) {
+        result = stack_vm_run_batch(program, inputs, input_count, 1, value, NULL);
+        stack_vm_destroy(program);
+    }
+    return result;
+}
+
+/**
+ * @brief Test bytecode stack virtual machine
+ */
+static void test_stack_vm(void) {
+    TEST_SECTION("Stack VM Tests");
+    
+    int inputs[4] = { 10, 3, -7, 1000 };
+    int value = 0;
+    
+    TEST_ASSERT(vm_evaluate("$0 $1 - $2 *", STACK_VM_SYNTAX_RPN, inputs, 4, &value) == STACK_VM_SUCCESS &&
+                value == -49, "RPN program with inputs");
+    TEST_ASSERT(vm_evaluate("$0 $1 / $0 $1 % max $3 dup * neg min", STACK_VM_SYNTAX_RPN, inputs, 4, &value) ==
+                STACK_VM_SUCCESS && value == -1000000, "RPN division, remainder, min, max, dup and neg");
+    TEST_ASSERT(vm_evaluate("($0 + $1) * ($2 - 3) / ($3 % 7 + 1)", STACK_VM_SYNTAX_INFIX, inputs, 4, &value) ==
+                STACK_VM_SUCCESS && value == -18, "Infix precedence and parentheses");
+    TEST_ASSERT(vm_evaluate("2 - 3 - 4 * -$1", STACK_VM_SYNTAX_INFIX, inputs, 4, &value) == STACK_VM_SUCCESS &&
+                value == 11, "Infix left associativity and unary minus");
+    TEST_ASSERT(vm_evaluate("2147483647 1 +", STACK_VM_SYNTAX_RPN, NULL, 0, &value) == STACK_VM_SUCCESS &&
+                value == INT_MIN, "Arithmetic wraps on overflow");
+    
+    StackVmProgram* program = NULL;
+    const char* folded = "(1 + 2) * 3 - -4";
+    TEST_ASSERT(stack_vm_compile(folded, strlen(folded), STACK_VM_SYNTAX_INFIX, &program, NULL) == STACK_VM_SUCCESS &&
+                stack_vm_instruction_count(program) == 1, "Constant expression folds to one push");
+    stack_vm_destroy(program);
+    
+    size_t offset = 0;
+    TEST_ASSERT(stack_vm_compile("1 2 + +", 7, STACK_VM_SYNTAX_RPN, &program, &offset) == STACK_VM_ERROR_UNDERFLOW &&
+                offset == 6, "Operand underflow rejected at compile time");
+    TEST_ASSERT(stack_vm_compile("(1 + 2", 6, STACK_VM_SYNTAX_INFIX, &program, &offset) == STACK_VM_ERROR_SYNTAX,
+                "Unclosed parenthesis rejected");
+    TEST_ASSERT(stack_vm_compile("1 $x", 4, STACK_VM_SYNTAX_RPN, &program, &offset) == STACK_VM_ERROR_SYNTAX &&
+                offset == 2, "Bad token reported with its offset");
+    TEST_ASSERT(stack_vm_compile("", 0, STACK_VM_SYNTAX_RPN, &program, NULL) == STACK_VM_ERROR_SYNTAX,
+                "Empty program rejected");
+    
+    char deep[2 * (STACK_VM_MAX_DEPTH + 1) + 1];
+    for (size_t i = 0; i <= STACK_VM_MAX_DEPTH; i++) {
+        deep[2 * i] = '$';
+        deep[2 * i + 1] = '0';
+    }
+    deep[sizeof(deep) - 1] = '\0';
+    for (size_t i = 2; i < sizeof(deep) - 1; i += 2) {
+        deep[i] = ' ';
+        deep[i + 1] = '1';
+    }
+    TEST_ASSERT(stack_vm_compile(deep, strlen(deep), STACK_VM_SYNTAX_RPN, &program, NULL) == STACK_VM_ERROR_TOO_DEEP,
+                "Program deeper than STACK_VM_MAX_DEPTH rejected");
+    
+    TEST_ASSERT(vm_evaluate("$0 $1 0 * /", STACK_VM_SYNTAX_RPN, inputs, 4, &value) == STACK_VM_ERROR_DIVISION_BY_ZERO,
+                "Division by zero reported at run time");
+    TEST_ASSERT(vm_evaluate("$5", STACK_VM_SYNTAX_RPN, inputs, 4, &value) == STACK_VM_ERROR_MISSING_INPUT,
+                "Reading a missing input rejected");
+    
+    /* stack_vm_run pushes every value left behind, bottom-most first */
+    Stack* stack = stack_create(3);
+    stack_vm_compile("1 $0 300 *", 10, STACK_VM_SYNTAX_RPN, &program, NULL);
+    int top = 0;
+    int below = 0;
+    TEST_ASSERT(stack_vm_run(program, inputs, 1, stack) == STACK_VM_SUCCESS && stack_size(stack) == 2 &&
+                stack_pop(stack, &top) == STACK_SUCCESS && stack_pop(stack, &below) == STACK_SUCCESS &&
+                top == 3000 && below == 1, "Run pushes results onto the Stack");
+    stack_push(stack, 0);
+    stack_push(stack, 0);
+    TEST_ASSERT(stack_vm_run(program, inputs, 1, stack) == STACK_VM_ERROR_STACK_FULL && stack_size(stack) == 2,
+                "Run without room for results pushes nothing");
+    stack_vm_destroy(program);
+    stack_destroy(stack);
+    
+    /* Batch mode over many vectors */
+    int vectors[6] = { 1, 2, 3, 4, 5, 0 };
+    int results[3] = { 0, 0, 0 };
+    size_t failed = 0;
+    stack_vm_compile("$0 / $1", 7, STACK_VM_SYNTAX_INFIX, &program, NULL);
+    TEST_ASSERT(stack_vm_run_batch(program, vectors, 2, 2, results, NULL) == STACK_VM_SUCCESS &&
+                results[0] == 0 && results[1] == 0, "Batch evaluates each vector");
+    vectors[0] = 9;
+    TEST_ASSERT(stack_vm_run_batch(program, vectors, 2, 3, results, &failed) == STACK_VM_ERROR_DIVISION_BY_ZERO &&
+                failed == 2 && results[0] == 4, "Batch stops at the first failing vector");
+    stack_vm_destroy(program);
+}
+
+/**
+ * @brief Test fused reverse-and-transform kernels
+ */
+static void test_reverse_transform(void) {
+    TEST_SECTION("Fused Reverse-and-Transform Tests");
+    
+    char output[128];
+    size_t length = 0;
+    const char* text = "Hello, World! 123 abcXYZ";
+    size_t text_length = strlen(text);
+    
+    TEST_ASSERT(reverse_transform(text, text_length, output, sizeof(output), NULL, &length) == REVERSE_TRANSFORM_SUCCESS &&
+                length == text_length && strcmp(output, "ZYXcba 321 !dlroW ,olleH") == 0, "Plain reversal");
+    
+    ReverseTransform upper = { REVERSE_TRANSFORM_UPPER, 0, NULL };
+    TEST_ASSERT(reverse_transform(text, text_length, output, sizeof(output), &upper, NULL) == REVERSE_TRANSFORM_SUCCESS &&
+                strcmp(output, "ZYXCBA 321 !DLROW ,OLLEH") == 0, "Reverse with upper case");
+    
+    ReverseTransform lower = { REVERSE_TRANSFORM_LOWER, 0, NULL };
+    TEST_ASSERT(reverse_transform(text, text_length, output, sizeof(output), &lower, NULL) == REVERSE_TRANSFORM_SUCCESS &&
+                strcmp(output, "zyxcba 321 !dlrow ,olleh") == 0, "Reverse with lower case");
+    
+    /* Control bytes inside and outside the SIMD blocks */
+    const char noisy[] = "ab\x01" "cdefghijklmnop\x7f" "qrstuvwxyz\t0123456789\x80" "ABC";
+    size_t noisy_length = sizeof(noisy) - 1;
+    ReverseTransform filter = { REVERSE_TRANSFORM_FILTER, 0, NULL };
+    TEST_ASSERT(reverse_transform(noisy, noisy_length, output, sizeof(output), &filter, &length) == REVERSE_TRANSFORM_SUCCESS &&
+                length == noisy_length - 3 && strcmp(output, "CBA9876543210\tzyxwvutsrqponmlkjihgfedcba") == 0,
+                "Reverse with non-printables dropped");
+    
+    ReverseTransform replace = { REVERSE_TRANSFORM_REPLACE, '?', NULL };
+    TEST_ASSERT(reverse_transform(noisy, noisy_length, output, sizeof(output), &replace, &length) == REVERSE_TRANSFORM_SUCCESS &&
+                length == noisy_length && strcmp(output, "CBA?9876543210\tzyxwvutsrq?ponmlkjihgfedc?ba") == 0,
+                "Reverse with non-printables replaced");
+    
+    unsigned char rot13[256];
+    for (int i = 0; i < 256; i++) {
+        rot13[i] = (unsigned char)(i >= 'a' && i <= 'z' ? 'a' + (i - 'a' + 13) % 26 : i);
+    }
+    ReverseTransform map = { REVERSE_TRANSFORM_MAP, 0, rot13 };
+    TEST_ASSERT(reverse_transform("hello", 5, output, sizeof(output), &map, NULL) == REVERSE_TRANSFORM_SUCCESS &&
+                strcmp(output, "byyru") == 0, "Reverse through a byte map");
+    
+    map.map = NULL;
+    TEST_ASSERT(reverse_transform("x", 1, output, sizeof(output), &map, NULL) == REVERSE_TRANSFORM_ERROR_INVALID_TRANSFORM,
+                "Map transform without a table rejected");
+    TEST_ASSERT(reverse_transform(text, text_length, output, text_length, NULL, NULL) == REVERSE_TRANSFORM_ERROR_BUFFER_TOO_SMALL,
+                "Output without room for the terminator rejected");
+    TEST_ASSERT(reverse_transform("", 0, output, 1, &filter, &length) == REVERSE_TRANSFORM_SUCCESS &&
+                length == 0 && output[0] == '\0', "Empty input");
+    TEST_ASSERT(reverse_transform(NULL, 0, output, 1, NULL, NULL) == REVERSE_TRANSFORM_ERROR_NULL_POINTER,
+                "NULL input rejected");
+}
+
+/**
+ * @brief Thread body that fills its own shard of a sharded stack
+ */
+static void* sharded_fill_worker(void* argument) {
+    ShardedStack* stack = argument;
+    for (int i = 1; i <= 100; i++) {
+        sharded_stack_push(stack, i);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Thread body that recycles items and checks none are lost
+ */
+static void* sharded_recycle_worker(void* argument) {
+    ShardedStack* stack = argument;
+    for (int i = 0; i < 20000; i++) {
+        int value;
+        if (sharded_stack_pop(stack, &value) == STACK_SUCCESS) {
+            sharded_stack_push(stack, value);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Test sharded stack pool
+ */
+static void test_sharded_stack(void) {
+    TEST_SECTION("Sharded Stack Tests");
+    
+    ShardedStack* stack = sharded_stack_create(4, 128);
+    TEST_ASSERT(stack != NULL && sharded_stack_shard_count(stack) == 4, "Sharded stack creation");
+    
+    int value = 0;
+    TEST_ASSERT(sharded_stack_pop(stack, &value) == STACK_ERROR_UNDERFLOW, "Pop from empty sharded stack");
+    TEST_ASSERT(sharded_stack_push(stack, 1) == STACK_SUCCESS && sharded_stack_push(stack, 2) == STACK_SUCCESS &&
+                sharded_stack_pop(stack, &value) == STACK_SUCCESS && value == 2, "Own shard pops LIFO");
+    sharded_stack_pop(stack, &value);
+    
+    /* Another thread fills its shard; this thread's shard is empty, so it must steal */
+    pthread_t filler;
+    pthread_create(&filler, NULL, sharded_fill_worker, stack);
+    pthread_join(filler, NULL);
+    TEST_ASSERT(sharded_stack_size_approx(stack) == 100, "Size approximation counts all shards");
+    
+    long long sum = 0;
+    int popped = 0;
+    while (sharded_stack_pop(stack, &value) == STACK_SUCCESS) {
+        sum += value;
+        popped++;
+    }
+    TEST_ASSERT(popped == 100 && sum == 5050, "Empty shard steals every item from another shard");
+    TEST_ASSERT(sharded_stack_steal_count(stack) > 1, "Steals move items in batches");
+    sharded_stack_destroy(stack);
+    
+    /* Full shards spill to their neighbours before reporting overflow */
+    stack = sharded_stack_create(2, 3);
+    bool spilled = true;
+    for (int i = 0; i < 6; i++) {
+        spilled = spilled && sharded_stack_push(stack, i) == STACK_SUCCESS;
+    }
+    TEST_ASSERT(spilled && sharded_stack_push(stack, 6) == STACK_ERROR_OVERFLOW, "Push spills until every shard is full");
+    sharded_stack_destroy(stack);
+    
+    /* Concurrent recycling neither loses nor duplicates items */
+    stack = sharded_stack_create(4, 256);
+    for (int i = 1; i <= 200; i++) {
+        sharded_stack_push(stack, i);
+    }
+    pthread_t workers[4];
+    for (int t = 0; t < 4; t++) {
+        pthread_create(&workers[t], NULL, sharded_recycle_worker, stack);
+    }
+    for (int t = 0; t < 4; t++) {
+        pthread_join(workers[t], NULL);
+    }
+    sum = 0;
+    popped = 0;
+    while (sharded_stack_pop(stack, &value) == STACK_SUCCESS) {
+        sum += value;
+        popped++;
+    }
+    TEST_ASSERT(popped == 200 && sum == 20100, "Concurrent pop/push conserves every item");
+    sharded_stack_destroy(stack);
+}
+
+/**
+ * @brief Thread body that pops one value from a blocking stack and stores it
+ */
+static void* blocking_pop_worker(void* argument) {
+    BlockingStack* stack = argument;
+    int value = 0;
+    blocking_stack_pop_wait(stack, &value);
+    return (void*)(intptr_t)value;
+}
+
+/**
+ * @brief Thread body that pushes 1..1000 through a blocking stack in batches
+ */
+static void* blocking_produce_worker(void* argument) {
+    BlockingStack* stack = argument;
+    int batch[10];
+    for (int i = 0; i < 100; i++) {
+        for (int j = 0; j < 10; j++) {
+            batch[j] = i * 10 + j + 1;
+        }
+        blocking_stack_push_many(stack, batch, 10);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Thread body that pops 250 values from a blocking stack and returns their sum
+ */
+static void* blocking_consume_worker(void* argument) {
+    BlockingStack* stack = argument;
+    intptr_t sum = 0;
+    for (int i = 0; i < 250; i++) {
+        int value = 0;
+        blocking_stack_pop_wait(stack, &value);
+        sum += value;
+    }
+    return (void*)sum;
+}
+
+/**
+ * @brief Test bounded blocking stack
+ */
+static void test_blocking_stack(void) {
+    TEST_SECTION("Blocking Stack Tests");
+    
+    TEST_ASSERT(blocking_stack_create(0) == NULL, "Zero-capacity blocking stack rejected");
+    BlockingStack* stack = blocking_stack_create(4);
+    TEST_ASSERT(stack != NULL && blocking_stack_capacity(stack) == 4, "Blocking stack creation");
+    
+    int value = 0;
+    struct timespec before, after;
+    timespec_get(&before, TIME_UTC);
+    StackResult result = blocking_stack_pop_timed(stack, &value, 20000000);
+    timespec_get(&after, TIME_UTC);
+    double waited = (double)(after.tv_sec - before.tv_sec) + (double)(after.tv_nsec - before.tv_nsec) / 1e9;
+    TEST_ASSERT(result == STACK_ERROR_TIMEOUT && waited >= 0.019, "Timed pop on empty stack waits, then times out");
+    
+    bool filled = true;
+    for (int i = 1; i <= 4; i++) {
+        filled = filled && blocking_stack_push_timed(stack, i, 0) == STACK_SUCCESS;
+    }
+    TEST_ASSERT(filled && blocking_stack_push_timed(stack, 5, 0) == STACK_ERROR_TIMEOUT, "Zero timeout push on full stack fails at once");
+    TEST_ASSERT(blocking_stack_pop_timed(stack, &value, 0) == STACK_SUCCESS && value == 4, "Blocking stack pops LIFO");
+    
+    int drained[8];
+    size_t popped = 0;
+    TEST_ASSERT(blocking_stack_pop_many(stack, drained, 8, &popped) == STACK_SUCCESS && popped == 3 &&
+                drained[0] == 3 && drained[2] == 1 && blocking_stack_size(stack) == 0, "Pop many takes what is available");
+    
+    /* Transfers with no one waiting never issue a wake call */
+    bool paired = true;
+    for (int i = 0; i < 1000; i++) {
+        paired = paired && blocking_stack_push_wait(stack, i) == STACK_SUCCESS &&
+                 blocking_stack_pop_wait(stack, &value) == STACK_SUCCESS && value == i;
+    }
+    BlockingStackStats stats;
+    blocking_stack_stats(stack, &stats);
+    TEST_ASSERT(paired && stats.wakeups == 0, "Uncontended push and pop make no wake calls");
+    
+    /* A consumer blocked on an empty stack is woken by a push */
+    uint64_t sleeps_before = stats.sleeps;
+    pthread_t consumer;
+    pthread_create(&consumer, NULL, blocking_pop_worker, stack);
+    struct timespec pause = { 0, 1000000 };
+    do {
+        nanosleep(&pause, NULL);
+        blocking_stack_stats(stack, &stats);
+    } while (stats.sleeps == sleeps_before);
+    blocking_stack_push_wait(stack, 42);
+    void* received = NULL;
+    pthread_join(consumer, &received);
+    blocking_stack_stats(stack, &stats);
+    TEST_ASSERT((intptr_t)received == 42 && stats.wakeups == 1, "Push wakes a waiting consumer");
+    
+    /* A producer pushing more than the capacity is held back until values are popped */
+    pthread_t producer;
+    pthread_create(&producer, NULL, blocking_produce_worker, stack);
+    long long sum = 0;
+    size_t total = 0;
+    bool bounded = true;
+    while (total < 1000) {
+        blocking_stack_pop_many(stack, drained, 8, &popped);
+        bounded = bounded && popped <= 4;
+        for (size_t i = 0; i < popped; i++) {
+            sum += drained[i];
+        }
+        total += popped;
+    }
+    pthread_join(producer, NULL);
+    TEST_ASSERT(bounded && total == 1000 && sum == 500500, "Backpressure bounds the stack and conserves values");
+    
+    /* Batched pushes feed several sleeping consumers */
+    pthread_t consumers[4];
+    for (int t = 0; t < 4; t++) {
+        pthread_create(&consumers[t], NULL, blocking_consume_worker, stack);
+    }
+    pthread_create(&producer, NULL, blocking_produce_worker, stack);
+    pthread_join(producer, NULL);
+    sum = 0;
+    for (int t = 0; t < 4; t++) {
+        pthread_join(consumers[t], &received);
+        sum += (intptr_t)received;
+    }
+    TEST_ASSERT(sum == 500500 && blocking_stack_size(stack) == 0, "Multiple consumers receive every value once");
+    
+    TEST_ASSERT(blocking_stack_push_wait(NULL, 1) == STACK_ERROR_NULL_POINTER, "Blocking push rejects NULL");
+    blocking_stack_stats(NULL, &stats);
+    TEST_ASSERT(stats.sleeps == 0 && stats.wakeups == 0, "Blocking stack stats of NULL are zero");
+    blocking_stack_destroy(stack);
+    TEST_ASSERT(strcmp(stack_error_string(STACK_ERROR_TIMEOUT), "Unknown error") != 0, "Timeout error has a description");
+}
+
+/**
+ * @brief Test compact narrow and delta-encoded stacks
+ */
+static void test_compact_stack(void) {
+    TEST_SECTION("Compact Stack Tests");
+    
+    TEST_ASSERT(compact_stack_create(0, COMPACT_STACK_NARROW) == NULL, "Zero-capacity compact stack rejected");
+    CompactStack* stack = compact_stack_create(1000, COMPACT_STACK_NARROW);
+    TEST_ASSERT(stack != NULL && compact_stack_element_width(stack) == 1 &&
+                compact_stack_memory_usage(stack) == 1000, "Narrow stack starts at one byte per element");
+    
+    int value = 0;
+    TEST_ASSERT(compact_stack_pop(stack, &value) == STACK_ERROR_UNDERFLOW, "Pop from empty compact stack");
+    for (int i = 0; i < 500; i++) {
+        compact_stack_push(stack, (i % 256) - 128);
+    }
+    TEST_ASSERT(compact_stack_element_width(stack) == 1, "Values within int8_t keep one-byte width");
+    
+    /* Widening converts every stored element in place */
+    TEST_ASSERT(compact_stack_push(stack, 300) == STACK_SUCCESS && compact_stack_element_width(stack) == 2,
+                "Wider value widens to two bytes");
+    TEST_ASSERT(compact_stack_push(stack, INT_MIN) == STACK_SUCCESS && compact_stack_element_width(stack) == sizeof(int),
+                "Full-range value widens to int");
+    TEST_ASSERT(compact_stack_peek(stack, &value) == STACK_SUCCESS && value == INT_MIN, "Peek after widening");
+    
+    bool preserved = compact_stack_pop(stack, &value) == STACK_SUCCESS && value == INT_MIN &&
+                     compact_stack_pop(stack, &value) == STACK_SUCCESS && value == 300;
+    for (int i = 499; i >= 0; i--) {
+        preserved = preserved && compact_stack_pop(stack, &value) == STACK_SUCCESS && value == (i % 256) - 128;
+    }
+    TEST_ASSERT(preserved && compact_stack_is_empty(stack), "Widening preserves all earlier values");
+    compact_stack_destroy(stack);
+    
+    stack = compact_stack_create(3, COMPACT_STACK_NARROW);
+    compact_stack_push(stack, 1);
+    compact_stack_push(stack, 2);
+    compact_stack_push(stack, 3);
+    TEST_ASSERT(compact_stack_is_full(stack) && compact_stack_push(stack, 4) == STACK_ERROR_OVERFLOW, "Compact stack overflow");
+    
+    /* Popped and cleared slots are zeroed, so later widening reads nothing stale */
+    TEST_ASSERT(compact_stack_pop(stack, &value) == STACK_SUCCESS && value == 3 &&
+                compact_stack_push(stack, 70000) == STACK_SUCCESS && compact_stack_pop(stack, &value) == STACK_SUCCESS &&
+                value == 70000 && compact_stack_pop(stack, &value) == STACK_SUCCESS && value == 2,
+                "Widening after a pop keeps the remaining values");
+    TEST_ASSERT(compact_stack_clear(stack) == STACK_SUCCESS && compact_stack_element_width(stack) == sizeof(int) &&
+                compact_stack_push(stack, -5) == STACK_SUCCESS && compact_stack_peek(stack, &value) == STACK_SUCCESS &&
+                value == -5, "Narrow stack reusable after clear");
+    compact_stack_destroy(stack);
+    
+    /* Delta mode stores small steps in one byte and round-trips any sequence */
+    stack = compact_stack_create(10000, COMPACT_STACK_DELTA);
+    TEST_ASSERT(stack != NULL && compact_stack_element_width(stack) == 0, "Delta stack creation");
+    for (int i = 0; i < 10000; i++) {
+        compact_stack_push(stack, 5000000 + i * 2);
+    }
+    TEST_ASSERT(compact_stack_memory_usage(stack) < 10000 * 2, "Monotonic sequence needs about one byte per element");
+    preserved = true;
+    for (int i = 9999; i >= 0; i--) {
+        preserved = preserved && compact_stack_pop(stack, &value) == STACK_SUCCESS && value == 5000000 + i * 2;
+    }
+    TEST_ASSERT(preserved && compact_stack_pop(stack, &value) == STACK_ERROR_UNDERFLOW, "Delta stack pops in LIFO order");
+    
+    int extremes[] = { 0, INT_MAX, INT_MIN, -1, INT_MAX, 0, INT_MIN, 127, -128 };
+    for (size_t i = 0; i < sizeof(extremes) / sizeof(extremes[0]); i++) {
+        compact_stack_push(stack, extremes[i]);
+    }
+    preserved = compact_stack_peek(stack, &value) == STACK_SUCCESS && value == -128;
+    for (size_t i = sizeof(extremes) / sizeof(extremes[0]); i > 0; i--) {
+        preserved = preserved && compact_stack_pop(stack, &value) == STACK_SUCCESS && value == extremes[i - 1];
+    }
+    TEST_ASSERT(preserved, "Delta stack round-trips full-range jumps");
+    
+    compact_stack_push(stack, 7);
+    TEST_ASSERT(compact_stack_clear(stack) == STACK_SUCCESS && compact_stack_size(stack) == 0 &&
+                compact_stack_push(stack, 9) == STACK_SUCCESS && compact_stack_peek(stack, &value) == STACK_SUCCESS &&
+                value == 9, "Clear resets the delta base");
+    compact_stack_destroy(stack);
+}
+
+/**
+ * @brief Test lazy reversed views
+ */
+static void test_reversed_view(void) {
+    TEST_SECTION("Reversed View Tests");
+    
+    char text[1000];
+    char expected[1001];
+    for (int i = 0; i < 1000; i++) {
+        text[i] = (char)(' ' + (i * 31) % 95);
+    }
+    for (int i = 0; i < 1000; i++) {
+        expected[i] = text[999 - i];
+    }
+    expected[1000] = '\0';
+    
+    ReversedView view = reversed_view_make(text, sizeof(text));
+    TEST_ASSERT(view.length == 1000 && reversed_view_at(view, 0) == text[999] && reversed_view_at(view, 999) == text[0],
+                "View indexes from the end");
+    
+    /* Iteration yields full blocks and a short final block, in reversed order */
+    ReversedViewIterator iterator;
+    reversed_view_iterator_init(&iterator, view);
+    const char* block;
+    size_t length;
+    size_t offset = 0;
+    size_t blocks = 0;
+    bool matches = true;
+    while ((length = reversed_view_next_block(&iterator, &block)) > 0) {
+        matches = matches && memcmp(block, expected + offset, length) == 0;
+        offset += length;
+        blocks++;
+    }
+    TEST_ASSERT(matches && offset == 1000 && blocks == (1000 + REVERSED_VIEW_BLOCK_SIZE - 1) / REVERSED_VIEW_BLOCK_SIZE,
+                "Block iteration yields the reversed string");
+    
+    char copy[1001];
+    TEST_ASSERT(reversed_view_copy(view, copy, sizeof(copy)) == REVERSED_VIEW_SUCCESS && strcmp(copy, expected) == 0,
+                "Copy materializes the reversal");
+    TEST_ASSERT(reversed_view_copy(view, copy, 1000) == REVERSED_VIEW_ERROR_BUFFER_TOO_SMALL, "Copy rejects a short buffer");
+    
+    uint64_t fnv = 14695981039346656037ull;
+    for (int i = 0; i < 1000; i++) {
+        fnv = (fnv ^ (unsigned char)expected[i]) * 1099511628211ull;
+    }
+    TEST_ASSERT(reversed_view_hash(view) == fnv, "Hash matches FNV-1a of the materialized reversal");
+    TEST_ASSERT(reversed_view_hash(view) != reversed_view_hash(reversed_view_make(expected, 1000)), "Hash depends on byte order");
+    
+    TEST_ASSERT(reversed_view_equals(view, expected, 1000), "View equals its materialized reversal");
+    TEST_ASSERT(reversed_view_compare(view, expected, 999) > 0 && reversed_view_compare(view, expected, 1000) == 0,
+                "Longer view sorts after its prefix");
+    expected[700] = (char)(expected[700] + 1);
+    TEST_ASSERT(reversed_view_compare(view, expected, 1000) < 0 && !reversed_view_equals(view, expected, 1000),
+                "Compare finds a difference past the first block");
+    TEST_ASSERT(reversed_view_compare(reversed_view_make("ab", 2), "ba", 2) == 0 &&
+                reversed_view_compare(reversed_view_make(NULL, 0), "", 0) == 0, "Compare short and empty views");
+    
+    /* Writing to a pipe delivers exactly the reversed bytes */
+    int fds[2];
+    bool written = false;
+    if (pipe(fds) == 0) {
+        written = reversed_view_write_fd(view, fds[1]) == REVERSED_VIEW_SUCCESS;
+        close(fds[1]);
+        size_t received = 0;
+        ssize_t count;
+        while ((count = read(fds[0], copy + received, sizeof(copy) - 1 - received)) > 0) {
+            received += (size_t)count;
+        }
+        close(fds[0]);
+        copy[received] = '\0';
+        written = written && received == 1000 && reversed_view_equals(view, copy, received);
+    }
+    TEST_ASSERT(written, "Write to a file descriptor streams the reversal");
+    TEST_ASSERT(reversed_view_write_fd(view, -1) == REVERSED_VIEW_ERROR_IO, "Write to a bad descriptor fails");
+}
+
+/**
+ * @brief Thread body that reverses a small set of keys through a shared cache
+ */
+static void* reversal_cache_worker(void* argument) {
+    ReversalCache* cache = argument;
+    char key[16];
+    char output[16];
+    intptr_t wrong = 0;
+    for (int i = 0; i < 5000; i++) {
+        int length = snprintf(key, sizeof(key), "key-%d", i % 64);
+        reversal_cache_reverse(cache, key, (size_t)length, output, sizeof(output));
+        for (int j = 0; j < length; j++) {
+            wrong += output[j] != key[length - 1 - j];
+        }
+    }
+    return (void*)wrong;
+}
+
+/**
+ * @brief Test memoizing reversal cache
+ */
+static void test_reversal_cache(void) {
+    TEST_SECTION("Reversal Cache Tests");
+    
+    ReversalCache* cache = reversal_cache_create(4096, 2);
+    TEST_ASSERT(cache != NULL, "Reversal cache creation");
+    
+    char output[64];
+    ReversalCacheStats stats;
+    TEST_ASSERT(reversal_cache_reverse(cache, "hello", 5, output, sizeof(output)) == REVERSAL_CACHE_SUCCESS &&
+                strcmp(output, "olleh") == 0, "Miss reverses the input");
+    TEST_ASSERT(reversal_cache_reverse(cache, "hello", 5, output, sizeof(output)) == REVERSAL_CACHE_SUCCESS &&
+                strcmp(output, "olleh") == 0, "Hit returns the cached reversal");
+    reversal_cache_reverse(cache, "help", 4, output, sizeof(output));
+    reversal_cache_stats(cache, &stats);
+    TEST_ASSERT(stats.hits == 1 && stats.misses == 2 && stats.entries == 2 && stats.bytes > 0, "Hit and miss counters");
+    TEST_ASSERT(reversal_cache_reverse(cache, "hello", 5, output, 5) == REVERSAL_CACHE_ERROR_BUFFER_TOO_SMALL,
+                "Short output buffer rejected");
+    TEST_ASSERT(reversal_cache_reverse(cache, "", 0, output, 1) == REVERSAL_CACHE_SUCCESS && output[0] == '\0',
+                "Empty input reverses to empty");
+    
+    /* Filling past the budget evicts unreferenced entries before hot ones */
+    reversal_cache_destroy(cache);
+    cache = reversal_cache_create(2048, 1);
+    char key[32];
+    for (int i = 0; i < 200; i++) {
+        int length = snprintf(key, sizeof(key), "cold-key-%d", i);
+        reversal_cache_reverse(cache, key, (size_t)length, output, sizeof(output));
+        reversal_cache_reverse(cache, "hot-key", 7, output, sizeof(output));
+    }
+    reversal_cache_stats(cache, &stats);
+    TEST_ASSERT(stats.bytes <= 2048 && stats.evictions > 0, "Cache stays within its byte budget");
+    TEST_ASSERT(stats.hits == 199 && strcmp(output, "yek-toh") == 0, "Frequently hit entry survives eviction");
+    
+    reversal_cache_clear(cache);
+    reversal_cache_stats(cache, &stats);
+    TEST_ASSERT(stats.entries == 0 && stats.bytes == 0 && stats.hits == 0, "Clear empties the cache");
+    
+    char large[1500];
+    char large_output[1501];
+    memset(large, 'x', sizeof(large));
+    large[0] = 'a';
+    TEST_ASSERT(reversal_cache_reverse(cache, large, sizeof(large), large_output, sizeof(large_output)) == REVERSAL_CACHE_SUCCESS &&
+                large_output[1499] == 'a', "Input larger than a shard is reversed");
+    reversal_cache_stats(cache, &stats);
+    TEST_ASSERT(stats.entries == 0, "Input larger than a shard is not cached");
+    reversal_cache_destroy(cache);
+    
+    /* Concurrent lookups and inserts always return correct reversals */
+    cache = reversal_cache_create(1024, 4);
+    pthread_t workers[4];
+    for (int t = 0; t < 4; t++) {
+        pthread_create(&workers[t], NULL, reversal_cache_worker, cache);
+    }
+    intptr_t wrong = 0;
+    for (int t = 0; t < 4; t++) {
+        void* result;
+        pthread_join(workers[t], &result);
+        wrong += (intptr_t)result;
+    }
+    reversal_cache_stats(cache, &stats);
+    TEST_ASSERT(wrong == 0 && stats.hits + stats.misses == 20000, "Concurrent reversals are correct");
+    reversal_cache_destroy(cache);
+    
+    TEST_ASSERT(reversal_cache_reverse(NULL, "a", 1, output, sizeof(output)) == REVERSAL_CACHE_ERROR_NULL_POINTER,
+                "Cached reversal rejects NULL");
+}
+
+/**
+ * @brief Connects a blocking client to a reversal server socket
+ */
+static int reversal_server_connect(const char* path) {
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+    if (fd >= 0 && connect(fd, (const struct sockaddr*)&address, sizeof(address)) != 0) {
+        close(fd);
+        fd = -1;
+    }
+    return fd;
+}
+
+/**
+ * @brief Reads exactly length bytes, or fewer if the peer closes
+ */
+static size_t reversal_server_read(int fd, char* buffer, size_t length) {
+    size_t received = 0;
+    while (received < length) {
+        ssize_t n = read(fd, buffer + received, length - received);
+        if (n <= 0) {
+            break;
+        }
+        received += (size_t)n;
+    }
+    return received;
+}
+
+/**
+ * @brief Test local reversal server
+ */
+static void test_reversal_server(void) {
+    TEST_SECTION("Reversal Server Tests");
+    
+    ReversalServerOptions options;
+    reversal_server_options_init(&options);
+    TEST_ASSERT(options.socket_path == NULL && options.thread_count == 0 &&
+                options.max_request == REVERSAL_SERVER_DEFAULT_MAX_REQUEST, "Options defaults");
+    
+    ReversalServer* server = NULL;
+    TEST_ASSERT(reversal_server_start(&options, &server) == REVERSAL_SERVER_ERROR_NULL_POINTER,
+                "Missing socket path rejected");
+    char long_path[200];
+    memset(long_path, 'p', sizeof(long_path) - 1);
+    long_path[sizeof(long_path) - 1] = '\0';
+    options.socket_path = long_path;
+    TEST_ASSERT(reversal_server_start(&options, &server) == REVERSAL_SERVER_ERROR_INVALID_OPTIONS,
+                "Over-long socket path rejected");
+    
+    /* A regular file at the socket path is never removed */
+    char path[64];
+    snprintf(path, sizeof(path), "/tmp/test-reversal-%ld.txt", (long)getpid());
+    FILE* file = fopen(path, "w");
+    TEST_ASSERT(file != NULL && fputs("keep", file) >= 0 && fclose(file) == 0, "Regular file created");
+    options.socket_path = path;
+    TEST_ASSERT(reversal_server_start(&options, &server) == REVERSAL_SERVER_ERROR_SOCKET,
+                "Regular file at socket path rejected");
+    TEST_ASSERT(access(path, F_OK) == 0, "Regular file at socket path survives");
+    unlink(path);
+    
+    /* A socket left behind by a dead server is replaced */
+    snprintf(path, sizeof(path), "/tmp/test-reversal-%ld.sock", (long)getpid());
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, path);
+    int stale = socket(AF_UNIX, SOCK_STREAM, 0);
+    TEST_ASSERT(stale >= 0 && bind(stale, (const struct sockaddr*)&address, sizeof(address)) == 0,
+                "Stale socket file created");
+    close(stale);
+    options.thread_count = 2;
+    options.max_request = 64;
+    TEST_ASSERT(reversal_server_start(&options, &server) == REVERSAL_SERVER_SUCCESS && server != NULL,
+                "Server starts over a stale socket");
+    
+    /* A socket another server is listening on is left alone */
+    ReversalServer* second = NULL;
+    TEST_ASSERT(reversal_server_start(&options, &second) == REVERSAL_SERVER_ERROR_SOCKET && second == NULL,
+                "Live socket path rejected");
+    
+    /* Three pipelined requests in one write, including an empty one */
+    int fd = reversal_server_connect(path);
+    TEST_ASSERT(fd >= 0, "Client connects");
+    const char requests[] = "\0\0\0\5hello" "\0\0\0\0" "\0\0\0\x1a" "abcdefghijklmnopqrstuvwxyz";
+    const char expected[] = "\0\0\0\5olleh" "\0\0\0\0" "\0\0\0\x1a" "zyxwvutsrqponmlkjihgfedcba";
+    char responses[sizeof(expected)];
+    ssize_t written = write(fd, requests, sizeof(requests) - 1);
+    TEST_ASSERT(written == (ssize_t)sizeof(requests) - 1 &&
+                reversal_server_read(fd, responses, sizeof(expected) - 1) == sizeof(expected) - 1 &&
+                memcmp(responses, expected, sizeof(expected) - 1) == 0, "Pipelined responses arrive in order");
+    
+    /* A request split across writes is answered once complete */
+    written = write(fd, "\0\0\0\3a", 5);
+    written += write(fd, "bc", 2);
+    TEST_ASSERT(written == 7 && reversal_server_read(fd, responses, 7) == 7 &&
+                memcmp(responses, "\0\0\0\3cba", 7) == 0, "Split request is reassembled");
+    TEST_ASSERT(reversal_server_request_count(server) == 4, "Request counter");
+    
+    /* A request over the limit closes the connection */
+    written = write(fd, "\0\0\1\0", 4);
+    TEST_ASSERT(written == 4 && reversal_server_read(fd, responses, 1) == 0, "Oversized request closes connection");
+    close(fd);
+    
+    reversal_server_stop(server);
+    TEST_ASSERT(access(path, F_OK) != 0, "Socket file removed on stop");
+    TEST_ASSERT(strcmp(reversal_server_error_string(REVERSAL_SERVER_ERROR_SOCKET), "Socket setup failed") == 0,
+                "Reversal server error string");
+}
+
+/**
+ * @brief Test spill-to-disk stack
+ */
+static void test_spill_stack(void) {
+    TEST_SECTION("Spill Stack Tests");
+    
+    SpillStack* stack = spill_stack_create(0, NULL);
+    TEST_ASSERT(stack != NULL && spill_stack_is_empty(stack), "Spill stack creation");
+    
+    int value = 0;
+    TEST_ASSERT(spill_stack_pop(stack, &value) == STACK_ERROR_UNDERFLOW, "Pop from empty spill stack");
+    TEST_ASSERT(spill_stack_peek(stack, &value) == STACK_ERROR_UNDERFLOW, "Peek at empty spill stack");
+    TEST_ASSERT(spill_stack_push(NULL, 1) == STACK_ERROR_NULL_POINTER, "Push to NULL spill stack");
+    
+    /* Ten segments under the smallest budget */
+    const int total = 10 * SPILL_STACK_SEGMENT_VALUES;
+    bool pushed = true;
+    for (int i = 0; i < total; i++) {
+        pushed &= spill_stack_push(stack, i) == STACK_SUCCESS;
+    }
+    SpillStackStats stats;
+    spill_stack_stats(stack, &stats);
+    TEST_ASSERT(pushed && spill_stack_size(stack) == (size_t)total, "Push beyond the memory budget");
+    TEST_ASSERT(stats.resident_segments <= SPILL_STACK_MIN_SEGMENTS - 2 && stats.spilled_segments == 10 - (SPILL_STACK_MIN_SEGMENTS - 2) &&
+                stats.bytes_written == stats.spilled_segments * SPILL_STACK_SEGMENT_VALUES * sizeof(int), "Bottom segments spilled");
+    TEST_ASSERT(spill_stack_peek(stack, &value) == STACK_SUCCESS && value == total - 1, "Peek at spilled stack");
+    
+    /* Hovering around a segment boundary does not touch the disk again */
+    bool hovered = spill_stack_push(stack, -1) == STACK_SUCCESS && spill_stack_pop(stack, &value) == STACK_SUCCESS;
+    spill_stack_stats(stack, &stats);
+    uint64_t written = stats.bytes_written;
+    for (int i = 0; i < 1000; i++) {
+        hovered &= spill_stack_push(stack, -1) == STACK_SUCCESS;
+        hovered &= spill_stack_pop(stack, &value) == STACK_SUCCESS && value == -1;
+    }
+    spill_stack_stats(stack, &stats);
+    TEST_ASSERT(hovered && stats.bytes_written == written, "Boundary push/pop stays in memory");
+    
+    bool ordered = true;
+    for (int i = total - 1; i >= 0; i--) {
+        ordered &= spill_stack_pop(stack, &value) == STACK_SUCCESS && value == i;
+    }
+    spill_stack_stats(stack, &stats);
+    TEST_ASSERT(ordered && spill_stack_is_empty(stack), "Pops return spilled values in order");
+    TEST_ASSERT(stats.spilled_segments == 0 && stats.prefetch_hits + stats.prefetch_misses >= 7 &&
+                stats.bytes_read == (stats.prefetch_hits + stats.prefetch_misses) * SPILL_STACK_SEGMENT_VALUES * sizeof(int),
+                "Spilled segments read back");
+    
+    /* The stack is reusable after draining */
+    TEST_ASSERT(spill_stack_push(stack, 42) == STACK_SUCCESS && spill_stack_pop(stack, &value) == STACK_SUCCESS &&
+                value == 42, "Spill stack reusable after draining");
+    spill_stack_destroy(stack);
+    
+    /* The spill file is only created once needed */
+    stack = spill_stack_create(0, "/nonexistent-spill-directory");
+    bool in_memory = true;
+    for (int i = 0; i < (SPILL_STACK_MIN_SEGMENTS - 2) * SPILL_STACK_SEGMENT_VALUES; i++) {
+        in_memory &= spill_stack_push(stack, i) == STACK_SUCCESS;
+    }
+    TEST_ASSERT(in_memory, "Pushes within the budget need no spill file");
+    TEST_ASSERT(spill_stack_push(stack, 0) == STACK_ERROR_IO &&
+                spill_stack_size(stack) == (SPILL_STACK_MIN_SEGMENTS - 2) * (size_t)SPILL_STACK_SEGMENT_VALUES,
+                "Failed spill reports I/O error");
+    TEST_ASSERT(spill_stack_pop(stack, &value) == STACK_SUCCESS && value == (SPILL_STACK_MIN_SEGMENTS - 2) * SPILL_STACK_SEGMENT_VALUES - 1,
+                "Stack intact after failed spill");
+    spill_stack_destroy(stack);
+}
+
+/**
+ * @brief Runs push/pop pairs of one value on a shared stack, as a child process
+ * @return Process exit status: 0 if every pop returned the pushed value
+ */
+static int shared_stack_child(const char* name, int rounds) {
+    SharedStack* stack = shared_stack_attach(name);
+    if (!stack) {
+        return 1;
+    }
+    
+    int failures = 0;
+    for (int i = 0; rounds < 0 || i < rounds; i++) {
+        int value = 0;
+        if (shared_stack_push(stack, 7) != STACK_SUCCESS ||
+            shared_stack_pop(stack, &value) != STACK_SUCCESS || value != 7) {
+            failures++;
+        }
+    }
+    shared_stack_detach(stack);
+    return failures == 0 ? 0 : 1;
+}
+
+/**
+ * @brief Test shared-memory cross-process stack
+ */
+static void test_shared_stack(void) {
+    TEST_SECTION("Shared Stack Tests");
+    
+    char name[64];
+    snprintf(name, sizeof(name), "/test-shared-stack-%ld", (long)getpid());
+    shared_stack_unlink(name);
+    
+    SharedStack* stack = shared_stack_create(name, 100);
+    TEST_ASSERT(stack != NULL && shared_stack_capacity(stack) == 100 && shared_stack_is_empty(stack),
+                "Shared stack creation");
+    TEST_ASSERT(shared_stack_create(name, 100) == NULL, "Creating an existing name fails");
+    TEST_ASSERT(shared_stack_attach("/test-shared-stack-missing") == NULL, "Attaching to a missing name fails");
+    
+    int value = 0;
+    TEST_ASSERT(shared_stack_pop(stack, &value) == STACK_ERROR_UNDERFLOW, "Pop from empty shared stack");
+    bool filled = true;
+    for (int i = 0; i < 100; i++) {
+        filled &= shared_stack_push(stack, i) == STACK_SUCCESS;
+    }
+    TEST_ASSERT(filled && shared_stack_push(stack, 100) == STACK_ERROR_OVERFLOW && shared_stack_size(stack) == 100,
+                "Shared stack fills to capacity");
+    bool ordered = true;
+    for (int i = 99; i >= 0; i--) {
+        ordered &= shared_stack_pop(stack, &value) == STACK_SUCCESS && value == i;
+    }
+    TEST_ASSERT(ordered && shared_stack_is_empty(stack), "Shared stack pops in LIFO order");
+    
+    /* A second attachment in the same process sees the same stack */
+    SharedStack* other = shared_stack_attach(name);
+    shared_stack_push(stack, 42);
+    TEST_ASSERT(other != NULL && shared_stack_pop(other, &value) == STACK_SUCCESS && value == 42,
+                "Attached handle shares values");
+    shared_stack_detach(other);
+    
+    /* Two processes pushing and popping concurrently */
+    pid_t child = fork();
+    if (child == 0) {
+        _exit(shared_stack_child(name, 20000));
+    }
+    int failures = 0;
+    for (int i = 0; i < 20000; i++) {
+        if (shared_stack_push(stack, 7) != STACK_SUCCESS ||
+            shared_stack_pop(stack, &value) != STACK_SUCCESS || value != 7) {
+            failures++;
+        }
+    }
+    int status = -1;
+    waitpid(child, &status, 0);
+    TEST_ASSERT(failures == 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0 && shared_stack_is_empty(stack),
+                "Concurrent cross-process push/pop");
+    
+    /* A process killed while attached cannot block the others */
+    child = fork();
+    if (child == 0) {
+        _exit(shared_stack_child(name, -1));
+    }
+    struct timespec pause = { 0, 20000000 };
+    nanosleep(&pause, NULL);
+    kill(child, SIGKILL);
+    waitpid(child, &status, 0);
+    while (shared_stack_pop(stack, &value) == STACK_SUCCESS) {
+    }
+    int pushed = 0;
+    while (shared_stack_push(stack, pushed) == STACK_SUCCESS) {
+        pushed++;
+    }
+    TEST_ASSERT(WIFSIGNALED(status) && pushed >= 99, "Stack usable after an attached process is killed");
+    
+    shared_stack_detach(stack);
+    TEST_ASSERT(shared_stack_unlink(name) == STACK_SUCCESS && shared_stack_attach(name) == NULL,
+                "Unlinked shared stack cannot be attached");
+}
+
+/**
+ * @brief Test read-only span, iterator and bulk access to stack contents
+ */
+static void test_stack_scan(void) {
+    TEST_SECTION("Stack Span and Scan Tests");
+    
+    Stack* stack = stack_create(1000);
+    int64_t expected_sum = 0;
+    for (int i = 0; i < 999; i++) {
+        int value = i % 5 == 0 ? (i % 2 ? INT_MAX : INT_MIN) : i % 37 - 18;
+        stack_push(stack, value);
+        expected_sum += value;
+    }
+    
+    const int* data = stack_data(stack);
+    TEST_ASSERT(data != NULL && data[0] == INT_MIN && data[998] == 998 % 37 - 18, "Span exposes elements bottom first");
+    TEST_ASSERT(stack_data(NULL) == NULL, "Span of NULL stack");
+    
+    StackIterator iterator;
+    int value;
+    size_t visited = 0;
+    bool in_order = true;
+    stack_iterator_init(&iterator, stack, STACK_ORDER_TOP_DOWN);
+    while (stack_iterator_next(&iterator, &value)) {
+        in_order &= value == data[998 - visited];
+        visited++;
+    }
+    TEST_ASSERT(in_order && visited == 999, "Top-down iteration");
+    visited = 0;
+    in_order = true;
+    stack_iterator_init(&iterator, stack, STACK_ORDER_BOTTOM_UP);
+    while (stack_iterator_next(&iterator, &value)) {
+        in_order &= value == data[visited];
+        visited++;
+    }
+    TEST_ASSERT(in_order && visited == 999, "Bottom-up iteration");
+    stack_iterator_init(&iterator, NULL, STACK_ORDER_TOP_DOWN);
+    TEST_ASSERT(!stack_iterator_next(&iterator, &value), "Iteration over NULL stack is empty");
+    
+    /* Scans against naive reference results */
+    size_t expected_count = 0;
+    for (int i = 0; i < 999; i++) {
+        expected_count += data[i] == -5;
+    }
+    size_t depth = 0;
+    TEST_ASSERT(stack_count(stack, -5) == expected_count && stack_count(stack, 12345) == 0, "Count occurrences");
+    TEST_ASSERT(stack_sum(stack) == expected_sum, "Sum widens without overflow");
+    TEST_ASSERT(stack_find(stack, 998 % 37 - 18, &depth) && depth == 0, "Find top element");
+    TEST_ASSERT(stack_find(stack, INT_MIN, &depth) && data[998 - depth] == INT_MIN && depth == 998 - 990,
+                "Find nearest occurrence from the top");
+    stack_push(stack, 777);
+    stack_pop(stack, &value);
+    TEST_ASSERT(!stack_find(stack, 777, &depth), "Find missing value");
+    
+    int output[999];
+    TEST_ASSERT(stack_copy_out(stack, output, 999, STACK_ORDER_BOTTOM_UP) == 999 &&
+                memcmp(output, data, sizeof(output)) == 0, "Copy out bottom-up");
+    bool reversed = stack_copy_out(stack, output, 7, STACK_ORDER_TOP_DOWN) == 7;
+    for (size_t i = 0; i < 7; i++) {
+        reversed &= output[i] == data[998 - i];
+    }
+    TEST_ASSERT(reversed, "Copy out top elements top-down");
+    reversed = stack_copy_out(stack, output, 5000, STACK_ORDER_TOP_DOWN) == 999;
+    for (size_t i = 0; i < 999; i++) {
+        reversed &= output[i] == data[998 - i];
+    }
+    TEST_ASSERT(reversed, "Copy out whole stack top-down");
+    
+    TEST_ASSERT(stack_size(stack) == 999 && stack_peek(stack, &value) == STACK_SUCCESS && value == data[998],
+                "Scans leave the stack unchanged");
+    stack_destroy(stack);
+    
+    /* Small inline stacks and empty stacks */
+    stack = stack_create(3);
+    TEST_ASSERT(stack_sum(stack) == 0 && stack_count(stack, 0) == 0 && !stack_find(stack, 0, NULL) &&
+                stack_copy_out(stack, output, 10, STACK_ORDER_TOP_DOWN) == 0, "Scans of empty stack");
+    stack_push(stack, 1);
+    stack_push(stack, 2);
+    stack_push(stack, 1);
+    TEST_ASSERT(stack_count(stack, 1) == 2 && stack_sum(stack) == 4 && stack_find(stack, 2, &depth) && depth == 1,
+                "Scans of inline stack");
+    stack_destroy(stack);
+    TEST_ASSERT(stack_sum(NULL) == 0 && stack_copy_out(NULL, output, 10, STACK_ORDER_BOTTOM_UP) == 0,
+                "Scans of NULL stack");
+}
+
+/**
+ * @brief Tests stacks sharing one buffer
+ */
+static void test_multi_stack(void) {
+    TEST_SECTION("Multi-Stack Tests");
+    
+    TEST_ASSERT(multi_stack_create(0, 10) == NULL, "Reject zero stacks");
+    TEST_ASSERT(multi_stack_create(MULTI_STACK_MAX_STACKS + 1, 10) == NULL, "Reject too many stacks");
+    TEST_ASSERT(multi_stack_create(2, 0) == NULL, "Reject zero capacity");
+    
+    /* Two stacks grow from opposite ends until they meet */
+    MultiStack* pair = multi_stack_create(2, 8);
+    int value = 0;
+    for (int i = 0; i < 6; i++) {
+        multi_stack_push(pair, 0, i);
+    }
+    TEST_ASSERT(multi_stack_push(pair, 1, 100) == STACK_SUCCESS &&
+                multi_stack_push(pair, 1, 101) == STACK_SUCCESS, "Second stack uses the remaining room");
+    TEST_ASSERT(multi_stack_push(pair, 0, 6) == STACK_ERROR_OVERFLOW &&
+                multi_stack_push(pair, 1, 102) == STACK_ERROR_OVERFLOW, "Overflow only when the buffer is full");
+    TEST_ASSERT(multi_stack_peek(pair, 1, &value) == STACK_SUCCESS && value == 101 &&
+                multi_stack_size(pair, 0) == 6 && multi_stack_size(pair, 1) == 2, "Peek and sizes of both stacks");
+    multi_stack_pop(pair, 1, &value);
+    TEST_ASSERT(multi_stack_push(pair, 0, 6) == STACK_SUCCESS && multi_stack_pop(pair, 0, &value) == STACK_SUCCESS &&
+                value == 6, "Freed slot moves to the other stack");
+    multi_stack_clear(pair, 0);
+    TEST_ASSERT(multi_stack_is_empty(pair, 0) && multi_stack_pop(pair, 1, &value) == STACK_SUCCESS && value == 100 &&
+                multi_stack_pop(pair, 1, &value) == STACK_ERROR_UNDERFLOW, "Clear and underflow are per stack");
+    TEST_ASSERT(multi_stack_push(pair, 2, 0) == STACK_ERROR_INVALID_INDEX &&
+                multi_stack_pop(pair, 2, &value) == STACK_ERROR_INVALID_INDEX &&
+                multi_stack_size(pair, 2) == 0, "Reject out-of-range index");
+    multi_stack_destroy(pair);
+    
+    /* Many stacks with skewed growth against per-stack reference arrays */
+    enum { COUNT = 5, CAPACITY = 200 };
+    MultiStack* stacks = multi_stack_create(COUNT, CAPACITY);
+    static int expected[COUNT][CAPACITY];
+    size_t sizes[COUNT] = {0};
+    size_t total = 0;
+    bool consistent = true;
+    unsigned seed = 12345;
+    for (int step = 0; step < 20000; step++) {
+        seed = seed * 1103515245u + 12345u;
+        size_t index = (seed >> 16) % 8 < 4 ? 0 : (seed >> 16) % COUNT;      /* Stack 0 is the busiest */
+        bool push = (seed >> 8) % 3 != 0;
+        if (push) {
+            int pushed = (int)(seed >> 4);
+            StackResult result = multi_stack_push(stacks, index, pushed);
+            if (total == CAPACITY) {
+                consistent &= result == STACK_ERROR_OVERFLOW;
+            } else {
+                consistent &= result == STACK_SUCCESS;
+                expected[index][sizes[index]++] = pushed;
+                total++;
+            }
+        } else {
+            StackResult result = multi_stack_pop(stacks, index, &value);
+            if (sizes[index] == 0) {
+                consistent &= result == STACK_ERROR_UNDERFLOW;
+            } else {
+                consistent &= result == STACK_SUCCESS && value == expected[index][--sizes[index]];
+                total--;
+            }
+        }
+    }
+    for (size_t i = 0; i < COUNT; i++) {
+        consistent &= multi_stack_size(stacks, i) == sizes[i];
+        while (sizes[i] > 0) {
+            consistent &= multi_stack_pop(stacks, i, &value) == STACK_SUCCESS && value == expected[i][--sizes[i]];
+        }
+    }
+    TEST_ASSERT(consistent, "Many stacks match a reference through reallocations and overflow");
+    
+    for (int i = 0; i < CAPACITY; i++) {
+        multi_stack_push(stacks, COUNT - 1, i);
+    }
+    TEST_ASSERT(multi_stack_size(stacks, COUNT - 1) == CAPACITY &&
+                multi_stack_push(stacks, 0, 0) == STACK_ERROR_OVERFLOW &&
+                multi_stack_peek(stacks, COUNT - 1, &value) == STACK_SUCCESS && value == CAPACITY - 1,
+                "One stack can take the whole buffer");
+    multi_stack_destroy(stacks);
+    
+    MultiStack* single = multi_stack_create(1, 3);
+    for (int i = 0; i < 3; i++) {
+        multi_stack_push(single, 0, i);
+    }
+    TEST_ASSERT(multi_stack_push(single, 0, 3) == STACK_ERROR_OVERFLOW && multi_stack_count(single) == 1 &&
+                multi_stack_capacity(single) == 3, "Single stack is bounded by the capacity");
+    multi_stack_destroy(single);
+    
+    TEST_ASSERT(multi_stack_push(NULL, 0, 1) == STACK_ERROR_NULL_POINTER && multi_stack_is_empty(NULL, 0) &&
+                strcmp(stack_error_string(STACK_ERROR_INVALID_INDEX), "Stack index out of range") == 0,
+                "NULL container and error string");
+}
+
 /**
  * @brief Main test runner
  */
@@ -292,9 +2182,33 @@ int main(void) {
     test_dynamic_stack_push();
     test_dynamic_stack_pop();
     test_dynamic_stack_peek();
+    test_dynamic_stack_mark_rewind();
+    test_dynamic_stack_reserve();
     test_static_stack_operations();
     test_string_reversal();
+    test_sized_char_stack();
     test_error_handling();
+    test_persistent_stack();
+    test_minmax_stack();
+    test_monotonic_kernels();
+    test_bracket_validator();
+    test_dynamic_stack_options();
+    test_dynamic_stack_allocator();
+    test_word_reverse();
+    test_palindrome();
+    test_work_stealing();
+    test_stack_vm();
+    test_reverse_transform();
+    test_sharded_stack();
+    test_blocking_stack();
+    test_compact_stack();
+    test_reversed_view();
+    test_reversal_cache();
+    test_reversal_server();
+    test_spill_stack();
+    test_shared_stack();
+    test_stack_scan();
+    test_multi_stack();
     
     /* Print test summary */
     printf("\n=== Test Summary ===\n");